@@ -7,7 +7,9 @@ use serde::{Deserialize, Serialize};
 use std::collections::HashMap;
 use std::sync::{Mutex, OnceLock};
 
-use cadhy_cad::{Analysis, Export, Operations, Primitives, Shape, ShapeAnalysis, StepIO, Topology};
+use cadhy_cad::{
+    Analysis, Export, FlatMesh, Operations, Primitives, Shape, ShapeAnalysis, StepIO, Topology,
+};
 
 // =============================================================================
 // SHAPE REGISTRY
@@ -888,11 +890,16 @@ pub fn cad_offset(shape_id: String, offset: f64) -> Result<ShapeResult, String>
 #[tauri::command(rename_all = "camelCase")]
 pub fn cad_tessellate_binary(shape_id: String, deflection: f64) -> Result<Vec<u8>, String> {
     let shape = get_shape(&shape_id)?;
-    let mesh = shape.tessellate(deflection).map_err(|e| e.to_string())?;
+    // Flat f32 buffers are filled in place by the C++ side (0.5 rad = default angle)
+    let mut mesh = shape
+        .tessellate_flat(deflection, 0.5)
+        .map_err(|e| e.to_string())?;
+    // Face ids are not sent, so triangles can be clustered freely
+    mesh.optimize_for_rendering(false);
 
-    let vertex_count = mesh.vertices.len() as u32;
-    let triangle_count = (mesh.indices.len() / 3) as u32;
-    let has_normals = !mesh.normals.is_empty();
+    let vertex_count = mesh.vertex_count() as u32;
+    let triangle_count = mesh.triangle_count() as u32;
+    let has_normals = vertex_count > 0;
 
     // CRITICAL: Validate tessellation produced valid mesh data
     if vertex_count == 0 || triangle_count == 0 {
@@ -920,10 +927,10 @@ pub fn cad_tessellate_binary(shape_id: String, deflection: f64) -> Result<Vec<u8
     buffer.push(if has_normals { 1 } else { 0 });
 
     // Write vertices (f32)
-    for v in &mesh.vertices {
-        buffer.extend_from_slice(&(v.x as f32).to_le_bytes());
-        buffer.extend_from_slice(&(v.y as f32).to_le_bytes());
-        buffer.extend_from_slice(&(v.z as f32).to_le_bytes());
+    for v in mesh.vertex_data.chunks_exact(FlatMesh::STRIDE) {
+        for &c in &v[0..3] {
+            buffer.extend_from_slice(&c.to_le_bytes());
+        }
     }
 
     // Write indices (u32)
@@ -933,10 +940,10 @@ pub fn cad_tessellate_binary(shape_id: String, deflection: f64) -> Result<Vec<u8
 
     // Write normals (f32)
     if has_normals {
-        for n in &mesh.normals {
-            buffer.extend_from_slice(&(n.x as f32).to_le_bytes());
-            buffer.extend_from_slice(&(n.y as f32).to_le_bytes());
-            buffer.extend_from_slice(&(n.z as f32).to_le_bytes());
+        for v in mesh.vertex_data.chunks_exact(FlatMesh::STRIDE) {
+            for &c in &v[3..6] {
+                buffer.extend_from_slice(&c.to_le_bytes());
+            }
         }
     }
 
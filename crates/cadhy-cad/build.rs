@@ -17,6 +17,10 @@ fn main() {
     // CADHY modular C++ headers
     println!("cargo:rerun-if-changed=cpp/include/cadhy/cadhy.hpp");
     println!("cargo:rerun-if-changed=cpp/include/cadhy/core/types.hpp");
+    println!("cargo:rerun-if-changed=cpp/include/cadhy/core/mesh_cache.hpp");
+    println!("cargo:rerun-if-changed=cpp/include/cadhy/core/fingerprint.hpp");
+    println!("cargo:rerun-if-changed=cpp/include/cadhy/core/lru_cache.hpp");
+    println!("cargo:rerun-if-changed=cpp/include/cadhy/core/progress.hpp");
     println!("cargo:rerun-if-changed=cpp/include/cadhy/edit/selection.hpp");
     println!("cargo:rerun-if-changed=cpp/include/cadhy/edit/face_ops.hpp");
     println!("cargo:rerun-if-changed=cpp/include/cadhy/primitives/primitives.hpp");
@@ -26,11 +30,22 @@ fn main() {
     println!("cargo:rerun-if-changed=cpp/include/cadhy/sweep/sweep.hpp");
     println!("cargo:rerun-if-changed=cpp/include/cadhy/wire/wire.hpp");
     println!("cargo:rerun-if-changed=cpp/include/cadhy/mesh/mesh.hpp");
+    println!("cargo:rerun-if-changed=cpp/include/cadhy/mesh/vertex_weld.hpp");
+    println!("cargo:rerun-if-changed=cpp/include/cadhy/mesh/vertex_cache.hpp");
+    println!("cargo:rerun-if-changed=cpp/include/cadhy/mesh/simplify.hpp");
+    println!("cargo:rerun-if-changed=cpp/include/cadhy/mesh/adaptive.hpp");
+    println!("cargo:rerun-if-changed=cpp/include/cadhy/mesh/slice.hpp");
     println!("cargo:rerun-if-changed=cpp/include/cadhy/io/io.hpp");
     println!("cargo:rerun-if-changed=cpp/include/cadhy/analysis/analysis.hpp");
     println!("cargo:rerun-if-changed=cpp/include/cadhy/projection/projection.hpp");
+    println!("cargo:rerun-if-changed=cpp/include/cadhy/projection/hatch.hpp");
+    println!("cargo:rerun-if-changed=cpp/include/cadhy/projection/drawing_writer.hpp");
+    println!("cargo:rerun-if-changed=cpp/include/cadhy/projection/hlr_cleanup.hpp");
 
     // CADHY modular C++ implementations
+    println!("cargo:rerun-if-changed=cpp/src/core/mesh_cache.cpp");
+    println!("cargo:rerun-if-changed=cpp/src/core/fingerprint.cpp");
+    println!("cargo:rerun-if-changed=cpp/src/core/progress.cpp");
     println!("cargo:rerun-if-changed=cpp/src/edit/selection.cpp");
     println!("cargo:rerun-if-changed=cpp/src/edit/face_ops.cpp");
     println!("cargo:rerun-if-changed=cpp/src/primitives/primitives.cpp");
@@ -40,9 +55,17 @@ fn main() {
     println!("cargo:rerun-if-changed=cpp/src/sweep/sweep.cpp");
     println!("cargo:rerun-if-changed=cpp/src/wire/wire.cpp");
     println!("cargo:rerun-if-changed=cpp/src/mesh/mesh.cpp");
+    println!("cargo:rerun-if-changed=cpp/src/mesh/vertex_weld.cpp");
+    println!("cargo:rerun-if-changed=cpp/src/mesh/vertex_cache.cpp");
+    println!("cargo:rerun-if-changed=cpp/src/mesh/simplify.cpp");
+    println!("cargo:rerun-if-changed=cpp/src/mesh/adaptive.cpp");
+    println!("cargo:rerun-if-changed=cpp/src/mesh/slice.cpp");
     println!("cargo:rerun-if-changed=cpp/src/io/io.cpp");
     println!("cargo:rerun-if-changed=cpp/src/analysis/analysis.cpp");
     println!("cargo:rerun-if-changed=cpp/src/projection/projection.cpp");
+    println!("cargo:rerun-if-changed=cpp/src/projection/hatch.cpp");
+    println!("cargo:rerun-if-changed=cpp/src/projection/drawing_writer.cpp");
+    println!("cargo:rerun-if-changed=cpp/src/projection/hlr_cleanup.cpp");
 
     let target_os = env::var("CARGO_CFG_TARGET_OS").unwrap_or_default();
 
@@ -145,6 +168,9 @@ fn main() {
         // Main bridge file (legacy - being slimmed down as modules are extracted)
         .file("cpp/bridge.cpp")
         // CADHY modular C++ implementations
+        .file("cpp/src/core/mesh_cache.cpp")
+        .file("cpp/src/core/fingerprint.cpp")
+        .file("cpp/src/core/progress.cpp")
         .file("cpp/src/edit/selection.cpp")
         .file("cpp/src/edit/face_ops.cpp")
         .file("cpp/src/primitives/primitives.cpp")
@@ -154,9 +180,17 @@ fn main() {
         .file("cpp/src/sweep/sweep.cpp")
         .file("cpp/src/wire/wire.cpp")
         .file("cpp/src/mesh/mesh.cpp")
+        .file("cpp/src/mesh/vertex_weld.cpp")
+        .file("cpp/src/mesh/vertex_cache.cpp")
+        .file("cpp/src/mesh/simplify.cpp")
+        .file("cpp/src/mesh/adaptive.cpp")
+        .file("cpp/src/mesh/slice.cpp")
         .file("cpp/src/io/io.cpp")
         .file("cpp/src/analysis/analysis.cpp")
         .file("cpp/src/projection/projection.cpp")
+        .file("cpp/src/projection/hatch.cpp")
+        .file("cpp/src/projection/drawing_writer.cpp")
+        .file("cpp/src/projection/hlr_cleanup.cpp")
         // Include paths
         .include(&occt_inc)
         .include(&cpp_dir) // For legacy bridge.h
@@ -0,0 +1,175 @@
+/**
+ * @file hatch_bench.cpp
+ * @brief Micro-benchmark: scanline hatching vs. per-line edge testing
+ *
+ * Standalone (no OpenCASCADE needed). Build and run from crates/cadhy-cad:
+ *
+ *   g++ -O3 -std=c++17 -Icpp/include \
+ *       cpp/bench/hatch_bench.cpp cpp/src/projection/hatch.cpp \
+ *       -o hatch_bench
+ *   ./hatch_bench                  # 20000-segment boundary, 2000 hatch lines
+ *   ./hatch_bench 50000 5000       # custom segment and line counts
+ *
+ * The reference is the previous generate_hatch_lines_for_region from
+ * bridge.cpp (every hatch line against every edge), minus the FFI types.
+ */
+
+#include <cadhy/projection/hatch.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+using cadhy::projection::FillRule;
+using cadhy::projection::HatchOptions;
+using cadhy::projection::HatchRing;
+using cadhy::projection::HatchSegment;
+
+namespace {
+
+/// Wavy closed boundary (a gear-like outline around the origin)
+std::vector<double> make_boundary(int segments, double radius, bool clockwise) {
+    std::vector<double> points;
+    points.reserve(2 * segments);
+    for (int i = 0; i < segments; ++i) {
+        double t = 2.0 * M_PI * (clockwise ? segments - i : i) / segments;
+        double r = radius * (1.0 + 0.05 * std::sin(64.0 * t));
+        points.push_back(r * std::cos(t));
+        points.push_back(r * std::sin(t));
+    }
+    return points;
+}
+
+/// Previous bridge.cpp implementation (reference)
+void hatch_reference(const std::vector<std::pair<double, double>>& boundary,
+                     double angle_deg, double spacing,
+                     std::vector<HatchSegment>& hatch_lines,
+                     double min_x, double min_y, double max_x, double max_y) {
+    if (boundary.size() < 3 || spacing <= 0) return;
+
+    double angle_rad = angle_deg * M_PI / 180.0;
+    double cos_a = std::cos(angle_rad);
+    double sin_a = std::sin(angle_rad);
+
+    double diag = std::sqrt(std::pow(max_x - min_x, 2) + std::pow(max_y - min_y, 2));
+    double cx = (min_x + max_x) / 2.0;
+    double cy = (min_y + max_y) / 2.0;
+    int num_lines = static_cast<int>(diag / spacing) + 2;
+
+    for (int i = -num_lines; i <= num_lines; i++) {
+        double offset = i * spacing;
+        double hx = cx + offset * sin_a;
+        double hy = cy - offset * cos_a;
+
+        std::vector<double> intersections;
+        size_t n = boundary.size();
+        for (size_t j = 0; j < n; j++) {
+            size_t k = (j + 1) % n;
+            double x1 = boundary[j].first;
+            double y1 = boundary[j].second;
+            double dx = boundary[k].first - x1;
+            double dy = boundary[k].second - y1;
+
+            double denom = dx * sin_a - dy * cos_a;
+            if (std::abs(denom) < 1e-10) continue;
+
+            double t_edge = ((hx - x1) * sin_a - (hy - y1) * cos_a) / denom;
+            if (t_edge >= 0.0 && t_edge <= 1.0) {
+                double ix = x1 + t_edge * dx;
+                double iy = y1 + t_edge * dy;
+                intersections.push_back((ix - hx) * cos_a + (iy - hy) * sin_a);
+            }
+        }
+
+        std::sort(intersections.begin(), intersections.end());
+        for (size_t j = 0; j + 1 < intersections.size(); j += 2) {
+            HatchSegment line{
+                hx + intersections[j] * cos_a, hy + intersections[j] * sin_a,
+                hx + intersections[j + 1] * cos_a, hy + intersections[j + 1] * sin_a
+            };
+            if (std::hypot(line.x1 - line.x0, line.y1 - line.y0) > 1e-6) {
+                hatch_lines.push_back(line);
+            }
+        }
+    }
+}
+
+double total_length(const std::vector<HatchSegment>& segments) {
+    double length = 0.0;
+    for (const auto& s : segments) length += std::hypot(s.x1 - s.x0, s.y1 - s.y0);
+    return length;
+}
+
+template <typename F>
+double time_ms(F&& f, int repeats) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r) f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / repeats;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int segments = argc > 1 ? std::atoi(argv[1]) : 20000;
+    const int lines = argc > 2 ? std::atoi(argv[2]) : 2000;
+
+    const double radius = 100.0;
+    std::vector<double> outer = make_boundary(segments, radius, false);
+    std::vector<std::pair<double, double>> boundary;
+    double min_x = 1e300, min_y = 1e300, max_x = -1e300, max_y = -1e300;
+    for (size_t i = 0; i < outer.size(); i += 2) {
+        boundary.push_back({outer[i], outer[i + 1]});
+        min_x = std::min(min_x, outer[i]);
+        min_y = std::min(min_y, outer[i + 1]);
+        max_x = std::max(max_x, outer[i]);
+        max_y = std::max(max_y, outer[i + 1]);
+    }
+    const double spacing = std::hypot(max_x - min_x, max_y - min_y) / lines;
+
+    HatchOptions options;
+    options.angle_deg = 45.0;
+    options.spacing = spacing;
+    options.anchor_x = 0.5 * (min_x + max_x);
+    options.anchor_y = 0.5 * (min_y + max_y);
+
+    std::printf("boundary segments: %d, spacing: %.4f\n", segments, spacing);
+
+    // Single ring: reference vs scanline
+    std::vector<HatchSegment> reference, scanline;
+    double reference_ms = time_ms([&] {
+        reference.clear();
+        hatch_reference(boundary, options.angle_deg, spacing, reference, min_x, min_y, max_x, max_y);
+    }, 1);
+    double scanline_ms = time_ms([&] {
+        scanline.clear();
+        cadhy::projection::hatch_rings({HatchRing{outer.data(), outer.size() / 2}}, options, scanline);
+    }, 10);
+
+    std::printf("reference: %9.2f ms  %zu segments  length %.3f\n",
+                reference_ms, reference.size(), total_length(reference));
+    std::printf("scanline:  %9.2f ms  %zu segments  length %.3f  (%.0fx)\n",
+                scanline_ms, scanline.size(), total_length(scanline), reference_ms / scanline_ms);
+
+    // Outer ring with a clockwise hole, both rules
+    std::vector<double> hole = make_boundary(segments / 2, 0.5 * radius, true);
+    std::vector<HatchRing> rings = {HatchRing{outer.data(), outer.size() / 2},
+                                    HatchRing{hole.data(), hole.size() / 2}};
+    for (FillRule rule : {FillRule::EvenOdd, FillRule::NonZero}) {
+        options.rule = rule;
+        std::vector<HatchSegment> holed;
+        double ms = time_ms([&] {
+            holed.clear();
+            cadhy::projection::hatch_rings(rings, options, holed);
+        }, 10);
+        std::printf("with hole (%s): %6.2f ms  %zu segments  length %.3f\n",
+                    rule == FillRule::EvenOdd ? "even-odd" : "nonzero",
+                    ms, holed.size(), total_length(holed));
+    }
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file hlr_cleanup_bench.cpp
+ * @brief Micro-benchmark: HLR stroke cleanup on dense polylines
+ *
+ * Standalone (no OpenCASCADE needed). Build and run from crates/cadhy-cad:
+ *
+ *   g++ -O3 -std=c++17 -Icpp/include \
+ *       cpp/bench/hlr_cleanup_bench.cpp cpp/src/projection/hlr_cleanup.cpp \
+ *       -o hlr_cleanup_bench
+ *   ./hlr_cleanup_bench              # 1000 strokes x 1000 points
+ *   ./hlr_cleanup_bench 200 5000     # custom stroke and point counts
+ *
+ * Input mimics B-spline HLR output: wavy visible polylines, each with a
+ * hidden copy underneath, plus finely tessellated circles split into short
+ * line segments.
+ */
+
+#include <cadhy/projection/hlr_cleanup.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using cadhy::projection::HlrCleanupOptions;
+using cadhy::projection::HlrCleanupResult;
+using cadhy::projection::HlrStroke;
+
+namespace {
+
+std::vector<HlrStroke> make_strokes(int strokes, int points) {
+    std::vector<HlrStroke> out;
+    for (int c = 0; c < strokes; ++c) {
+        HlrStroke wave;
+        for (int i = 0; i < points; ++i) {
+            double x = i * 0.01;
+            wave.points.push_back(x);
+            wave.points.push_back(c * 0.5 + 0.3 * std::sin(3.0 * x + c));
+        }
+        out.push_back(wave);
+
+        if (c % 4 == 0) {
+            HlrStroke hidden = wave;
+            hidden.line_type = 1;
+            hidden.hidden = true;
+            out.push_back(hidden);
+        }
+
+        // Circle as separate two-point lines
+        if (c % 10 == 0) {
+            const double cx = -20.0, cy = c * 0.5, r = 0.2;
+            for (int i = 0; i < 256; ++i) {
+                double a0 = 2.0 * M_PI * i / 256, a1 = 2.0 * M_PI * (i + 1) / 256;
+                HlrStroke seg;
+                seg.points = {cx + r * std::cos(a0), cy + r * std::sin(a0),
+                              cx + r * std::cos(a1), cy + r * std::sin(a1)};
+                seg.line_type = 4;
+                out.push_back(seg);
+            }
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int strokes = argc > 1 ? std::atoi(argv[1]) : 1000;
+    const int points = argc > 2 ? std::atoi(argv[2]) : 1000;
+    const std::vector<HlrStroke> input = make_strokes(strokes, points);
+
+    for (int mode = 0; mode < 4; ++mode) {
+        HlrCleanupOptions options;
+        options.tolerance = 0.01;
+        options.remove_overlaps = mode & 1;
+        options.fit_arcs = mode & 2;
+
+        auto start = std::chrono::steady_clock::now();
+        HlrCleanupResult result = cadhy::projection::cleanup_hlr_strokes(input, options);
+        auto end = std::chrono::steady_clock::now();
+
+        std::printf("overlaps=%d arcs=%d: %zu -> %zu points (%zu strokes, %zu arcs) in %.1f ms\n",
+                    options.remove_overlaps, options.fit_arcs,
+                    result.input_points, result.output_points,
+                    result.strokes.size(), result.arcs.size(),
+                    std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+/**
+ * @file merge_vertices_bench.cpp
+ * @brief Micro-benchmark: vertex welding engine vs. the legacy string-key merge
+ *
+ * Standalone (no OpenCASCADE needed). Build and run from crates/cadhy-cad:
+ *
+ *   g++ -O3 -march=native -std=c++17 -pthread -Icpp/include \
+ *       cpp/bench/merge_vertices_bench.cpp cpp/src/mesh/vertex_weld.cpp \
+ *       -o merge_vertices_bench
+ *   ./merge_vertices_bench                 # 1M, 10M, 50M vertices
+ *   ./merge_vertices_bench 2000000         # custom sizes
+ *
+ * The legacy implementation is skipped above 10M vertices (its string map
+ * needs several GB); set CADHY_BENCH_LEGACY_MAX to override.
+ */
+
+#include <cadhy/mesh/vertex_weld.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using cadhy::mesh::WeldMap;
+
+namespace {
+
+/// Per-face style mesh: a jittered point lattice where ~35% of the vertices
+/// are near-duplicates (offset well below tolerance) of earlier ones
+std::vector<float> make_positions(size_t vertex_count, double tolerance) {
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    const double spacing = tolerance * 50.0;
+    const size_t side = static_cast<size_t>(std::cbrt(double(vertex_count))) + 1;
+
+    std::vector<float> positions;
+    positions.reserve(vertex_count * 3);
+    size_t lattice = 0;
+    while (positions.size() < vertex_count * 3) {
+        size_t count = positions.size() / 3;
+        if (count > 0 && unit(rng) < 0.35) {
+            size_t src = static_cast<size_t>(unit(rng) * double(count)) % count;
+            for (int a = 0; a < 3; ++a) {
+                double jitter = (unit(rng) - 0.5) * tolerance * 0.2;
+                positions.push_back(static_cast<float>(positions[src * 3 + a] + jitter));
+            }
+        } else {
+            size_t x = lattice % side;
+            size_t y = (lattice / side) % side;
+            size_t z = lattice / (side * side);
+            positions.push_back(static_cast<float>(x * spacing));
+            positions.push_back(static_cast<float>(y * spacing));
+            positions.push_back(static_cast<float>(z * spacing));
+            ++lattice;
+        }
+    }
+    return positions;
+}
+
+/// The merge_vertices() implementation this engine replaced
+size_t legacy_merge(const std::vector<float>& positions, double tolerance, std::vector<uint32_t>& remap) {
+    size_t vertex_count = positions.size() / 3;
+    remap.assign(vertex_count, 0);
+    std::unordered_map<std::string, uint32_t> vertex_map;
+
+    auto vertex_key = [tolerance](float x, float y, float z) {
+        int ix = static_cast<int>(x / tolerance);
+        int iy = static_cast<int>(y / tolerance);
+        int iz = static_cast<int>(z / tolerance);
+        return std::to_string(ix) + "_" + std::to_string(iy) + "_" + std::to_string(iz);
+    };
+
+    uint32_t new_index = 0;
+    for (size_t i = 0; i < vertex_count; ++i) {
+        std::string key = vertex_key(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]);
+        auto it = vertex_map.find(key);
+        if (it == vertex_map.end()) {
+            vertex_map[key] = new_index;
+            remap[i] = new_index++;
+        } else {
+            remap[i] = it->second;
+        }
+    }
+    return new_index;
+}
+
+template <typename Fn>
+double time_ms(Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    const double tolerance = 1e-3;
+
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; ++i) sizes.push_back(std::strtoull(argv[i], nullptr, 10));
+    if (sizes.empty()) sizes = {1000000, 10000000, 50000000};
+
+    size_t legacy_max = 10000000;
+    if (const char* env = std::getenv("CADHY_BENCH_LEGACY_MAX")) {
+        legacy_max = std::strtoull(env, nullptr, 10);
+    }
+
+    std::printf("%12s %14s %12s %12s %12s %10s\n",
+                "vertices", "impl", "time_ms", "Mvert/s", "unique", "speedup");
+
+    for (size_t n : sizes) {
+        std::vector<float> positions = make_positions(n, tolerance);
+
+        double legacy = 0.0;
+        if (n <= legacy_max) {
+            std::vector<uint32_t> remap;
+            size_t unique = 0;
+            legacy = time_ms([&]() { unique = legacy_merge(positions, tolerance, remap); });
+            std::printf("%12zu %14s %12.1f %12.2f %12zu %10s\n",
+                        n, "legacy", legacy, n / legacy / 1000.0, unique, "1.00x");
+        }
+
+        auto report = [&](const char* name, WeldMap (*fn)(const float*, size_t, double)) {
+            WeldMap weld;
+            double ms = time_ms([&]() { weld = fn(positions.data(), n, tolerance); });
+            char speedup[32] = "-";
+            if (legacy > 0.0) std::snprintf(speedup, sizeof(speedup), "%.2fx", legacy / ms);
+            std::printf("%12zu %14s %12.1f %12.2f %12zu %10s\n",
+                        n, name, ms, n / ms / 1000.0, weld.unique.size(), speedup);
+        };
+
+        report("hashed", cadhy::mesh::weld_positions_hashed);
+        report("sorted", cadhy::mesh::weld_positions_sorted);
+    }
+
+    return 0;
+}
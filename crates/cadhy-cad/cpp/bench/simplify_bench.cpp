@@ -0,0 +1,93 @@
+/**
+ * @file simplify_bench.cpp
+ * @brief Micro-benchmark: quadric-error simplification of a UV sphere
+ *
+ * Standalone (no OpenCASCADE needed). Build and run from crates/cadhy-cad:
+ *
+ *   g++ -O3 -std=c++17 -Icpp/include \
+ *       cpp/bench/simplify_bench.cpp cpp/src/mesh/simplify.cpp \
+ *       -o simplify_bench
+ *   ./simplify_bench                 # ~1M triangles
+ *   ./simplify_bench 2000            # custom ring count (2 * rings^2 * 2 triangles)
+ */
+
+#include <cadhy/mesh/simplify.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using cadhy::mesh::SimplifyOptions;
+using cadhy::mesh::SimplifyResult;
+
+namespace {
+
+/// Welded UV sphere split into 8 patches (triangle groups)
+void make_sphere(int rings, std::vector<float>& positions, std::vector<uint32_t>& indices, std::vector<uint32_t>& groups) {
+    const int segments = 2 * rings;
+    const double pi = std::acos(-1.0);
+
+    positions = {0.0f, 0.0f, 1.0f};
+    for (int i = 1; i < rings; ++i) {
+        for (int j = 0; j < segments; ++j) {
+            double theta = pi * i / rings;
+            double phi = 2.0 * pi * j / segments;
+            positions.push_back(static_cast<float>(std::sin(theta) * std::cos(phi)));
+            positions.push_back(static_cast<float>(std::sin(theta) * std::sin(phi)));
+            positions.push_back(static_cast<float>(std::cos(theta)));
+        }
+    }
+    positions.insert(positions.end(), {0.0f, 0.0f, -1.0f});
+    const uint32_t south = static_cast<uint32_t>(positions.size() / 3 - 1);
+
+    auto vertex = [&](int i, int j) { return static_cast<uint32_t>(1 + (i - 1) * segments + j % segments); };
+    auto group = [&](int i, int j) { return static_cast<uint32_t>((i < rings / 2) * 4 + j * 4 / segments); };
+
+    for (int j = 0; j < segments; ++j) {
+        indices.insert(indices.end(), {0, vertex(1, j), vertex(1, j + 1)});
+        groups.push_back(group(0, j));
+    }
+    for (int i = 1; i < rings - 1; ++i) {
+        for (int j = 0; j < segments; ++j) {
+            uint32_t a = vertex(i, j), b = vertex(i, j + 1), c = vertex(i + 1, j), d = vertex(i + 1, j + 1);
+            indices.insert(indices.end(), {a, c, d, a, d, b});
+            groups.push_back(group(i, j));
+            groups.push_back(group(i, j));
+        }
+    }
+    for (int j = 0; j < segments; ++j) {
+        indices.insert(indices.end(), {south, vertex(rings - 1, j + 1), vertex(rings - 1, j)});
+        groups.push_back(group(rings, j));
+    }
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    int rings = argc > 1 ? std::atoi(argv[1]) : 500;
+
+    std::vector<float> positions;
+    std::vector<uint32_t> indices, groups;
+    make_sphere(rings, positions, indices, groups);
+    const size_t vertex_count = positions.size() / 3;
+    const size_t triangle_count = indices.size() / 3;
+
+    std::printf("%12s %12s %12s %12s\n", "triangles", "target", "time_ms", "error");
+
+    for (double keep : {0.5, 0.1, 0.05}) {
+        SimplifyOptions options;
+        options.target_triangles = static_cast<size_t>(triangle_count * keep);
+
+        auto start = std::chrono::steady_clock::now();
+        SimplifyResult result = cadhy::mesh::simplify_mesh(
+            positions.data(), vertex_count, indices.data(), triangle_count, groups.data(), options);
+        auto end = std::chrono::steady_clock::now();
+
+        std::printf("%12zu %12zu %12.1f %12.3g\n", triangle_count, result.triangles.size(),
+                    std::chrono::duration<double, std::milli>(end - start).count(), result.error);
+    }
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file slice_bench.cpp
+ * @brief Micro-benchmark: plane sections of a welded torus mesh
+ *
+ * Standalone (no OpenCASCADE needed). Build and run from crates/cadhy-cad:
+ *
+ *   g++ -O3 -std=c++17 -Icpp/include \
+ *       cpp/bench/slice_bench.cpp cpp/src/mesh/slice.cpp \
+ *       -o slice_bench
+ *   ./slice_bench                  # ~1M triangles
+ *   ./slice_bench 2000             # custom ring count (rings^2 / 2 * 2 triangles)
+ */
+
+#include <cadhy/mesh/slice.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using cadhy::mesh::MeshSlicer;
+using cadhy::mesh::SliceLoop;
+using cadhy::mesh::SlicePlane;
+
+namespace {
+
+/// Welded torus (major radius 2, minor radius 0.5) around Z, outward winding
+void make_torus(int rings, std::vector<float>& positions, std::vector<uint32_t>& indices) {
+    const int major = rings;
+    const int minor = rings / 2;
+    const double pi = std::acos(-1.0);
+
+    for (int i = 0; i < major; ++i) {
+        double u = 2.0 * pi * i / major;
+        for (int j = 0; j < minor; ++j) {
+            double v = 2.0 * pi * j / minor;
+            double r = 2.0 + 0.5 * std::cos(v);
+            positions.push_back(static_cast<float>(r * std::cos(u)));
+            positions.push_back(static_cast<float>(r * std::sin(u)));
+            positions.push_back(static_cast<float>(0.5 * std::sin(v)));
+        }
+    }
+
+    auto vertex = [&](int i, int j) { return static_cast<uint32_t>((i % major) * minor + j % minor); };
+    for (int i = 0; i < major; ++i) {
+        for (int j = 0; j < minor; ++j) {
+            uint32_t a = vertex(i, j), b = vertex(i + 1, j), c = vertex(i + 1, j + 1), d = vertex(i, j + 1);
+            indices.insert(indices.end(), {a, b, c, a, c, d});
+        }
+    }
+}
+
+double signed_area(const SliceLoop& loop) {
+    double area = 0.0;
+    const size_t n = loop.points.size() / 2;
+    for (size_t i = 0; i < n; ++i) {
+        size_t k = (i + 1) % n;
+        area += loop.points[2 * i] * loop.points[2 * k + 1] - loop.points[2 * k] * loop.points[2 * i + 1];
+    }
+    return 0.5 * area;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    const int rings = argc > 1 ? std::atoi(argv[1]) : 1000;
+
+    std::vector<float> positions;
+    std::vector<uint32_t> indices;
+    make_torus(rings, positions, indices);
+
+    MeshSlicer slicer(positions.data(), positions.size() / 3, indices.data(), indices.size() / 3);
+    std::printf("torus: %zu vertices, %zu triangles\n", slicer.vertex_count(), slicer.triangle_count());
+
+    // Horizontal planes through the tube (two concentric loops each) and a
+    // vertical plane through the axis (two circles)
+    const SlicePlane planes[] = {
+        {{0, 0, 0.0}, {0, 0, 1}, {1, 0, 0}, {0, 1, 0}},
+        {{0, 0, 0.3}, {0, 0, 1}, {1, 0, 0}, {0, 1, 0}},
+        {{0, 0, 0.0}, {0, 1, 0}, {0, 0, 1}, {1, 0, 0}},
+    };
+
+    for (const SlicePlane& plane : planes) {
+        const int repeats = 20;
+        std::vector<SliceLoop> loops;
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; ++r) {
+            loops = slicer.slice(plane);
+        }
+        auto end = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count() / repeats;
+
+        std::printf("plane n=(%g,%g,%g) d=%g: %.2f ms, %zu loops:", plane.normal[0], plane.normal[1],
+                    plane.normal[2], plane.origin[2], ms, loops.size());
+        for (const SliceLoop& loop : loops) {
+            std::printf(" [%zu pts, %s, area %.4f]", loop.points.size() / 2,
+                        loop.closed ? "closed" : "open", signed_area(loop));
+        }
+        std::printf("\n");
+    }
+
+    return 0;
+}
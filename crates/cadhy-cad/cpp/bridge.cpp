@@ -13,9 +13,49 @@
 
 #include "include/bridge.h"
 #include "cadhy-cad/src/ffi.rs.h"
+#include "cadhy/analysis/analysis.hpp"
+#include "cadhy/boolean/boolean.hpp"
+#include "cadhy/mesh/mesh.hpp"
+#include "cadhy/projection/drawing_writer.hpp"
+#include "cadhy/projection/hatch.hpp"
+#include "cadhy/projection/hlr_cleanup.hpp"
+#include "cadhy/projection/projection.hpp"
 
 namespace cadhy_cad {
 
+// ============================================================
+// PROGRESS & CANCELLATION
+// ============================================================
+
+std::unique_ptr<OperationProgress> progress_new() {
+    return std::make_unique<OperationProgress>();
+}
+
+void progress_cancel(const OperationProgress& progress) {
+    progress.cancel();
+}
+
+void progress_set_timeout(const OperationProgress& progress, double seconds) {
+    progress.set_timeout(seconds);
+}
+
+double progress_fraction(const OperationProgress& progress) {
+    return progress.fraction();
+}
+
+rust::String progress_stage(const OperationProgress& progress) {
+    return rust::String(progress.stage());
+}
+
+bool progress_is_cancelled(const OperationProgress& progress) {
+    return progress.is_cancelled();
+}
+
+bool progress_timed_out(const OperationProgress& progress) {
+    // should_stop() notices a deadline nobody has polled yet
+    return progress.should_stop() && progress.timed_out();
+}
+
 // ============================================================
 // PRIMITIVE CREATION
 // ============================================================
@@ -475,21 +515,45 @@ std::unique_ptr<OcctShape> combine_shapes(rust::Slice<const OcctShape* const> sh
 // BOOLEAN OPERATIONS
 // ============================================================
 
+// Fuse, cut and common go through the boolean pre-flight: disjoint and
+// nested pairs are answered without a boolean, and a full boolean keeps the
+// arguments' cached triangulations on faces it leaves untouched.
+// The result is unified with UnifyEdges=false (merging edges breaks closed
+// curves on cones and cylinders) and UnifyFaces=true. The boolean itself runs
+// with OCCT's defaults, as the plain BRepAlgoAPI calls these replaced did.
+static std::unique_ptr<OcctShape> preflighted_boolean(
+    const OcctShape& shape1,
+    const OcctShape& shape2,
+    cadhy::boolean::BooleanOperation operation,
+    cadhy::boolean::BooleanPreflight* report = nullptr,
+    cadhy::boolean::BooleanProvenance* provenance = nullptr,
+    const Message_ProgressRange& range = Message_ProgressRange()
+) {
+    cadhy::boolean::BooleanOptions options;
+    options.fuzzy_tolerance = 0.0;
+    options.parallel = false;
+    options.use_obb = false;
+    options.check_inverted = false;
+    options.fail_on_errors = false;
+    return cadhy::boolean::boolean_with_preflight(
+        shape1, shape2, operation, options, report, provenance, range);
+}
+
+static void copy_sub_shape_map(const cadhy::boolean::SubShapeMap& map, SubShapeMapFFI& out) {
+    out.fates.clear();
+    out.offsets.clear();
+    out.targets.clear();
+    out.fates.reserve(map.fates.size());
+    out.offsets.reserve(map.offsets.size());
+    out.targets.reserve(map.targets.size());
+    for (cadhy::boolean::ShapeFate fate : map.fates) out.fates.push_back(static_cast<uint8_t>(fate));
+    for (uint32_t offset : map.offsets) out.offsets.push_back(offset);
+    for (uint32_t target : map.targets) out.targets.push_back(target);
+}
+
 std::unique_ptr<OcctShape> boolean_fuse(const OcctShape& shape1, const OcctShape& shape2) {
     try {
-        BRepAlgoAPI_Fuse fuse(shape1.get(), shape2.get());
-        fuse.Build();
-        if (!fuse.IsDone()) return nullptr;
-
-        // CRITICAL: Apply ShapeUpgrade_UnifySameDomain after boolean operations
-        // This removes internal seam edges and unifies coplanar faces.
-        // Parameters: (shape, UnifyEdges=false, UnifyFaces=true, ConcatBSplines=false)
-        // UnifyEdges=false avoids issues with closed curves (cones, cylinders)
-        // UnifyFaces=true merges coplanar faces created at the boolean intersection
-        ShapeUpgrade_UnifySameDomain unifier(fuse.Shape(), Standard_False, Standard_True, Standard_False);
-        unifier.Build();
-
-        return std::make_unique<OcctShape>(unifier.Shape());
+        return preflighted_boolean(shape1, shape2, cadhy::boolean::BooleanOperation::Fuse);
     } catch (const Standard_Failure& e) {
         std::cerr << "boolean_fuse exception: " << e.GetMessageString() << std::endl;
         return nullptr;
@@ -501,16 +565,7 @@ std::unique_ptr<OcctShape> boolean_fuse(const OcctShape& shape1, const OcctShape
 
 std::unique_ptr<OcctShape> boolean_cut(const OcctShape& shape1, const OcctShape& shape2) {
     try {
-        BRepAlgoAPI_Cut cut(shape1.get(), shape2.get());
-        cut.Build();
-        if (!cut.IsDone()) return nullptr;
-
-        // Apply ShapeUpgrade_UnifySameDomain to clean up boolean result
-        // UnifyEdges=false, UnifyFaces=true, ConcatBSplines=false
-        ShapeUpgrade_UnifySameDomain unifier(cut.Shape(), Standard_False, Standard_True, Standard_False);
-        unifier.Build();
-
-        return std::make_unique<OcctShape>(unifier.Shape());
+        return preflighted_boolean(shape1, shape2, cadhy::boolean::BooleanOperation::Cut);
     } catch (const Standard_Failure& e) {
         std::cerr << "boolean_cut exception: " << e.GetMessageString() << std::endl;
         return nullptr;
@@ -522,16 +577,7 @@ std::unique_ptr<OcctShape> boolean_cut(const OcctShape& shape1, const OcctShape&
 
 std::unique_ptr<OcctShape> boolean_common(const OcctShape& shape1, const OcctShape& shape2) {
     try {
-        BRepAlgoAPI_Common common(shape1.get(), shape2.get());
-        common.Build();
-        if (!common.IsDone()) return nullptr;
-
-        // Apply ShapeUpgrade_UnifySameDomain to clean up boolean result
-        // UnifyEdges=false, UnifyFaces=true, ConcatBSplines=false
-        ShapeUpgrade_UnifySameDomain unifier(common.Shape(), Standard_False, Standard_True, Standard_False);
-        unifier.Build();
-
-        return std::make_unique<OcctShape>(unifier.Shape());
+        return preflighted_boolean(shape1, shape2, cadhy::boolean::BooleanOperation::Common);
     } catch (const Standard_Failure& e) {
         std::cerr << "boolean_common exception: " << e.GetMessageString() << std::endl;
         return nullptr;
@@ -541,10 +587,182 @@ std::unique_ptr<OcctShape> boolean_common(const OcctShape& shape1, const OcctSha
     }
 }
 
+int32_t boolean_classify(const OcctShape& shape1, const OcctShape& shape2) {
+    try {
+        return static_cast<int32_t>(cadhy::boolean::classify_boolean(shape1, shape2));
+    } catch (const Standard_Failure& e) {
+        std::cerr << "boolean_classify exception: " << e.GetMessageString() << std::endl;
+        return 0;
+    } catch (...) {
+        std::cerr << "boolean_classify: unknown exception" << std::endl;
+        return 0;
+    }
+}
+
+std::unique_ptr<OcctShape> boolean_with_report(
+    const OcctShape& shape1,
+    const OcctShape& shape2,
+    int32_t operation,
+    BooleanPreflightReport& report
+) {
+    try {
+        if (operation < 0 || operation > 2) return nullptr;
+
+        cadhy::boolean::BooleanPreflight preflight;
+        auto result = preflighted_boolean(
+            shape1, shape2, static_cast<cadhy::boolean::BooleanOperation>(operation), &preflight);
+        report.path = static_cast<int32_t>(preflight.path);
+        report.passthrough = static_cast<uint32_t>(preflight.passthrough);
+        return result;
+    } catch (const Standard_Failure& e) {
+        std::cerr << "boolean_with_report exception: " << e.GetMessageString() << std::endl;
+        return nullptr;
+    } catch (...) {
+        std::cerr << "boolean_with_report: unknown exception" << std::endl;
+        return nullptr;
+    }
+}
+
+std::unique_ptr<OcctShape> boolean_with_history(
+    const OcctShape& shape1,
+    const OcctShape& shape2,
+    int32_t operation,
+    BooleanHistoryFFI& history
+) {
+    try {
+        if (operation < 0 || operation > 2) return nullptr;
+
+        cadhy::boolean::BooleanPreflight preflight;
+        cadhy::boolean::BooleanProvenance provenance;
+        auto result = preflighted_boolean(
+            shape1, shape2, static_cast<cadhy::boolean::BooleanOperation>(operation),
+            &preflight, &provenance);
+        if (!result) return nullptr;
+
+        history.path = static_cast<int32_t>(preflight.path);
+        history.result_faces = static_cast<uint32_t>(provenance.result_faces);
+        history.result_edges = static_cast<uint32_t>(provenance.result_edges);
+        copy_sub_shape_map(provenance.argument_faces, history.argument_faces);
+        copy_sub_shape_map(provenance.argument_edges, history.argument_edges);
+        copy_sub_shape_map(provenance.tool_faces, history.tool_faces);
+        copy_sub_shape_map(provenance.tool_edges, history.tool_edges);
+        return result;
+    } catch (const Standard_Failure& e) {
+        std::cerr << "boolean_with_history exception: " << e.GetMessageString() << std::endl;
+        return nullptr;
+    } catch (...) {
+        std::cerr << "boolean_with_history: unknown exception" << std::endl;
+        return nullptr;
+    }
+}
+
+std::unique_ptr<OcctShape> boolean_with_progress(
+    const OcctShape& shape1,
+    const OcctShape& shape2,
+    int32_t operation,
+    const OperationProgress& progress
+) {
+    try {
+        if (operation < 0 || operation > 2 || progress.should_stop()) return nullptr;
+
+        return preflighted_boolean(
+            shape1, shape2, static_cast<cadhy::boolean::BooleanOperation>(operation),
+            nullptr, nullptr, progress.start("Boolean operation"));
+    } catch (const Standard_Failure& e) {
+        std::cerr << "boolean_with_progress exception: " << e.GetMessageString() << std::endl;
+        return nullptr;
+    } catch (...) {
+        std::cerr << "boolean_with_progress: unknown exception" << std::endl;
+        return nullptr;
+    }
+}
+
+static cadhy::boolean::BooleanOptions to_boolean_options(const BooleanOptionsFFI& options) {
+    cadhy::boolean::BooleanOptions result;
+    result.fuzzy_tolerance = options.fuzzy_tolerance;
+    result.parallel = options.parallel;
+    result.use_obb = options.use_obb;
+    result.check_inverted = options.check_inverted;
+    result.non_destructive = options.non_destructive;
+    result.glue = options.glue;
+    return result;
+}
+
+std::unique_ptr<OcctShape> boolean_batch(
+    rust::Slice<const OcctShape* const> arguments,
+    rust::Slice<const OcctShape* const> tools,
+    int32_t operation,
+    const BooleanOptionsFFI& options
+) {
+    try {
+        if (operation < 0 || operation > 2) return nullptr;
+
+        std::vector<const OcctShape*> argumentList(arguments.begin(), arguments.end());
+        std::vector<const OcctShape*> toolList(tools.begin(), tools.end());
+
+        return cadhy::boolean::boolean_batch(
+            argumentList, toolList,
+            static_cast<cadhy::boolean::BooleanOperation>(operation),
+            to_boolean_options(options));
+    } catch (const Standard_Failure& e) {
+        std::cerr << "boolean_batch exception: " << e.GetMessageString() << std::endl;
+        return nullptr;
+    } catch (...) {
+        std::cerr << "boolean_batch: unknown exception" << std::endl;
+        return nullptr;
+    }
+}
+
+std::unique_ptr<OcctShape> boolean_fuse_many(
+    rust::Slice<const OcctShape* const> shapes,
+    const BooleanOptionsFFI& options,
+    FuseTreeStats& stats
+) {
+    try {
+        std::vector<const OcctShape*> shapeList(shapes.begin(), shapes.end());
+        cadhy::boolean::FuseTreeStats treeStats;
+        auto result = cadhy::boolean::fuse_many(shapeList, to_boolean_options(options), &treeStats);
+
+        stats.inputs = static_cast<uint32_t>(treeStats.inputs);
+        stats.levels.clear();
+        for (const auto& level : treeStats.levels) {
+            FuseLevelStats levelStats;
+            levelStats.nodes = static_cast<uint32_t>(level.nodes);
+            levelStats.booleans = static_cast<uint32_t>(level.booleans);
+            levelStats.passthrough = static_cast<uint32_t>(level.passthrough);
+            levelStats.seconds = level.seconds;
+            stats.levels.push_back(levelStats);
+        }
+        stats.bounds_seconds = treeStats.bounds_seconds;
+        stats.unify_seconds = treeStats.unify_seconds;
+        stats.total_seconds = treeStats.total_seconds;
+        return result;
+    } catch (const Standard_Failure& e) {
+        std::cerr << "boolean_fuse_many exception: " << e.GetMessageString() << std::endl;
+        return nullptr;
+    } catch (...) {
+        std::cerr << "boolean_fuse_many: unknown exception" << std::endl;
+        return nullptr;
+    }
+}
+
 // ============================================================
 // MODIFICATION OPERATIONS
 // ============================================================
 
+// Fillet/chamfer result whose untouched faces keep the source's cached
+// triangulations, so re-tessellation only meshes new or modified faces
+template <typename Maker>
+static std::unique_ptr<OcctShape> make_modified_result(const OcctShape& source, Maker& maker) {
+    TopTools_ListOfShape arguments;
+    arguments.Append(source.get());
+    Handle(BRepTools_History) history = new BRepTools_History(arguments, maker);
+
+    auto result = std::make_unique<OcctShape>(maker.Shape());
+    result->mesh_cache().inherit(source.get(), source.mesh_cache(), history);
+    return result;
+}
+
 std::unique_ptr<OcctShape> fillet_all_edges(const OcctShape& shape, double radius) {
     try {
         BRepFilletAPI_MakeFillet fillet(shape.get());
@@ -555,7 +773,7 @@ std::unique_ptr<OcctShape> fillet_all_edges(const OcctShape& shape, double radiu
         }
         fillet.Build();
         if (!fillet.IsDone()) return nullptr;
-        return std::make_unique<OcctShape>(fillet.Shape());
+        return make_modified_result(shape, fillet);
     } catch (...) {
         return nullptr;
     }
@@ -571,7 +789,7 @@ std::unique_ptr<OcctShape> chamfer_all_edges(const OcctShape& shape, double dist
         }
         chamfer.Build();
         if (!chamfer.IsDone()) return nullptr;
-        return std::make_unique<OcctShape>(chamfer.Shape());
+        return make_modified_result(shape, chamfer);
     } catch (...) {
         return nullptr;
     }
@@ -645,7 +863,7 @@ std::unique_ptr<OcctShape> fillet_edges(
             return nullptr;
         }
 
-        return std::make_unique<OcctShape>(fillet.Shape());
+        return make_modified_result(shape, fillet);
     } catch (const Standard_Failure& e) {
         std::cerr << "fillet_edges exception: " << e.GetMessageString() << std::endl;
         return nullptr;
@@ -692,7 +910,7 @@ std::unique_ptr<OcctShape> chamfer_edges(
             return nullptr;
         }
 
-        return std::make_unique<OcctShape>(chamfer.Shape());
+        return make_modified_result(shape, chamfer);
     } catch (const Standard_Failure& e) {
         std::cerr << "chamfer_edges exception: " << e.GetMessageString() << std::endl;
         return nullptr;
@@ -702,11 +920,12 @@ std::unique_ptr<OcctShape> chamfer_edges(
     }
 }
 
-std::unique_ptr<OcctShape> fillet_edges_advanced(
+static std::unique_ptr<OcctShape> fillet_with_continuity(
     const OcctShape& shape,
     rust::Slice<const int32_t> edge_indices,
     rust::Slice<const double> radii,
-    int32_t continuity
+    int32_t continuity,
+    const Message_ProgressRange& range
 ) {
     try {
         if (edge_indices.size() != radii.size()) {
@@ -737,15 +956,35 @@ std::unique_ptr<OcctShape> fillet_edges_advanced(
             }
         }
 
-        fillet.Build();
+        fillet.Build(range);
         if (!fillet.IsDone()) return nullptr;
 
-        return std::make_unique<OcctShape>(fillet.Shape());
+        return make_modified_result(shape, fillet);
     } catch (...) {
         return nullptr;
     }
 }
 
+std::unique_ptr<OcctShape> fillet_edges_advanced(
+    const OcctShape& shape,
+    rust::Slice<const int32_t> edge_indices,
+    rust::Slice<const double> radii,
+    int32_t continuity
+) {
+    return fillet_with_continuity(shape, edge_indices, radii, continuity, Message_ProgressRange());
+}
+
+std::unique_ptr<OcctShape> fillet_edges_advanced_with_progress(
+    const OcctShape& shape,
+    rust::Slice<const int32_t> edge_indices,
+    rust::Slice<const double> radii,
+    int32_t continuity,
+    const OperationProgress& progress
+) {
+    if (progress.should_stop()) return nullptr;
+    return fillet_with_continuity(shape, edge_indices, radii, continuity, progress.start("Fillet"));
+}
+
 std::unique_ptr<OcctShape> chamfer_edges_two_distances(
     const OcctShape& shape,
     rust::Slice<const int32_t> edge_indices,
@@ -780,7 +1019,7 @@ std::unique_ptr<OcctShape> chamfer_edges_two_distances(
         chamfer.Build();
         if (!chamfer.IsDone()) return nullptr;
 
-        return std::make_unique<OcctShape>(chamfer.Shape());
+        return make_modified_result(shape, chamfer);
     } catch (...) {
         return nullptr;
     }
@@ -820,7 +1059,7 @@ std::unique_ptr<OcctShape> chamfer_edges_distance_angle(
         chamfer.Build();
         if (!chamfer.IsDone()) return nullptr;
 
-        return std::make_unique<OcctShape>(chamfer.Shape());
+        return make_modified_result(shape, chamfer);
     } catch (...) {
         return nullptr;
     }
@@ -1582,178 +1821,306 @@ std::unique_ptr<OcctShape> make_bezier(
 // TESSELLATION
 // ============================================================
 
-MeshResult tessellate(const OcctShape& shape, double deflection) {
-    MeshResult result;
-    result.vertices = rust::Vec<Vertex>();
-    result.normals = rust::Vec<Vertex>();
-    result.triangles = rust::Vec<Triangle>();
-    result.face_ids = rust::Vec<uint32_t>();
-    result.faces = rust::Vec<FaceInfo>();
+// Per-face slot for triangulation extraction. Node/triangle offsets are fixed
+// serially up front so that every face writes a disjoint range of the output.
+struct FaceExtractSlot {
+    TopoDS_Face face;
+    Handle(Poly_Triangulation) triangulation;
+    gp_Trsf transform;
+    uint32_t face_index = 0;
+    size_t node_offset = 0;
+    size_t triangle_offset = 0;
+
+    // Filled by the worker
+    int32_t surface_type = 7;
+    double normal_x = 0.0, normal_y = 0.0, normal_z = 0.0;
+    double area = 0.0;
+    int32_t num_edges = 0;
+    const char* label = "";
+    bool ok = false;
+};
 
-    try {
-        BRepMesh_IncrementalMesh mesh(shape.get(), deflection);
-        mesh.Perform();
-        if (!mesh.IsDone()) return result;
+// Below this many faces the thread dispatch costs more than it saves
+static const size_t PARALLEL_EXTRACT_MIN_FACES = 64;
 
-        // Compute shape bounding box for inlet/outlet cap detection
-        Bnd_Box shapeBox;
-        BRepBndLib::Add(shape.get(), shapeBox);
-        double xmin, ymin, zmin, xmax, ymax, zmax;
-        shapeBox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
-        double shapeZLength = zmax - zmin;
-        double capTolerance = std::max(0.01, shapeZLength * 0.001); // 0.1% of length or 1cm
+// Index the triangulated faces of `shape` in TopExp_Explorer order and assign
+// each one its node/triangle offset in the concatenated output.
+static void index_triangulated_faces(
+    const TopoDS_Shape& shape,
+    std::vector<FaceExtractSlot>& slots,
+    size_t& totalNodes,
+    size_t& totalTriangles
+) {
+    totalNodes = 0;
+    totalTriangles = 0;
+    uint32_t faceIndex = 0;
+    for (TopExp_Explorer faceExplorer(shape, TopAbs_FACE); faceExplorer.More(); faceExplorer.Next(), faceIndex++) {
+        const TopoDS_Face& face = TopoDS::Face(faceExplorer.Current());
+        TopLoc_Location location;
+        Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, location);
+        if (triangulation.IsNull()) continue;
 
-        size_t vertexOffset = 0;
-        uint32_t faceIndex = 0;
-        TopExp_Explorer faceExplorer(shape.get(), TopAbs_FACE);
+        FaceExtractSlot slot;
+        slot.face = face;
+        slot.triangulation = triangulation;
+        slot.transform = location.Transformation();
+        slot.face_index = faceIndex;
+        slot.node_offset = totalNodes;
+        slot.triangle_offset = totalTriangles;
+        totalNodes += triangulation->NbNodes();
+        totalTriangles += triangulation->NbTriangles();
+        slots.push_back(slot);
+    }
+}
 
-        for (; faceExplorer.More(); faceExplorer.Next(), faceIndex++) {
-            const TopoDS_Face& face = TopoDS::Face(faceExplorer.Current());
-            TopLoc_Location location;
-            Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, location);
-            if (triangulation.IsNull()) continue;
+// Classify the face: surface type, center normal, area, edge count and label
+static void classify_face_slot(
+    FaceExtractSlot& slot,
+    double zmin, double zmax, double capTolerance
+) {
+    const TopoDS_Face& face = slot.face;
+    bool reversed = (face.Orientation() == TopAbs_REVERSED);
+
+    // Get surface type and properties
+    BRepAdaptor_Surface surfAdaptor(face);
+    GeomAbs_SurfaceType surfType = surfAdaptor.GetType();
+    switch (surfType) {
+        case GeomAbs_Plane: slot.surface_type = 0; break;
+        case GeomAbs_Cylinder: slot.surface_type = 1; break;
+        case GeomAbs_Cone: slot.surface_type = 2; break;
+        case GeomAbs_Sphere: slot.surface_type = 3; break;
+        case GeomAbs_Torus: slot.surface_type = 4; break;
+        case GeomAbs_BezierSurface: slot.surface_type = 5; break;
+        case GeomAbs_BSplineSurface: slot.surface_type = 6; break;
+        default: slot.surface_type = 7; break;
+    }
 
-            gp_Trsf transform = location.Transformation();
+    // Get face normal at center (UV midpoint)
+    double uMid = (surfAdaptor.FirstUParameter() + surfAdaptor.LastUParameter()) / 2.0;
+    double vMid = (surfAdaptor.FirstVParameter() + surfAdaptor.LastVParameter()) / 2.0;
+    gp_Pnt centerPnt;
+    gp_Vec du, dv;
+    surfAdaptor.D1(uMid, vMid, centerPnt, du, dv);
+    gp_Vec faceNormal = du.Crossed(dv);
+    if (faceNormal.Magnitude() > 1e-10) {
+        faceNormal.Normalize();
+        if (reversed) faceNormal.Reverse();
+    }
+    slot.normal_x = faceNormal.X();
+    slot.normal_y = faceNormal.Y();
+    slot.normal_z = faceNormal.Z();
 
-            // Collect face info
-            FaceInfo faceInfo;
-            faceInfo.index = faceIndex;
-            faceInfo.is_reversed = (face.Orientation() == TopAbs_REVERSED);
+    // Calculate face area
+    GProp_GProps props;
+    BRepGProp::SurfaceProperties(face, props);
+    slot.area = props.Mass();
 
-            // Get surface type and properties
-            BRepAdaptor_Surface surfAdaptor(face);
-            GeomAbs_SurfaceType surfType = surfAdaptor.GetType();
-            switch (surfType) {
-                case GeomAbs_Plane: faceInfo.surface_type = 0; break;
-                case GeomAbs_Cylinder: faceInfo.surface_type = 1; break;
-                case GeomAbs_Cone: faceInfo.surface_type = 2; break;
-                case GeomAbs_Sphere: faceInfo.surface_type = 3; break;
-                case GeomAbs_Torus: faceInfo.surface_type = 4; break;
-                case GeomAbs_BezierSurface: faceInfo.surface_type = 5; break;
-                case GeomAbs_BSplineSurface: faceInfo.surface_type = 6; break;
-                default: faceInfo.surface_type = 7; break;
+    // Count edges of this face
+    int edgeCount = 0;
+    for (TopExp_Explorer edgeExp(face, TopAbs_EDGE); edgeExp.More(); edgeExp.Next()) {
+        edgeCount++;
+    }
+    slot.num_edges = edgeCount;
+
+    // Get face center of mass for position-based labeling
+    gp_Pnt faceCenter = props.CentreOfMass();
+
+    // Determine semantic label based on normal direction, surface type, and position
+    if (surfType == GeomAbs_Plane) {
+        // For planar faces, label based on normal direction
+        double nx = std::abs(slot.normal_x);
+        double ny = std::abs(slot.normal_y);
+        double nz = std::abs(slot.normal_z);
+        double tolerance = 0.9; // ~25 degrees tolerance
+
+        if (nz > tolerance) {
+            // Face normal predominantly in Z direction
+            // Check if this is an inlet/outlet cap (at Z bounds of shape)
+            if (std::abs(faceCenter.Z() - zmin) < capTolerance) {
+                // Face at minimum Z = inlet cap (upstream)
+                slot.label = "inlet_cap";
+            } else if (std::abs(faceCenter.Z() - zmax) < capTolerance) {
+                // Face at maximum Z = outlet cap (downstream)
+                slot.label = "outlet_cap";
+            } else {
+                // Regular top/bottom face
+                slot.label = slot.normal_z > 0 ? "top" : "bottom";
             }
+        } else if (ny > tolerance) {
+            slot.label = slot.normal_y > 0 ? "back" : "front";
+        } else if (nx > tolerance) {
+            slot.label = slot.normal_x > 0 ? "right" : "left";
+        } else {
+            slot.label = "side";
+        }
+    } else if (surfType == GeomAbs_Cylinder || surfType == GeomAbs_Cone) {
+        slot.label = "curved_side";
+    } else if (surfType == GeomAbs_Sphere) {
+        slot.label = "spherical";
+    } else if (surfType == GeomAbs_Torus) {
+        slot.label = "toroidal";
+    } else {
+        slot.label = "freeform";
+    }
+}
 
-            // Get face normal at center (UV midpoint)
-            double uMid = (surfAdaptor.FirstUParameter() + surfAdaptor.LastUParameter()) / 2.0;
-            double vMid = (surfAdaptor.FirstVParameter() + surfAdaptor.LastVParameter()) / 2.0;
-            gp_Pnt centerPnt;
-            gp_Vec du, dv;
-            surfAdaptor.D1(uMid, vMid, centerPnt, du, dv);
-            gp_Vec faceNormal = du.Crossed(dv);
-            if (faceNormal.Magnitude() > 1e-10) {
-                faceNormal.Normalize();
-                if (faceInfo.is_reversed) faceNormal.Reverse();
+// Classify the face and copy its nodes, normals and triangles into the
+// preallocated buffers at the slot offsets.
+static void extract_face_slot(
+    FaceExtractSlot& slot,
+    double zmin, double zmax, double capTolerance,
+    std::vector<Vertex>& vertices,
+    std::vector<Vertex>& normals,
+    std::vector<Triangle>& triangles
+) {
+    classify_face_slot(slot, zmin, zmax, capTolerance);
+
+    const Handle(Poly_Triangulation)& triangulation = slot.triangulation;
+    bool reversed = (slot.face.Orientation() == TopAbs_REVERSED);
+
+    // Process vertices
+    const int nbNodes = triangulation->NbNodes();
+    const bool hasNormals = triangulation->HasNormals();
+    for (int i = 1; i <= nbNodes; i++) {
+        gp_Pnt point = triangulation->Node(i).Transformed(slot.transform);
+        Vertex& v = vertices[slot.node_offset + i - 1];
+        v.x = point.X();
+        v.y = point.Y();
+        v.z = point.Z();
+
+        Vertex& n = normals[slot.node_offset + i - 1];
+        if (hasNormals) {
+            gp_Vec normalVec = triangulation->Normal(i);
+            double len = normalVec.Magnitude();
+            if (len > 1e-10) {
+                n.x = normalVec.X() / len;
+                n.y = normalVec.Y() / len;
+                n.z = normalVec.Z() / len;
+            } else {
+                n.x = 0.0; n.y = 0.0; n.z = 1.0;
             }
-            faceInfo.normal_x = faceNormal.X();
-            faceInfo.normal_y = faceNormal.Y();
-            faceInfo.normal_z = faceNormal.Z();
-
-            // Calculate face area
-            GProp_GProps props;
-            BRepGProp::SurfaceProperties(face, props);
-            faceInfo.area = props.Mass();
+        } else {
+            n.x = 0.0; n.y = 0.0; n.z = 1.0;
+        }
+    }
 
-            // Count edges of this face
-            int edgeCount = 0;
-            for (TopExp_Explorer edgeExp(face, TopAbs_EDGE); edgeExp.More(); edgeExp.Next()) {
-                edgeCount++;
-            }
-            faceInfo.num_edges = edgeCount;
+    // Process triangles (winding flipped for reversed faces)
+    const int nbTriangles = triangulation->NbTriangles();
+    for (int i = 1; i <= nbTriangles; i++) {
+        const Poly_Triangle& tri = triangulation->Triangle(i);
+        Standard_Integer n1, n2, n3;
+        tri.Get(n1, n2, n3);
+
+        Triangle& t = triangles[slot.triangle_offset + i - 1];
+        t.v1 = static_cast<uint32_t>(slot.node_offset + n1 - 1);
+        if (reversed) {
+            t.v2 = static_cast<uint32_t>(slot.node_offset + n3 - 1);
+            t.v3 = static_cast<uint32_t>(slot.node_offset + n2 - 1);
+        } else {
+            t.v2 = static_cast<uint32_t>(slot.node_offset + n2 - 1);
+            t.v3 = static_cast<uint32_t>(slot.node_offset + n3 - 1);
+        }
+    }
 
-            // Get face center of mass for position-based labeling
-            gp_Pnt faceCenter = props.CentreOfMass();
-
-            // Determine semantic label based on normal direction, surface type, and position
-            rust::String label;
-            if (surfType == GeomAbs_Plane) {
-                // For planar faces, label based on normal direction
-                double nx = std::abs(faceInfo.normal_x);
-                double ny = std::abs(faceInfo.normal_y);
-                double nz = std::abs(faceInfo.normal_z);
-                double tolerance = 0.9; // ~25 degrees tolerance
-
-                if (nz > tolerance) {
-                    // Face normal predominantly in Z direction
-                    // Check if this is an inlet/outlet cap (at Z bounds of shape)
-                    if (std::abs(faceCenter.Z() - zmin) < capTolerance) {
-                        // Face at minimum Z = inlet cap (upstream)
-                        label = "inlet_cap";
-                    } else if (std::abs(faceCenter.Z() - zmax) < capTolerance) {
-                        // Face at maximum Z = outlet cap (downstream)
-                        label = "outlet_cap";
-                    } else {
-                        // Regular top/bottom face
-                        label = faceInfo.normal_z > 0 ? "top" : "bottom";
-                    }
-                } else if (ny > tolerance) {
-                    label = faceInfo.normal_y > 0 ? "back" : "front";
-                } else if (nx > tolerance) {
-                    label = faceInfo.normal_x > 0 ? "right" : "left";
-                } else {
-                    label = "side";
-                }
-            } else if (surfType == GeomAbs_Cylinder || surfType == GeomAbs_Cone) {
-                label = "curved_side";
-            } else if (surfType == GeomAbs_Sphere) {
-                label = "spherical";
-            } else if (surfType == GeomAbs_Torus) {
-                label = "toroidal";
-            } else {
-                label = "freeform";
-            }
-            faceInfo.label = label;
+    slot.ok = true;
+}
 
-            result.faces.push_back(faceInfo);
+// FaceInfo for a classified slot
+static FaceInfo face_info_from_slot(const FaceExtractSlot& slot) {
+    FaceInfo faceInfo;
+    faceInfo.index = slot.face_index;
+    faceInfo.surface_type = slot.surface_type;
+    faceInfo.normal_x = slot.normal_x;
+    faceInfo.normal_y = slot.normal_y;
+    faceInfo.normal_z = slot.normal_z;
+    faceInfo.is_reversed = (slot.face.Orientation() == TopAbs_REVERSED);
+    faceInfo.area = slot.area;
+    faceInfo.num_edges = slot.num_edges;
+    faceInfo.label = rust::String(slot.label);
+    return faceInfo;
+}
 
-            // Process vertices
-            for (int i = 1; i <= triangulation->NbNodes(); i++) {
-                gp_Pnt point = triangulation->Node(i).Transformed(transform);
-                Vertex v;
-                v.x = point.X();
-                v.y = point.Y();
-                v.z = point.Z();
-                result.vertices.push_back(v);
-
-                Vertex n;
-                if (triangulation->HasNormals()) {
-                    gp_Vec normalVec = triangulation->Normal(i);
-                    double len = normalVec.Magnitude();
-                    if (len > 1e-10) {
-                        n.x = normalVec.X() / len;
-                        n.y = normalVec.Y() / len;
-                        n.z = normalVec.Z() / len;
-                    } else {
-                        n.x = 0.0; n.y = 0.0; n.z = 1.0;
-                    }
-                } else {
-                    n.x = 0.0; n.y = 0.0; n.z = 1.0;
-                }
-                result.normals.push_back(n);
-            }
+// Shape Z extent and tolerance used for inlet/outlet cap labeling
+static void compute_cap_bounds(const TopoDS_Shape& shape, double& zmin, double& zmax, double& capTolerance) {
+    Bnd_Box shapeBox;
+    BRepBndLib::Add(shape, shapeBox);
+    double xmin, ymin, xmax, ymax;
+    shapeBox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+    double shapeZLength = zmax - zmin;
+    capTolerance = std::max(0.01, shapeZLength * 0.001); // 0.1% of length or 1cm
+}
 
-            // Process triangles with face tracking
-            bool reversed = (face.Orientation() == TopAbs_REVERSED);
-            for (int i = 1; i <= triangulation->NbTriangles(); i++) {
-                const Poly_Triangle& tri = triangulation->Triangle(i);
-                Standard_Integer n1, n2, n3;
-                tri.Get(n1, n2, n3);
-
-                Triangle t;
-                if (reversed) {
-                    t.v1 = static_cast<uint32_t>(vertexOffset + n1 - 1);
-                    t.v2 = static_cast<uint32_t>(vertexOffset + n3 - 1);
-                    t.v3 = static_cast<uint32_t>(vertexOffset + n2 - 1);
-                } else {
-                    t.v1 = static_cast<uint32_t>(vertexOffset + n1 - 1);
-                    t.v2 = static_cast<uint32_t>(vertexOffset + n2 - 1);
-                    t.v3 = static_cast<uint32_t>(vertexOffset + n3 - 1);
-                }
-                result.triangles.push_back(t);
-                result.face_ids.push_back(faceIndex);
-            }
-            vertexOffset += triangulation->NbNodes();
+// Convert the triangulation already stored on `shape` into a MeshResult.
+//
+// Faces are indexed once in TopExp_Explorer order, per-face node/triangle
+// counts are prefix-summed, and the per-face work (surface analysis, labeling,
+// node transform) runs concurrently into preallocated buffers. The result is
+// identical to a serial walk: faces without triangulation keep their index but
+// emit nothing, and a face that throws truncates the output at that face.
+static void extract_triangulation(const TopoDS_Shape& shape, MeshResult& result) {
+    double zmin, zmax, capTolerance;
+    compute_cap_bounds(shape, zmin, zmax, capTolerance);
+
+    // Index faces and lay out output ranges
+    std::vector<FaceExtractSlot> slots;
+    size_t totalNodes = 0;
+    size_t totalTriangles = 0;
+    index_triangulated_faces(shape, slots, totalNodes, totalTriangles);
+
+    std::vector<Vertex> vertices(totalNodes);
+    std::vector<Vertex> normals(totalNodes);
+    std::vector<Triangle> triangles(totalTriangles);
+
+    OSD_Parallel::For(0, static_cast<int>(slots.size()), [&](int i) {
+        try {
+            extract_face_slot(slots[i], zmin, zmax, capTolerance, vertices, normals, triangles);
+        } catch (...) {
+            slots[i].ok = false;
         }
+    }, slots.size() < PARALLEL_EXTRACT_MIN_FACES);
+
+    // Emit in face order, stopping at the first failed face
+    size_t emittedSlots = 0;
+    while (emittedSlots < slots.size() && slots[emittedSlots].ok) emittedSlots++;
+    size_t emittedNodes = emittedSlots < slots.size() ? slots[emittedSlots].node_offset : totalNodes;
+    size_t emittedTriangles = emittedSlots < slots.size() ? slots[emittedSlots].triangle_offset : totalTriangles;
+
+    result.faces.reserve(emittedSlots);
+    result.vertices.reserve(emittedNodes);
+    result.normals.reserve(emittedNodes);
+    result.triangles.reserve(emittedTriangles);
+    result.face_ids.reserve(emittedTriangles);
+
+    for (size_t s = 0; s < emittedSlots; s++) {
+        const FaceExtractSlot& slot = slots[s];
+        result.faces.push_back(face_info_from_slot(slot));
+
+        size_t triangleEnd = (s + 1 < slots.size()) ? slots[s + 1].triangle_offset : totalTriangles;
+        for (size_t t = slot.triangle_offset; t < triangleEnd; t++) {
+            result.face_ids.push_back(slot.face_index);
+        }
+    }
+    for (size_t i = 0; i < emittedNodes; i++) {
+        result.vertices.push_back(vertices[i]);
+        result.normals.push_back(normals[i]);
+    }
+    for (size_t i = 0; i < emittedTriangles; i++) {
+        result.triangles.push_back(triangles[i]);
+    }
+}
+
+MeshResult tessellate(const OcctShape& shape, double deflection) {
+    MeshResult result;
+    result.vertices = rust::Vec<Vertex>();
+    result.normals = rust::Vec<Vertex>();
+    result.triangles = rust::Vec<Triangle>();
+    result.face_ids = rust::Vec<uint32_t>();
+    result.faces = rust::Vec<FaceInfo>();
+
+    try {
+        if (!shape.mesh_cache().ensure(shape.get(), cadhy::MeshCacheKey{deflection, 0.5, false})) return result;
+
+        extract_triangulation(shape.get(), result);
     } catch (...) {}
 
     return result;
@@ -1768,182 +2135,392 @@ MeshResult tessellate_with_angle(const OcctShape& shape, double deflection, doub
     result.faces = rust::Vec<FaceInfo>();
 
     try {
-        BRepMesh_IncrementalMesh mesh(shape.get(), deflection, false, angle);
-        mesh.Perform();
-        if (!mesh.IsDone()) return result;
-
-        // Compute shape bounding box for inlet/outlet cap detection
-        Bnd_Box shapeBox;
-        BRepBndLib::Add(shape.get(), shapeBox);
-        double xmin, ymin, zmin, xmax, ymax, zmax;
-        shapeBox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
-        double shapeZLength = zmax - zmin;
-        double capTolerance = std::max(0.01, shapeZLength * 0.001); // 0.1% of length or 1cm
-
-        size_t vertexOffset = 0;
-        uint32_t faceIndex = 0;
-        TopExp_Explorer faceExplorer(shape.get(), TopAbs_FACE);
+        if (!shape.mesh_cache().ensure(shape.get(), cadhy::MeshCacheKey{deflection, angle, false})) return result;
 
-        for (; faceExplorer.More(); faceExplorer.Next(), faceIndex++) {
-            const TopoDS_Face& face = TopoDS::Face(faceExplorer.Current());
-            TopLoc_Location location;
-            Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, location);
-            if (triangulation.IsNull()) continue;
+        extract_triangulation(shape.get(), result);
+    } catch (...) {}
 
-            gp_Trsf transform = location.Transformation();
+    return result;
+}
 
-            // Collect face info
-            FaceInfo faceInfo;
-            faceInfo.index = faceIndex;
-            faceInfo.is_reversed = (face.Orientation() == TopAbs_REVERSED);
+MeshResult tessellate_welded(const OcctShape& shape, double deflection, double crease_angle) {
+    MeshResult result;
+    result.vertices = rust::Vec<Vertex>();
+    result.normals = rust::Vec<Vertex>();
+    result.triangles = rust::Vec<Triangle>();
+    result.face_ids = rust::Vec<uint32_t>();
+    result.faces = rust::Vec<FaceInfo>();
 
-            // Get surface type and properties
-            BRepAdaptor_Surface surfAdaptor(face);
-            GeomAbs_SurfaceType surfType = surfAdaptor.GetType();
-            switch (surfType) {
-                case GeomAbs_Plane: faceInfo.surface_type = 0; break;
-                case GeomAbs_Cylinder: faceInfo.surface_type = 1; break;
-                case GeomAbs_Cone: faceInfo.surface_type = 2; break;
-                case GeomAbs_Sphere: faceInfo.surface_type = 3; break;
-                case GeomAbs_Torus: faceInfo.surface_type = 4; break;
-                case GeomAbs_BezierSurface: faceInfo.surface_type = 5; break;
-                case GeomAbs_BSplineSurface: faceInfo.surface_type = 6; break;
-                default: faceInfo.surface_type = 7; break;
-            }
+    try {
+        if (shape.is_null()) return result;
+        if (!shape.mesh_cache().ensure(shape.get(), cadhy::MeshCacheKey{deflection, 0.5, false})) return result;
 
-            // Get face normal at center
-            double uMid = (surfAdaptor.FirstUParameter() + surfAdaptor.LastUParameter()) / 2.0;
-            double vMid = (surfAdaptor.FirstVParameter() + surfAdaptor.LastVParameter()) / 2.0;
-            gp_Pnt centerPnt;
-            gp_Vec du, dv;
-            surfAdaptor.D1(uMid, vMid, centerPnt, du, dv);
-            gp_Vec faceNormal = du.Crossed(dv);
-            if (faceNormal.Magnitude() > 1e-10) {
-                faceNormal.Normalize();
-                if (faceInfo.is_reversed) faceNormal.Reverse();
-            }
-            faceInfo.normal_x = faceNormal.X();
-            faceInfo.normal_y = faceNormal.Y();
-            faceInfo.normal_z = faceNormal.Z();
+        cadhy::mesh::WeldedMesh welded = cadhy::mesh::weld_triangulation(shape.get(), crease_angle);
 
-            // Calculate face area
-            GProp_GProps props;
-            BRepGProp::SurfaceProperties(face, props);
-            faceInfo.area = props.Mass();
+        // Face metadata is identical to tessellate()
+        double zmin, zmax, capTolerance;
+        compute_cap_bounds(shape.get(), zmin, zmax, capTolerance);
+        std::vector<FaceExtractSlot> slots;
+        size_t totalNodes = 0;
+        size_t totalTriangles = 0;
+        index_triangulated_faces(shape.get(), slots, totalNodes, totalTriangles);
 
-            // Count edges
-            int edgeCount = 0;
-            for (TopExp_Explorer edgeExp(face, TopAbs_EDGE); edgeExp.More(); edgeExp.Next()) {
-                edgeCount++;
+        OSD_Parallel::For(0, static_cast<int>(slots.size()), [&](int i) {
+            try {
+                classify_face_slot(slots[i], zmin, zmax, capTolerance);
+                slots[i].ok = true;
+            } catch (...) {
+                slots[i].ok = false;
             }
-            faceInfo.num_edges = edgeCount;
+        }, slots.size() < PARALLEL_EXTRACT_MIN_FACES);
 
-            // Get face center of mass for position-based labeling
-            gp_Pnt faceCenter = props.CentreOfMass();
-
-            // Determine semantic label based on normal direction, surface type, and position
-            rust::String label;
-            if (surfType == GeomAbs_Plane) {
-                double nx = std::abs(faceInfo.normal_x);
-                double ny = std::abs(faceInfo.normal_y);
-                double nz = std::abs(faceInfo.normal_z);
-                double tolerance = 0.9;
-
-                if (nz > tolerance) {
-                    // Face normal predominantly in Z direction
-                    // Check if this is an inlet/outlet cap (at Z bounds of shape)
-                    if (std::abs(faceCenter.Z() - zmin) < capTolerance) {
-                        // Face at minimum Z = inlet cap (upstream)
-                        label = "inlet_cap";
-                    } else if (std::abs(faceCenter.Z() - zmax) < capTolerance) {
-                        // Face at maximum Z = outlet cap (downstream)
-                        label = "outlet_cap";
-                    } else {
-                        // Regular top/bottom face
-                        label = faceInfo.normal_z > 0 ? "top" : "bottom";
-                    }
-                } else if (ny > tolerance) {
-                    label = faceInfo.normal_y > 0 ? "back" : "front";
-                } else if (nx > tolerance) {
-                    label = faceInfo.normal_x > 0 ? "right" : "left";
-                } else {
-                    label = "side";
-                }
-            } else if (surfType == GeomAbs_Cylinder || surfType == GeomAbs_Cone) {
-                label = "curved_side";
-            } else if (surfType == GeomAbs_Sphere) {
-                label = "spherical";
-            } else if (surfType == GeomAbs_Torus) {
-                label = "toroidal";
-            } else {
-                label = "freeform";
-            }
-            faceInfo.label = label;
+        result.faces.reserve(slots.size());
+        for (const FaceExtractSlot& slot : slots) {
+            if (slot.ok) result.faces.push_back(face_info_from_slot(slot));
+        }
 
-            result.faces.push_back(faceInfo);
+        result.vertices.reserve(welded.positions.size());
+        result.normals.reserve(welded.normals.size());
+        for (size_t i = 0; i < welded.positions.size(); i++) {
+            Vertex v;
+            v.x = welded.positions[i].x;
+            v.y = welded.positions[i].y;
+            v.z = welded.positions[i].z;
+            result.vertices.push_back(v);
 
-            // Process vertices
-            for (int i = 1; i <= triangulation->NbNodes(); i++) {
-                gp_Pnt point = triangulation->Node(i).Transformed(transform);
-                Vertex v;
-                v.x = point.X(); v.y = point.Y(); v.z = point.Z();
-                result.vertices.push_back(v);
-
-                Vertex n;
-                if (triangulation->HasNormals()) {
-                    gp_Vec normalVec = triangulation->Normal(i);
-                    double len = normalVec.Magnitude();
-                    if (len > 1e-10) {
-                        n.x = normalVec.X() / len;
-                        n.y = normalVec.Y() / len;
-                        n.z = normalVec.Z() / len;
-                    } else {
-                        n.x = 0.0; n.y = 0.0; n.z = 1.0;
-                    }
-                } else {
-                    n.x = 0.0; n.y = 0.0; n.z = 1.0;
-                }
-                result.normals.push_back(n);
-            }
+            Vertex n;
+            n.x = welded.normals[i].x;
+            n.y = welded.normals[i].y;
+            n.z = welded.normals[i].z;
+            result.normals.push_back(n);
+        }
 
-            // Process triangles with face tracking
-            bool reversed = (face.Orientation() == TopAbs_REVERSED);
-            for (int i = 1; i <= triangulation->NbTriangles(); i++) {
-                const Poly_Triangle& tri = triangulation->Triangle(i);
-                Standard_Integer n1, n2, n3;
-                tri.Get(n1, n2, n3);
-
-                Triangle t;
-                if (reversed) {
-                    t.v1 = static_cast<uint32_t>(vertexOffset + n1 - 1);
-                    t.v2 = static_cast<uint32_t>(vertexOffset + n3 - 1);
-                    t.v3 = static_cast<uint32_t>(vertexOffset + n2 - 1);
-                } else {
-                    t.v1 = static_cast<uint32_t>(vertexOffset + n1 - 1);
-                    t.v2 = static_cast<uint32_t>(vertexOffset + n2 - 1);
-                    t.v3 = static_cast<uint32_t>(vertexOffset + n3 - 1);
-                }
-                result.triangles.push_back(t);
-                result.face_ids.push_back(faceIndex);
-            }
-            vertexOffset += triangulation->NbNodes();
+        result.triangles.reserve(welded.triangles.size());
+        result.face_ids.reserve(welded.triangles.size());
+        for (size_t i = 0; i < welded.triangles.size(); i++) {
+            Triangle t;
+            t.v1 = welded.triangles[i].v0;
+            t.v2 = welded.triangles[i].v1;
+            t.v3 = welded.triangles[i].v2;
+            result.triangles.push_back(t);
+            result.face_ids.push_back(static_cast<uint32_t>(welded.face_ids[i]));
         }
+    } catch (const Standard_Failure& e) {
+        std::cerr << "tessellate_welded exception: " << e.GetMessageString() << std::endl;
     } catch (...) {}
 
     return result;
 }
 
-// ============================================================
-// BREP I/O
-// ============================================================
-
-rust::Vec<uint8_t> write_brep(const OcctShape& shape) {
-    rust::Vec<uint8_t> result;
+// Convert a cadhy::mesh::MeshData built from `shape` into a MeshResult.
+// Its face ids are 1-based face map indices; FaceInfo is filled for every
+// face of the shape, whether or not it produced triangles.
+static MeshResult mesh_result_from_data(const TopoDS_Shape& shape, const cadhy::mesh::MeshData& mesh) {
+    MeshResult result;
+    result.vertices = rust::Vec<Vertex>();
+    result.normals = rust::Vec<Vertex>();
+    result.triangles = rust::Vec<Triangle>();
+    result.face_ids = rust::Vec<uint32_t>();
+    result.faces = rust::Vec<FaceInfo>();
 
-    try {
-        if (shape.is_null()) return result;
+    double zmin, zmax, capTolerance;
+    compute_cap_bounds(shape, zmin, zmax, capTolerance);
+    TopTools_IndexedMapOfShape faceMap;
+    TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
+    result.faces.reserve(faceMap.Extent());
+    for (int i = 1; i <= faceMap.Extent(); i++) {
+        FaceExtractSlot slot;
+        slot.face = TopoDS::Face(faceMap(i));
+        slot.face_index = static_cast<uint32_t>(i - 1);
+        classify_face_slot(slot, zmin, zmax, capTolerance);
+        result.faces.push_back(face_info_from_slot(slot));
+    }
 
-        std::ostringstream stream;
+    const bool hasNormals = mesh.normals.size() == mesh.positions.size();
+    result.vertices.reserve(mesh.vertex_count());
+    result.normals.reserve(hasNormals ? mesh.vertex_count() : 0);
+    for (size_t i = 0; i < mesh.vertex_count(); i++) {
+        Vertex v;
+        v.x = mesh.positions[i * 3];
+        v.y = mesh.positions[i * 3 + 1];
+        v.z = mesh.positions[i * 3 + 2];
+        result.vertices.push_back(v);
+
+        if (hasNormals) {
+            Vertex n;
+            n.x = mesh.normals[i * 3];
+            n.y = mesh.normals[i * 3 + 1];
+            n.z = mesh.normals[i * 3 + 2];
+            result.normals.push_back(n);
+        }
+    }
+
+    const bool hasFaceIds = mesh.face_ids.size() == mesh.triangle_count();
+    result.triangles.reserve(mesh.triangle_count());
+    result.face_ids.reserve(hasFaceIds ? mesh.triangle_count() : 0);
+    for (size_t i = 0; i < mesh.triangle_count(); i++) {
+        Triangle t;
+        t.v1 = mesh.indices[i * 3];
+        t.v2 = mesh.indices[i * 3 + 1];
+        t.v3 = mesh.indices[i * 3 + 2];
+        result.triangles.push_back(t);
+        if (hasFaceIds) result.face_ids.push_back(static_cast<uint32_t>(std::max(mesh.face_ids[i] - 1, 0)));
+    }
+
+    return result;
+}
+
+MeshResult tessellate_adaptive(
+    const OcctShape& shape,
+    double min_deflection,
+    double max_deflection,
+    double curvature_factor
+) {
+    MeshResult result;
+    result.vertices = rust::Vec<Vertex>();
+    result.normals = rust::Vec<Vertex>();
+    result.triangles = rust::Vec<Triangle>();
+    result.face_ids = rust::Vec<uint32_t>();
+    result.faces = rust::Vec<FaceInfo>();
+
+    try {
+        if (shape.is_null()) return result;
+
+        cadhy::mesh::MeshData mesh = cadhy::mesh::tessellate_adaptive(
+            shape, min_deflection, max_deflection, curvature_factor);
+        if (mesh.positions.empty()) return result;
+        result = mesh_result_from_data(shape.get(), mesh);
+    } catch (const Standard_Failure& e) {
+        std::cerr << "tessellate_adaptive exception: " << e.GetMessageString() << std::endl;
+    } catch (...) {}
+
+    return result;
+}
+
+rust::Vec<LodLevelResult> tessellate_lods(
+    const OcctShape& shape,
+    rust::Slice<const double> deflections,
+    bool optimize_for_rendering
+) {
+    rust::Vec<LodLevelResult> result;
+    try {
+        if (shape.is_null()) return result;
+
+        std::vector<double> requested(deflections.begin(), deflections.end());
+        for (cadhy::mesh::LODLevel& level : cadhy::mesh::generate_lod_levels(shape, requested)) {
+            if (optimize_for_rendering) level.mesh = cadhy::mesh::optimize_for_rendering(level.mesh);
+
+            LodLevelResult out;
+            out.mesh = mesh_result_from_data(shape.get(), level.mesh);
+            out.deflection = level.deflection;
+            out.error = level.error;
+            result.push_back(std::move(out));
+        }
+    } catch (const Standard_Failure& e) {
+        std::cerr << "tessellate_lods exception: " << e.GetMessageString() << std::endl;
+        result = rust::Vec<LodLevelResult>();
+    } catch (...) {
+        result = rust::Vec<LodLevelResult>();
+    }
+    return result;
+}
+
+// Flat buffer layout: 6 floats per vertex (interleaved position + normal)
+static const size_t FLAT_VERTEX_STRIDE = 6;
+
+// Write one face's nodes, normals, triangles and face ids into flat buffers.
+// Values match extract_face_slot(), narrowed to float32.
+static void fill_flat_face_slot(
+    const FaceExtractSlot& slot,
+    float* vertexData,
+    uint32_t* indices,
+    uint32_t* faceIds
+) {
+    const Handle(Poly_Triangulation)& triangulation = slot.triangulation;
+    bool reversed = (slot.face.Orientation() == TopAbs_REVERSED);
+
+    const int nbNodes = triangulation->NbNodes();
+    const bool hasNormals = triangulation->HasNormals();
+    for (int i = 1; i <= nbNodes; i++) {
+        gp_Pnt point = triangulation->Node(i).Transformed(slot.transform);
+        float* out = vertexData + (slot.node_offset + i - 1) * FLAT_VERTEX_STRIDE;
+        out[0] = static_cast<float>(point.X());
+        out[1] = static_cast<float>(point.Y());
+        out[2] = static_cast<float>(point.Z());
+
+        double nx = 0.0, ny = 0.0, nz = 1.0;
+        if (hasNormals) {
+            gp_Vec normalVec = triangulation->Normal(i);
+            double len = normalVec.Magnitude();
+            if (len > 1e-10) {
+                nx = normalVec.X() / len;
+                ny = normalVec.Y() / len;
+                nz = normalVec.Z() / len;
+            }
+        }
+        out[3] = static_cast<float>(nx);
+        out[4] = static_cast<float>(ny);
+        out[5] = static_cast<float>(nz);
+    }
+
+    const int nbTriangles = triangulation->NbTriangles();
+    for (int i = 1; i <= nbTriangles; i++) {
+        Standard_Integer n1, n2, n3;
+        triangulation->Triangle(i).Get(n1, n2, n3);
+
+        size_t t = slot.triangle_offset + i - 1;
+        uint32_t* tri = indices + t * 3;
+        tri[0] = static_cast<uint32_t>(slot.node_offset + n1 - 1);
+        if (reversed) {
+            tri[1] = static_cast<uint32_t>(slot.node_offset + n3 - 1);
+            tri[2] = static_cast<uint32_t>(slot.node_offset + n2 - 1);
+        } else {
+            tri[1] = static_cast<uint32_t>(slot.node_offset + n2 - 1);
+            tri[2] = static_cast<uint32_t>(slot.node_offset + n3 - 1);
+        }
+        faceIds[t] = slot.face_index;
+    }
+}
+
+FlatMeshSizes flat_mesh_sizes(const OcctShape& shape, double deflection, double angle) {
+    FlatMeshSizes result;
+    result.vertex_count = 0;
+    result.triangle_count = 0;
+    result.vertex_floats = 0;
+    result.index_count = 0;
+
+    try {
+        if (shape.is_null()) return result;
+        if (!shape.mesh_cache().ensure(shape.get(), cadhy::MeshCacheKey{deflection, angle, false})) return result;
+
+        std::vector<FaceExtractSlot> slots;
+        size_t totalNodes = 0;
+        size_t totalTriangles = 0;
+        index_triangulated_faces(shape.get(), slots, totalNodes, totalTriangles);
+
+        result.vertex_count = totalNodes;
+        result.triangle_count = totalTriangles;
+        result.vertex_floats = totalNodes * FLAT_VERTEX_STRIDE;
+        result.index_count = totalTriangles * 3;
+    } catch (const Standard_Failure& e) {
+        std::cerr << "flat_mesh_sizes exception: " << e.GetMessageString() << std::endl;
+    } catch (...) {}
+
+    return result;
+}
+
+bool fill_flat_mesh(
+    const OcctShape& shape,
+    double deflection,
+    double angle,
+    rust::Slice<float> vertex_data,
+    rust::Slice<uint32_t> indices,
+    rust::Slice<uint32_t> face_ids
+) {
+    try {
+        if (shape.is_null()) return false;
+        // Normally a cache hit: flat_mesh_sizes() meshed with the same key
+        if (!shape.mesh_cache().ensure(shape.get(), cadhy::MeshCacheKey{deflection, angle, false})) return false;
+
+        std::vector<FaceExtractSlot> slots;
+        size_t totalNodes = 0;
+        size_t totalTriangles = 0;
+        index_triangulated_faces(shape.get(), slots, totalNodes, totalTriangles);
+
+        // Buffers must be sized exactly as reported by flat_mesh_sizes()
+        if (vertex_data.size() != totalNodes * FLAT_VERTEX_STRIDE ||
+            indices.size() != totalTriangles * 3 ||
+            face_ids.size() != totalTriangles) {
+            return false;
+        }
+
+        float* vertexPtr = vertex_data.data();
+        uint32_t* indexPtr = indices.data();
+        uint32_t* faceIdPtr = face_ids.data();
+        std::atomic<bool> failed(false);
+
+        OSD_Parallel::For(0, static_cast<int>(slots.size()), [&](int i) {
+            try {
+                fill_flat_face_slot(slots[i], vertexPtr, indexPtr, faceIdPtr);
+            } catch (...) {
+                failed = true;
+            }
+        }, slots.size() < PARALLEL_EXTRACT_MIN_FACES);
+
+        return !failed;
+    } catch (const Standard_Failure& e) {
+        std::cerr << "fill_flat_mesh exception: " << e.GetMessageString() << std::endl;
+        return false;
+    } catch (...) {
+        return false;
+    }
+}
+
+RenderCacheReport optimize_flat_mesh(
+    rust::Slice<float> vertex_data,
+    rust::Slice<uint32_t> indices,
+    rust::Slice<uint32_t> face_ids,
+    bool group_by_face
+) {
+    RenderCacheReport result;
+    result.acmr_before = 0.0;
+    result.atvr_before = 0.0;
+    result.acmr_after = 0.0;
+    result.atvr_after = 0.0;
+
+    const size_t vertexCount = vertex_data.size() / FLAT_VERTEX_STRIDE;
+    const size_t triangleCount = indices.size() / 3;
+    if (vertex_data.size() != vertexCount * FLAT_VERTEX_STRIDE ||
+        indices.size() != triangleCount * 3 ||
+        (!face_ids.empty() && face_ids.size() != triangleCount)) {
+        return result;
+    }
+
+    try {
+        cadhy::mesh::RenderOptimizeOptions options;
+        options.group_by_face = group_by_face;
+
+        cadhy::mesh::RenderOptimizeReport report = cadhy::mesh::optimize_mesh_buffers(
+            vertex_data.data(), FLAT_VERTEX_STRIDE, vertexCount,
+            indices.data(), triangleCount,
+            face_ids.empty() ? nullptr : face_ids.data(), options);
+
+        result.acmr_before = report.before.acmr;
+        result.atvr_before = report.before.atvr;
+        result.acmr_after = report.after.acmr;
+        result.atvr_after = report.after.atvr;
+    } catch (const std::exception& e) {
+        std::cerr << "optimize_flat_mesh exception: " << e.what() << std::endl;
+    } catch (...) {}
+
+    return result;
+}
+
+MeshCacheStats mesh_cache_stats() {
+    cadhy::MeshCacheStats stats = cadhy::TriangulationCache::stats();
+    MeshCacheStats result;
+    result.hits = stats.hits;
+    result.misses = stats.misses;
+    result.reused_faces = stats.reused_faces;
+    result.meshed_faces = stats.meshed_faces;
+    return result;
+}
+
+void reset_mesh_cache_stats() {
+    cadhy::TriangulationCache::reset_stats();
+}
+
+// ============================================================
+// BREP I/O
+// ============================================================
+
+rust::Vec<uint8_t> write_brep(const OcctShape& shape) {
+    rust::Vec<uint8_t> result;
+
+    try {
+        if (shape.is_null()) return result;
+
+        std::ostringstream stream;
         BRepTools::Write(shape.get(), stream);
         std::string data = stream.str();
 
@@ -2016,6 +2593,27 @@ std::unique_ptr<OcctShape> read_step(rust::Str filename) {
     }
 }
 
+// Parsing has no progress support, so only the transfer reports and can
+// stop mid-way; a stop during parsing takes effect before the transfer
+std::unique_ptr<OcctShape> read_step_with_progress(rust::Str filename, const OperationProgress& progress) {
+    try {
+        if (progress.should_stop()) return nullptr;
+        Message_ProgressRange range = progress.start("Reading STEP file");
+
+        std::string path(filename.data(), filename.size());
+        STEPControl_Reader reader;
+        IFSelect_ReturnStatus status = reader.ReadFile(path.c_str());
+        if (status != IFSelect_RetDone || progress.should_stop()) return nullptr;
+        reader.TransferRoots(range);
+        if (range.UserBreak()) return nullptr;
+        TopoDS_Shape shape = reader.OneShape();
+        if (shape.IsNull()) return nullptr;
+        return std::make_unique<OcctShape>(shape);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
 bool write_step(const OcctShape& shape, rust::Str filename) {
     try {
         std::string path(filename.data(), filename.size());
@@ -2081,10 +2679,8 @@ bool write_gltf(const OcctShape& shape, rust::Str filename, double deflection) {
         if (shape.is_null()) return false;
         std::string path(filename.data(), filename.size());
 
-        // Tessellate first
-        BRepMesh_IncrementalMesh mesh(shape.get(), deflection);
-        mesh.Perform();
-        if (!mesh.IsDone()) return false;
+        // Tessellate first (reuses a cached triangulation when available)
+        if (!shape.mesh_cache().ensure(shape.get(), cadhy::MeshCacheKey{deflection, 0.5, false})) return false;
 
         // Create XDE document
         Handle(TDocStd_Document) doc = create_xde_document(shape);
@@ -2104,10 +2700,8 @@ bool write_glb(const OcctShape& shape, rust::Str filename, double deflection) {
         if (shape.is_null()) return false;
         std::string path(filename.data(), filename.size());
 
-        // Tessellate first
-        BRepMesh_IncrementalMesh mesh(shape.get(), deflection);
-        mesh.Perform();
-        if (!mesh.IsDone()) return false;
+        // Tessellate first (reuses a cached triangulation when available)
+        if (!shape.mesh_cache().ensure(shape.get(), cadhy::MeshCacheKey{deflection, 0.5, false})) return false;
 
         // Create XDE document
         Handle(TDocStd_Document) doc = create_xde_document(shape);
@@ -2127,10 +2721,8 @@ bool write_obj(const OcctShape& shape, rust::Str filename, double deflection) {
         if (shape.is_null()) return false;
         std::string path(filename.data(), filename.size());
 
-        // Tessellate first
-        BRepMesh_IncrementalMesh mesh(shape.get(), deflection);
-        mesh.Perform();
-        if (!mesh.IsDone()) return false;
+        // Tessellate first (reuses a cached triangulation when available)
+        if (!shape.mesh_cache().ensure(shape.get(), cadhy::MeshCacheKey{deflection, 0.5, false})) return false;
 
         // Create XDE document
         Handle(TDocStd_Document) doc = create_xde_document(shape);
@@ -2149,10 +2741,8 @@ bool write_ply(const OcctShape& shape, rust::Str filename, double deflection) {
         if (shape.is_null()) return false;
         std::string path(filename.data(), filename.size());
 
-        // Tessellate first
-        BRepMesh_IncrementalMesh mesh(shape.get(), deflection);
-        mesh.Perform();
-        if (!mesh.IsDone()) return false;
+        // Tessellate first (reuses a cached triangulation when available)
+        if (!shape.mesh_cache().ensure(shape.get(), cadhy::MeshCacheKey{deflection, 0.5, false})) return false;
 
         // Create XDE document
         Handle(TDocStd_Document) doc = create_xde_document(shape);
@@ -2196,10 +2786,8 @@ bool write_stl(const OcctShape& shape, rust::Str filename, double deflection) {
         if (shape.is_null()) return false;
         std::string path(filename.data(), filename.size());
 
-        // Tessellate first
-        BRepMesh_IncrementalMesh mesh(shape.get(), deflection);
-        mesh.Perform();
-        if (!mesh.IsDone()) return false;
+        // Tessellate first (reuses a cached triangulation when available)
+        if (!shape.mesh_cache().ensure(shape.get(), cadhy::MeshCacheKey{deflection, 0.5, false})) return false;
 
         // Use StlAPI for writing STL from shape
         StlAPI_Writer stlWriter;
@@ -2215,10 +2803,8 @@ bool write_stl_binary(const OcctShape& shape, rust::Str filename, double deflect
         if (shape.is_null()) return false;
         std::string path(filename.data(), filename.size());
 
-        // Tessellate first
-        BRepMesh_IncrementalMesh mesh(shape.get(), deflection);
-        mesh.Perform();
-        if (!mesh.IsDone()) return false;
+        // Tessellate first (reuses a cached triangulation when available)
+        if (!shape.mesh_cache().ensure(shape.get(), cadhy::MeshCacheKey{deflection, 0.5, false})) return false;
 
         // Use StlAPI for writing binary STL
         StlAPI_Writer stlWriter;
@@ -2333,13 +2919,16 @@ double get_shape_tolerance(const OcctShape& shape) {
     }
 }
 
-std::unique_ptr<OcctShape> fix_shape_advanced(
+// Healing passes of fix_shape_advanced. Each ShapeFix_Shape pass reports
+// into `range`; a user break is checked between steps and per face.
+static std::unique_ptr<OcctShape> run_fix_shape_steps(
     const OcctShape& shape,
     bool fix_small_faces,
     bool fix_small_edges,
     bool fix_degenerated,
     bool fix_self_intersection,
-    double tolerance
+    double tolerance,
+    const Message_ProgressRange& range
 ) {
     try {
         if (shape.is_null()) return nullptr;
@@ -2347,6 +2936,8 @@ std::unique_ptr<OcctShape> fix_shape_advanced(
         TopoDS_Shape result = shape.get();
         double tol = tolerance > 0 ? tolerance : 1e-6;
 
+        Message_ProgressScope scope(range, "Fixing shape", 5);
+
         // ============================================================
         // STEP 1: Basic shape fix
         // ============================================================
@@ -2354,8 +2945,9 @@ std::unique_ptr<OcctShape> fix_shape_advanced(
         fixer->SetPrecision(tol);
         fixer->SetMinTolerance(tol / 10.0);
         fixer->SetMaxTolerance(tol * 10.0);
-        fixer->Perform();
+        fixer->Perform(scope.Next());
         result = fixer->Shape();
+        if (scope.UserBreak()) return nullptr;
 
         // ============================================================
         // STEP 2: Fix degenerated edges
@@ -2398,8 +2990,9 @@ std::unique_ptr<OcctShape> fix_shape_advanced(
             // Run full shape fix again after degenerated edge handling
             Handle(ShapeFix_Shape) postFixer = new ShapeFix_Shape(result);
             postFixer->SetPrecision(tol);
-            postFixer->Perform();
+            postFixer->Perform(scope.Next());
             result = postFixer->Shape();
+            if (scope.UserBreak()) return nullptr;
         }
 
         // ============================================================
@@ -2417,6 +3010,7 @@ std::unique_ptr<OcctShape> fix_shape_advanced(
             wireframeFixer->FixWireGaps();
 
             result = wireframeFixer->Shape();
+            if (scope.UserBreak()) return nullptr;
         }
 
         // ============================================================
@@ -2445,6 +3039,7 @@ std::unique_ptr<OcctShape> fix_shape_advanced(
 
             // Apply face fixes through ShapeFix_Face
             for (TopExp_Explorer faceExp(result, TopAbs_FACE); faceExp.More(); faceExp.Next()) {
+                if (scope.UserBreak()) return nullptr;
                 TopoDS_Face face = TopoDS::Face(faceExp.Current());
 
                 Handle(ShapeFix_Face) faceFixer = new ShapeFix_Face(face);
@@ -2473,6 +3068,7 @@ std::unique_ptr<OcctShape> fix_shape_advanced(
             checker.SetRunParallel(false); // Safer for cross-platform
             checker.SetFuzzyValue(tol);
             checker.Perform();
+            if (scope.UserBreak()) return nullptr;
 
             // Check if there are self-intersections
             if (checker.HasErrors()) {
@@ -2484,11 +3080,12 @@ std::unique_ptr<OcctShape> fix_shape_advanced(
                 toleranceFixer->SetPrecision(tol * 2.0);
                 toleranceFixer->SetMinTolerance(tol);
                 toleranceFixer->SetMaxTolerance(tol * 100.0);
-                toleranceFixer->Perform();
+                toleranceFixer->Perform(scope.Next());
                 result = toleranceFixer->Shape();
 
                 // Pass 2: Fix faces that might be causing intersection
                 for (TopExp_Explorer faceExp(result, TopAbs_FACE); faceExp.More(); faceExp.Next()) {
+                    if (scope.UserBreak()) return nullptr;
                     TopoDS_Face face = TopoDS::Face(faceExp.Current());
 
                     Handle(ShapeFix_Face) faceFixer = new ShapeFix_Face(face);
@@ -2501,8 +3098,9 @@ std::unique_ptr<OcctShape> fix_shape_advanced(
                 // Pass 3: Final shape healing
                 Handle(ShapeFix_Shape) finalFixer = new ShapeFix_Shape(result);
                 finalFixer->SetPrecision(tol);
-                finalFixer->Perform();
+                finalFixer->Perform(scope.Next());
                 result = finalFixer->Shape();
+                if (scope.UserBreak()) return nullptr;
             }
         }
 
@@ -2515,8 +3113,9 @@ std::unique_ptr<OcctShape> fix_shape_advanced(
             Handle(ShapeFix_Shape) lastResort = new ShapeFix_Shape(result);
             lastResort->SetPrecision(tol * 10.0);
             lastResort->SetMaxTolerance(tol * 1000.0);
-            lastResort->Perform();
+            lastResort->Perform(scope.Next());
             result = lastResort->Shape();
+            if (scope.UserBreak()) return nullptr;
         }
 
         return std::make_unique<OcctShape>(result);
@@ -2529,6 +3128,69 @@ std::unique_ptr<OcctShape> fix_shape_advanced(
     }
 }
 
+std::unique_ptr<OcctShape> fix_shape_advanced(
+    const OcctShape& shape,
+    bool fix_small_faces,
+    bool fix_small_edges,
+    bool fix_degenerated,
+    bool fix_self_intersection,
+    double tolerance
+) {
+    return run_fix_shape_steps(shape, fix_small_faces, fix_small_edges, fix_degenerated,
+                               fix_self_intersection, tolerance, Message_ProgressRange());
+}
+
+std::unique_ptr<OcctShape> fix_shape_advanced_with_progress(
+    const OcctShape& shape,
+    bool fix_small_faces,
+    bool fix_small_edges,
+    bool fix_degenerated,
+    bool fix_self_intersection,
+    double tolerance,
+    const OperationProgress& progress
+) {
+    if (progress.should_stop()) return nullptr;
+    return run_fix_shape_steps(shape, fix_small_faces, fix_small_edges, fix_degenerated,
+                               fix_self_intersection, tolerance, progress.start("Fixing shape"));
+}
+
+// Null entries are skipped
+static std::unique_ptr<OcctShape> sew_shape_list(
+    rust::Slice<const OcctShape* const> shapes,
+    double tolerance,
+    const Message_ProgressRange& range
+) {
+    try {
+        std::vector<const OcctShape*> faces;
+        faces.reserve(shapes.size());
+        for (const OcctShape* shape : shapes) {
+            if (shape && !shape->is_null()) faces.push_back(shape);
+        }
+        if (faces.empty()) return nullptr;
+
+        return cadhy::analysis::sew_faces(faces, tolerance > 0 ? tolerance : 1e-6, range);
+    } catch (const Standard_Failure& e) {
+        std::cerr << "sew_shapes exception: " << e.GetMessageString() << std::endl;
+        return nullptr;
+    } catch (...) {
+        std::cerr << "sew_shapes: unknown exception" << std::endl;
+        return nullptr;
+    }
+}
+
+std::unique_ptr<OcctShape> sew_shapes(rust::Slice<const OcctShape* const> shapes, double tolerance) {
+    return sew_shape_list(shapes, tolerance, Message_ProgressRange());
+}
+
+std::unique_ptr<OcctShape> sew_shapes_with_progress(
+    rust::Slice<const OcctShape* const> shapes,
+    double tolerance,
+    const OperationProgress& progress
+) {
+    if (progress.should_stop()) return nullptr;
+    return sew_shape_list(shapes, tolerance, progress.start("Sewing"));
+}
+
 // ============================================================
 // ADVANCED DISTANCE MEASUREMENT
 // ============================================================
@@ -3480,7 +4142,9 @@ static int extract_2d_curves(
     double deflection,
     int& num_lines,
     int& num_arcs,
-    int& num_polylines
+    int& num_ellipses,
+    int& num_polylines,
+    const std::function<bool()>& stop = nullptr
 ) {
     if (shape.IsNull()) {
         return 0;
@@ -3490,6 +4154,10 @@ static int extract_2d_curves(
 
     TopExp_Explorer explorer(shape, TopAbs_EDGE);
     for (; explorer.More(); explorer.Next()) {
+        if (stop && stop()) {
+            break;
+        }
+
         const TopoDS_Edge& edge = TopoDS::Edge(explorer.Current());
 
         Standard_Real first, last;
@@ -3627,7 +4295,7 @@ static int extract_2d_curves(
                 c.rotation = rotation;
                 c.ccw = (edge.Orientation() != TopAbs_REVERSED);
                 curves.push_back(c);
-                num_arcs++;
+                num_ellipses++;
                 extracted++;
                 break;
             }
@@ -3667,13 +4335,8 @@ static int extract_2d_curves(
     return extracted;
 }
 
-HLRProjectionResultV2 compute_hlr_projection_v2(
-    const OcctShape& shape,
-    double dir_x, double dir_y, double dir_z,
-    double up_x, double up_y, double up_z,
-    double scale,
-    double deflection
-) {
+// Empty V2 result with an inverted bounding box (grown by extraction)
+static HLRProjectionResultV2 empty_hlr_result_v2() {
     HLRProjectionResultV2 result;
     result.curves = rust::Vec<Curve2DFFI>();
     result.polylines = rust::Vec<Polyline2DFFI>();
@@ -3684,126 +4347,292 @@ HLRProjectionResultV2 compute_hlr_projection_v2(
     result.num_edges = 0;
     result.num_lines = 0;
     result.num_arcs = 0;
+    result.num_ellipses = 0;
     result.num_polylines = 0;
+    return result;
+}
 
-    try {
-        if (shape.is_null()) {
-            std::cerr << "[HLR-V2] ERROR: Shape is null" << std::endl;
-            return result;
-        }
+// Build the HLR projector for a view; false if the direction is degenerate
+static bool make_hlr_projector(
+    double dir_x, double dir_y, double dir_z,
+    double up_x, double up_y, double up_z,
+    HLRAlgo_Projector& projector
+) {
+    // Normalize view direction
+    double len = std::sqrt(dir_x*dir_x + dir_y*dir_y + dir_z*dir_z);
+    if (len < 1e-10) {
+        return false;
+    }
+    dir_x /= len;
+    dir_y /= len;
+    dir_z /= len;
 
-        // Validate deflection
-        if (deflection <= 0) {
-            deflection = 0.01;  // Default value
-        }
+    gp_Dir viewDir(dir_x, dir_y, dir_z);
+    gp_Dir xAxis;
+    try {
+        gp_Dir upDir(up_x, up_y, up_z);
+        xAxis = upDir.Crossed(viewDir);
+    } catch (...) {
+        xAxis = gp_Dir(1, 0, 0);
+    }
 
-        // Normalize view direction
-        double len = std::sqrt(dir_x*dir_x + dir_y*dir_y + dir_z*dir_z);
-        if (len < 1e-10) {
-            std::cerr << "[HLR-V2] ERROR: Invalid view direction" << std::endl;
-            return result;
-        }
-        dir_x /= len;
-        dir_y /= len;
-        dir_z /= len;
+    gp_Ax2 viewAxis(gp_Pnt(0, 0, 0), viewDir, xAxis);
+    projector = HLRAlgo_Projector(viewAxis);
+    return true;
+}
 
-        std::cerr << "[HLR-V2] View: (" << dir_x << ", " << dir_y << ", " << dir_z << ")" << std::endl;
+// Extract one HLR compound into the V2 result
+static void append_hlr_compound(
+    const TopoDS_Shape& compound,
+    int line_type,
+    double deflection,
+    HLRProjectionResultV2& result,
+    const std::function<bool()>& stop = nullptr
+) {
+    int numLines = 0, numArcs = 0, numEllipses = 0, numPolylines = 0;
+    result.num_edges += extract_2d_curves(compound, line_type, result.curves, result.polylines,
+        result.min_x, result.min_y, result.max_x, result.max_y, deflection,
+        numLines, numArcs, numEllipses, numPolylines, stop);
+    result.num_lines += numLines;
+    result.num_arcs += numArcs;
+    result.num_ellipses += numEllipses;
+    result.num_polylines += numPolylines;
+}
 
-        // Create projector
-        gp_Dir viewDir(dir_x, dir_y, dir_z);
-        gp_Dir upDir(up_x, up_y, up_z);
-        gp_Dir xAxis;
-        try {
-            xAxis = upDir.Crossed(viewDir);
-        } catch (...) {
-            xAxis = gp_Dir(1, 0, 0);
+// Apply the output scale and reset the bounding box of an empty result
+static void finish_hlr_result_v2(HLRProjectionResultV2& result, double scale) {
+    if (scale != 1.0) {
+        for (auto& c : result.curves) {
+            c.start_x *= scale;
+            c.start_y *= scale;
+            c.end_x *= scale;
+            c.end_y *= scale;
+            c.center_x *= scale;
+            c.center_y *= scale;
+            c.radius *= scale;
+            c.major_radius *= scale;
+            c.minor_radius *= scale;
         }
+        for (auto& p : result.polylines) {
+            for (auto& pt : p.points) {
+                pt.x *= scale;
+                pt.y *= scale;
+            }
+        }
+        result.min_x *= scale;
+        result.min_y *= scale;
+        result.max_x *= scale;
+        result.max_y *= scale;
+    }
 
-        gp_Ax2 viewAxis(gp_Pnt(0, 0, 0), viewDir, xAxis);
-        HLRAlgo_Projector projector(viewAxis);
-
-        // Create HLR algorithm
-        Handle(HLRBRep_Algo) hlr = new HLRBRep_Algo();
-        hlr->Add(shape.get());
-        hlr->Projector(projector);
-        hlr->Update();
-        hlr->Hide();
+    if (result.curves.empty() && result.polylines.empty()) {
+        result.min_x = 0;
+        result.min_y = 0;
+        result.max_x = 0;
+        result.max_y = 0;
+    }
+}
 
-        // Extract results
-        HLRBRep_HLRToShape extractor(hlr);
+// Exact HLR into `result`. `cancelled` (may be null) and the user break of
+// `range` (which sees timeouts) are polled between phases and per
+// extracted edge, and `range` advances once per phase; returns false if
+// either stopped the run.
+static bool run_exact_hlr(
+    const TopoDS_Shape& shape,
+    const HLRAlgo_Projector& projector,
+    double deflection,
+    HLRProjectionResultV2& result,
+    const std::atomic<bool>* cancelled = nullptr,
+    const Message_ProgressRange& range = Message_ProgressRange()
+) {
+    Message_ProgressScope scope(range, "Hidden line removal", 8);
+    const std::function<bool()> stop = [cancelled, &scope]() {
+        return (cancelled && cancelled->load(std::memory_order_relaxed)) || scope.UserBreak();
+    };
 
-        int numLines = 0, numArcs = 0, numPolylines = 0;
+    Handle(HLRBRep_Algo) hlr = new HLRBRep_Algo();
+    hlr->Add(shape);
+    hlr->Projector(projector);
+    hlr->Update();
+    scope.Next();
+    if (stop()) return false;
+    hlr->Hide();
+    scope.Next();
+    if (stop()) return false;
+
+    HLRBRep_HLRToShape extractor(hlr);
+
+    // Compounds are built on demand, so each extraction is its own phase
+    auto extract = [&](const TopoDS_Shape& compound, int line_type) {
+        append_hlr_compound(compound, line_type, deflection, result, stop);
+        scope.Next();
+        return !stop();
+    };
+    return extract(extractor.VCompound(), 0)
+        && extract(extractor.HCompound(), 1)
+        && extract(extractor.Rg1LineVCompound(), 2)
+        && extract(extractor.Rg1LineHCompound(), 3)
+        && extract(extractor.OutLineVCompound(), 4)
+        && extract(extractor.OutLineHCompound(), 5);
+}
 
-        // Extract different line types with curve detection
-        TopoDS_Shape visibleSharp = extractor.VCompound();
-        result.num_edges += extract_2d_curves(visibleSharp, 0, result.curves, result.polylines,
-            result.min_x, result.min_y, result.max_x, result.max_y, deflection,
-            numLines, numArcs, numPolylines);
+// ============================================================
+// HLR RESULT CACHE
+// ============================================================
 
-        TopoDS_Shape hiddenSharp = extractor.HCompound();
-        result.num_edges += extract_2d_curves(hiddenSharp, 1, result.curves, result.polylines,
-            result.min_x, result.min_y, result.max_x, result.max_y, deflection,
-            numLines, numArcs, numPolylines);
+// Unscaled exact results keyed by shape content and camera, so regenerating
+// a drawing (or re-opening the sheet) skips HLR entirely
+static constexpr size_t HLR_CACHE_DEFAULT_CAPACITY = size_t(64) << 20;  // 64 MiB
 
-        TopoDS_Shape visibleSmooth = extractor.Rg1LineVCompound();
-        result.num_edges += extract_2d_curves(visibleSmooth, 2, result.curves, result.polylines,
-            result.min_x, result.min_y, result.max_x, result.max_y, deflection,
-            numLines, numArcs, numPolylines);
+// View vectors and deflection are quantised so float noise maps to one key
+static constexpr double HLR_CACHE_QUANTUM = 1e-6;
 
-        TopoDS_Shape hiddenSmooth = extractor.Rg1LineHCompound();
-        result.num_edges += extract_2d_curves(hiddenSmooth, 3, result.curves, result.polylines,
-            result.min_x, result.min_y, result.max_x, result.max_y, deflection,
-            numLines, numArcs, numPolylines);
+struct HlrCacheKey {
+    uint64_t shape = 0;
+    int64_t view[7] = {};  // dir xyz, up xyz, deflection
 
-        TopoDS_Shape visibleOutline = extractor.OutLineVCompound();
-        result.num_edges += extract_2d_curves(visibleOutline, 4, result.curves, result.polylines,
-            result.min_x, result.min_y, result.max_x, result.max_y, deflection,
-            numLines, numArcs, numPolylines);
+    bool operator==(const HlrCacheKey& other) const {
+        if (shape != other.shape) return false;
+        for (int i = 0; i < 7; ++i) {
+            if (view[i] != other.view[i]) return false;
+        }
+        return true;
+    }
+};
 
-        TopoDS_Shape hiddenOutline = extractor.OutLineHCompound();
-        result.num_edges += extract_2d_curves(hiddenOutline, 5, result.curves, result.polylines,
-            result.min_x, result.min_y, result.max_x, result.max_y, deflection,
-            numLines, numArcs, numPolylines);
-
-        result.num_lines = numLines;
-        result.num_arcs = numArcs;
-        result.num_polylines = numPolylines;
-
-        std::cerr << "[HLR-V2] Extracted: " << numLines << " lines, "
-                  << numArcs << " arcs, " << numPolylines << " polylines" << std::endl;
-
-        // Apply scale
-        if (scale != 1.0) {
-            for (auto& c : result.curves) {
-                c.start_x *= scale;
-                c.start_y *= scale;
-                c.end_x *= scale;
-                c.end_y *= scale;
-                c.center_x *= scale;
-                c.center_y *= scale;
-                c.radius *= scale;
-                c.major_radius *= scale;
-                c.minor_radius *= scale;
-            }
-            for (auto& p : result.polylines) {
-                for (auto& pt : p.points) {
-                    pt.x *= scale;
-                    pt.y *= scale;
-                }
-            }
-            result.min_x *= scale;
-            result.min_y *= scale;
-            result.max_x *= scale;
-            result.max_y *= scale;
+struct HlrCacheKeyHash {
+    size_t operator()(const HlrCacheKey& key) const {
+        uint64_t h = key.shape;
+        for (int64_t v : key.view) {
+            h ^= static_cast<uint64_t>(v) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
         }
+        return static_cast<size_t>(h);
+    }
+};
 
-        // Handle empty result
-        if (result.curves.empty() && result.polylines.empty()) {
-            result.min_x = 0;
-            result.min_y = 0;
-            result.max_x = 0;
-            result.max_y = 0;
+using HlrResultCache = cadhy::LruCache<HlrCacheKey, HLRProjectionResultV2, HlrCacheKeyHash>;
+
+static HlrResultCache& hlr_cache() {
+    static HlrResultCache cache(HLR_CACHE_DEFAULT_CAPACITY);
+    return cache;
+}
+
+static HlrCacheKey make_hlr_cache_key(
+    const TopoDS_Shape& shape,
+    double dir_x, double dir_y, double dir_z,
+    double up_x, double up_y, double up_z,
+    double deflection
+) {
+    auto normalize = [](double& x, double& y, double& z) {
+        double len = std::sqrt(x*x + y*y + z*z);
+        if (len > 1e-10) {
+            x /= len;
+            y /= len;
+            z /= len;
+        }
+    };
+    normalize(dir_x, dir_y, dir_z);
+    normalize(up_x, up_y, up_z);
+
+    const double values[7] = {dir_x, dir_y, dir_z, up_x, up_y, up_z, deflection};
+
+    HlrCacheKey key;
+    key.shape = cadhy::shape_fingerprint(shape);
+    for (int i = 0; i < 7; ++i) {
+        key.view[i] = std::llround(values[i] / HLR_CACHE_QUANTUM);
+    }
+    return key;
+}
+
+// Approximate heap footprint of a result, for the cache's memory cap
+static size_t hlr_result_bytes(const HLRProjectionResultV2& result) {
+    size_t bytes = sizeof(HlrCacheKey) + sizeof(HLRProjectionResultV2)
+                 + result.curves.size() * sizeof(Curve2DFFI)
+                 + result.polylines.size() * sizeof(Polyline2DFFI);
+    for (const auto& polyline : result.polylines) {
+        bytes += polyline.points.size() * sizeof(TessPoint2D);
+    }
+    return bytes;
+}
+
+HlrCacheStats hlr_cache_stats() {
+    cadhy::LruCacheStats stats = hlr_cache().stats();
+    HlrCacheStats result;
+    result.hits = stats.hits;
+    result.misses = stats.misses;
+    result.evictions = stats.evictions;
+    result.entries = stats.entries;
+    result.bytes = stats.bytes;
+    result.capacity = stats.capacity;
+    return result;
+}
+
+void reset_hlr_cache_stats() {
+    hlr_cache().reset_stats();
+}
+
+void set_hlr_cache_capacity(uint64_t bytes) {
+    hlr_cache().set_capacity(static_cast<size_t>(bytes));
+}
+
+void clear_hlr_cache() {
+    hlr_cache().clear();
+}
+
+// compute_hlr_projection_v2, optionally reporting into `progress`; a
+// stopped run yields an empty result and is not cached
+static HLRProjectionResultV2 exact_hlr_projection(
+    const OcctShape& shape,
+    double dir_x, double dir_y, double dir_z,
+    double up_x, double up_y, double up_z,
+    double scale,
+    double deflection,
+    const OperationProgress* progress
+) {
+    HLRProjectionResultV2 result = empty_hlr_result_v2();
+
+    try {
+        if (shape.is_null()) {
+            std::cerr << "[HLR-V2] ERROR: Shape is null" << std::endl;
+            return result;
+        }
+
+        // Validate deflection
+        if (deflection <= 0) {
+            deflection = 0.01;  // Default value
+        }
+
+        HLRAlgo_Projector projector;
+        if (!make_hlr_projector(dir_x, dir_y, dir_z, up_x, up_y, up_z, projector)) {
+            std::cerr << "[HLR-V2] ERROR: Invalid view direction" << std::endl;
+            return result;
+        }
+
+        // Cached results are unscaled; scale is applied below as for a fresh one
+        HlrCacheKey key = make_hlr_cache_key(shape.get(), dir_x, dir_y, dir_z,
+                                             up_x, up_y, up_z, deflection);
+        if (auto cached = hlr_cache().get(key)) {
+            result = std::move(*cached);
+            finish_hlr_result_v2(result, scale);
+            return result;
+        }
+
+        const bool complete = progress
+            ? run_exact_hlr(shape.get(), projector, deflection, result,
+                            progress->stop_flag(), progress->start("Hidden line removal"))
+            : run_exact_hlr(shape.get(), projector, deflection, result);
+        if (!complete) {
+            result = empty_hlr_result_v2();
+            finish_hlr_result_v2(result, 1.0);
+            return result;
         }
+        hlr_cache().put(key, result, hlr_result_bytes(result));
+
+        std::cerr << "[HLR-V2] Extracted: " << result.num_lines << " lines, "
+                  << result.num_arcs << " arcs, " << result.num_ellipses << " ellipses, "
+                  << result.num_polylines << " polylines" << std::endl;
+
+        finish_hlr_result_v2(result, scale);
 
     } catch (const Standard_Failure& e) {
         std::cerr << "[HLR-V2] OCCT Exception: " << e.GetMessageString() << std::endl;
@@ -3820,6 +4649,457 @@ HLRProjectionResultV2 compute_hlr_projection_v2(
     return result;
 }
 
+HLRProjectionResultV2 compute_hlr_projection_v2(
+    const OcctShape& shape,
+    double dir_x, double dir_y, double dir_z,
+    double up_x, double up_y, double up_z,
+    double scale,
+    double deflection
+) {
+    return exact_hlr_projection(shape, dir_x, dir_y, dir_z, up_x, up_y, up_z,
+                                scale, deflection, nullptr);
+}
+
+HLRProjectionResultV2 compute_hlr_projection_with_progress(
+    const OcctShape& shape,
+    double dir_x, double dir_y, double dir_z,
+    double up_x, double up_y, double up_z,
+    double scale,
+    double deflection,
+    const OperationProgress& progress
+) {
+    if (progress.should_stop()) {
+        HLRProjectionResultV2 result = empty_hlr_result_v2();
+        finish_hlr_result_v2(result, 1.0);
+        return result;
+    }
+    return exact_hlr_projection(shape, dir_x, dir_y, dir_z, up_x, up_y, up_z,
+                                scale, deflection, &progress);
+}
+
+// ============================================================
+// HLR CLEANUP
+// ============================================================
+
+// Helper: Curve2DFFI with every field zeroed
+static Curve2DFFI empty_curve_2d(int32_t curve_type, int32_t line_type) {
+    Curve2DFFI c;
+    c.curve_type = curve_type;
+    c.line_type = line_type;
+    c.start_x = 0;
+    c.start_y = 0;
+    c.end_x = 0;
+    c.end_y = 0;
+    c.center_x = 0;
+    c.center_y = 0;
+    c.radius = 0;
+    c.major_radius = 0;
+    c.minor_radius = 0;
+    c.start_angle = 0;
+    c.end_angle = 0;
+    c.rotation = 0;
+    c.ccw = false;
+    return c;
+}
+
+HLRProjectionResultV2 simplify_hlr_projection_v2(
+    const HLRProjectionResultV2& result,
+    double tolerance
+) {
+    HLRProjectionResultV2 out = empty_hlr_result_v2();
+    out.min_x = result.min_x;
+    out.min_y = result.min_y;
+    out.max_x = result.max_x;
+    out.max_y = result.max_y;
+    out.num_edges = result.num_edges;
+
+    // Lines and polylines become strokes; exact curves are kept as they are
+    std::vector<cadhy::projection::HlrStroke> strokes;
+    strokes.reserve(result.curves.size() + result.polylines.size());
+    for (const auto& c : result.curves) {
+        if (c.curve_type != 0) {
+            out.curves.push_back(c);
+            if (c.curve_type == 3) {
+                out.num_ellipses++;
+            } else {
+                out.num_arcs++;
+            }
+            continue;
+        }
+        cadhy::projection::HlrStroke stroke;
+        stroke.points = {c.start_x, c.start_y, c.end_x, c.end_y};
+        stroke.line_type = c.line_type;
+        stroke.hidden = (c.line_type % 2 == 1);
+        strokes.push_back(std::move(stroke));
+    }
+    for (const auto& polyline : result.polylines) {
+        cadhy::projection::HlrStroke stroke;
+        stroke.points.reserve(2 * polyline.points.size());
+        for (const auto& p : polyline.points) {
+            stroke.points.push_back(p.x);
+            stroke.points.push_back(p.y);
+        }
+        stroke.line_type = polyline.line_type;
+        stroke.hidden = (polyline.line_type % 2 == 1);
+        strokes.push_back(std::move(stroke));
+    }
+
+    cadhy::projection::HlrCleanupOptions options;
+    options.tolerance = tolerance > 0 ? tolerance : 0.01;
+    cadhy::projection::HlrCleanupResult cleaned = cadhy::projection::cleanup_hlr_strokes(strokes, options);
+
+    for (const auto& stroke : cleaned.strokes) {
+        const size_t n = stroke.points.size() / 2;
+        if (n == 2 && !stroke.closed) {
+            Curve2DFFI c = empty_curve_2d(0, stroke.line_type);
+            c.start_x = stroke.points[0];
+            c.start_y = stroke.points[1];
+            c.end_x = stroke.points[2];
+            c.end_y = stroke.points[3];
+            out.curves.push_back(c);
+            out.num_lines++;
+            continue;
+        }
+        Polyline2DFFI polyline;
+        polyline.line_type = stroke.line_type;
+        for (size_t i = 0; i < n; ++i) {
+            polyline.points.push_back(TessPoint2D{stroke.points[2 * i], stroke.points[2 * i + 1]});
+        }
+        if (stroke.closed) polyline.points.push_back(TessPoint2D{stroke.points[0], stroke.points[1]});
+        out.polylines.push_back(std::move(polyline));
+        out.num_polylines++;
+    }
+
+    for (const auto& arc : cleaned.arcs) {
+        Curve2DFFI c = empty_curve_2d(arc.full_circle ? 2 : 1, arc.line_type);
+        c.center_x = arc.cx;
+        c.center_y = arc.cy;
+        c.radius = arc.radius;
+        c.major_radius = arc.radius;
+        c.minor_radius = arc.radius;
+        c.start_x = arc.cx + arc.radius * std::cos(arc.start_angle);
+        c.start_y = arc.cy + arc.radius * std::sin(arc.start_angle);
+        c.end_x = arc.cx + arc.radius * std::cos(arc.end_angle);
+        c.end_y = arc.cy + arc.radius * std::sin(arc.end_angle);
+        c.start_angle = arc.start_angle;
+        c.end_angle = arc.full_circle ? arc.start_angle : arc.end_angle;
+        c.ccw = arc.ccw;
+        out.curves.push_back(c);
+        out.num_arcs++;
+    }
+
+    if (out.curves.empty() && out.polylines.empty()) {
+        out.min_x = 0;
+        out.min_y = 0;
+        out.max_x = 0;
+        out.max_y = 0;
+    }
+    return out;
+}
+
+// ============================================================
+// STREAMING DRAWING EXPORT
+// ============================================================
+
+// Helper: DXF layer / SVG style for a V2 line type code
+static cadhy::projection::DrawingLayer drawing_layer_for(int32_t line_type) {
+    if (line_type == 6) return cadhy::projection::DrawingLayer::Center;
+    return (line_type % 2 == 1) ? cadhy::projection::DrawingLayer::Hidden
+                                : cadhy::projection::DrawingLayer::Visible;
+}
+
+// Helper: Stream a V2 result through a drawing writer
+static bool write_hlr_result_v2(const HLRProjectionResultV2& result,
+                                cadhy::projection::DrawingWriter& writer) {
+    writer.begin(result.min_x, result.min_y, result.max_x, result.max_y);
+
+    for (const auto& c : result.curves) {
+        auto layer = drawing_layer_for(c.line_type);
+        switch (c.curve_type) {
+            case 0:
+                writer.line(layer, c.start_x, c.start_y, c.end_x, c.end_y);
+                break;
+            case 1:
+                writer.arc(layer, c.center_x, c.center_y, c.radius, c.start_angle, c.end_angle, c.ccw);
+                break;
+            case 2:
+                writer.circle(layer, c.center_x, c.center_y, c.radius);
+                break;
+            case 3:
+                writer.ellipse(layer, c.center_x, c.center_y, c.major_radius, c.minor_radius,
+                               c.rotation, c.start_angle, c.end_angle, c.ccw);
+                break;
+            default:
+                break;
+        }
+    }
+
+    std::vector<double> points;
+    for (const auto& polyline : result.polylines) {
+        points.clear();
+        for (const auto& p : polyline.points) {
+            points.push_back(p.x);
+            points.push_back(p.y);
+        }
+        writer.polyline(drawing_layer_for(polyline.line_type), points.data(), polyline.points.size());
+    }
+
+    return writer.finish();
+}
+
+bool write_hlr_projection_drawing(
+    const OcctShape& shape,
+    double dir_x, double dir_y, double dir_z,
+    double up_x, double up_y, double up_z,
+    double scale,
+    double deflection,
+    rust::Str filename,
+    int32_t format,
+    int32_t precision,
+    double quantum
+) {
+    try {
+        if (shape.is_null()) return false;
+        if (format < 0 || format > 2) return false;
+
+        HLRProjectionResultV2 result = compute_hlr_projection_v2(
+            shape, dir_x, dir_y, dir_z, up_x, up_y, up_z, scale, deflection);
+        if (result.curves.empty() && result.polylines.empty()) return false;
+
+        std::string path(filename.data(), filename.size());
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        if (!file) {
+            std::cerr << "[Drawing] ERROR: Cannot open " << path << std::endl;
+            return false;
+        }
+
+        cadhy::projection::DrawingWriterOptions options;
+        options.format = static_cast<cadhy::projection::DrawingFormat>(format);
+        options.precision = precision;
+        options.quantum = quantum;
+        cadhy::projection::DrawingWriter writer(
+            [file](const char* data, size_t size) {
+                return std::fwrite(data, 1, size, file) == size;
+            },
+            options);
+
+        bool ok = write_hlr_result_v2(result, writer);
+        ok = (std::fclose(file) == 0) && ok;
+        return ok;
+    } catch (const Standard_Failure& e) {
+        std::cerr << "[Drawing] OCCT Exception: " << e.GetMessageString() << std::endl;
+        return false;
+    } catch (...) {
+        return false;
+    }
+}
+
+// ============================================================
+// TIERED HLR (POLYGONAL PREVIEW + BACKGROUND EXACT)
+// ============================================================
+
+// Exact HLR work grows with edges x faces (every edge is hidden against the
+// faces whose projected boxes it overlaps). Above this the polygonal preview
+// is worth showing first; a ~3k-face assembly is far past it, a single
+// machined part of a few hundred faces is not.
+static constexpr double HLR_EXACT_WORK_LIMIT = 2.0e6;
+
+HlrCostEstimate estimate_hlr_cost(const OcctShape& shape) {
+    HlrCostEstimate estimate;
+    estimate.num_faces = 0;
+    estimate.num_edges = 0;
+    estimate.work = 0.0;
+    estimate.use_preview = false;
+
+    if (shape.is_null()) return estimate;
+
+    TopTools_IndexedMapOfShape faces, edges;
+    TopExp::MapShapes(shape.get(), TopAbs_FACE, faces);
+    TopExp::MapShapes(shape.get(), TopAbs_EDGE, edges);
+
+    estimate.num_faces = faces.Extent();
+    estimate.num_edges = edges.Extent();
+    estimate.work = static_cast<double>(estimate.num_faces) * estimate.num_edges;
+    estimate.use_preview = estimate.work > HLR_EXACT_WORK_LIMIT;
+    return estimate;
+}
+
+HLRProjectionResultV2 compute_hlr_projection_poly(
+    const OcctShape& shape,
+    double dir_x, double dir_y, double dir_z,
+    double up_x, double up_y, double up_z,
+    double scale,
+    double deflection
+) {
+    HLRProjectionResultV2 result = empty_hlr_result_v2();
+
+    try {
+        if (shape.is_null()) return result;
+
+        HLRAlgo_Projector projector;
+        if (!make_hlr_projector(dir_x, dir_y, dir_z, up_x, up_y, up_z, projector)) {
+            return result;
+        }
+
+        // Any triangulation will do for a preview (usually the viewport's);
+        // only mesh faces that have none
+        bool needs_mesh = false;
+        for (TopExp_Explorer exp(shape.get(), TopAbs_FACE); exp.More() && !needs_mesh; exp.Next()) {
+            TopLoc_Location loc;
+            needs_mesh = BRep_Tool::Triangulation(TopoDS::Face(exp.Current()), loc).IsNull();
+        }
+        if (needs_mesh) {
+            cadhy::MeshCacheKey key;
+            key.linear_deflection = deflection > 0 ? deflection : 0.1;
+            if (!shape.mesh_cache().ensure(shape.get(), key, true)) return result;
+        }
+
+        Handle(HLRBRep_PolyAlgo) algo = new HLRBRep_PolyAlgo();
+        algo->Load(shape.get());
+        algo->Projector(projector);
+        algo->Update();
+
+        HLRBRep_PolyHLRToShape extractor;
+        extractor.Update(algo);
+
+        // Polygonal edges are straight segments; deflection is unused
+        append_hlr_compound(extractor.VCompound(), 0, deflection, result);
+        append_hlr_compound(extractor.HCompound(), 1, deflection, result);
+        append_hlr_compound(extractor.Rg1LineVCompound(), 2, deflection, result);
+        append_hlr_compound(extractor.Rg1LineHCompound(), 3, deflection, result);
+        append_hlr_compound(extractor.OutLineVCompound(), 4, deflection, result);
+        append_hlr_compound(extractor.OutLineHCompound(), 5, deflection, result);
+
+        finish_hlr_result_v2(result, scale);
+
+    } catch (const Standard_Failure& e) {
+        std::cerr << "[HLR-Poly] OCCT Exception: " << e.GetMessageString() << std::endl;
+        result = empty_hlr_result_v2();
+        finish_hlr_result_v2(result, 1.0);
+    } catch (...) {
+        result = empty_hlr_result_v2();
+        finish_hlr_result_v2(result, 1.0);
+    }
+
+    return result;
+}
+
+// Shared between an HlrJob and its (detached) worker thread
+struct HlrJob::State {
+    std::atomic<bool> cancelled{false};
+    std::mutex mutex;
+    std::condition_variable done_cv;
+    bool done = false;
+    bool taken = false;
+    HLRProjectionResultV2 result;
+};
+
+HlrJob::~HlrJob() {
+    // The worker owns a reference to the state, so it can outlive the job
+    state_->cancelled = true;
+}
+
+std::unique_ptr<HlrJob> start_hlr_projection(
+    const OcctShape& shape,
+    double dir_x, double dir_y, double dir_z,
+    double up_x, double up_y, double up_z,
+    double scale,
+    double deflection
+) {
+    auto state = std::make_shared<HlrJob::State>();
+    state->result = empty_hlr_result_v2();
+    finish_hlr_result_v2(state->result, 1.0);
+
+    HLRAlgo_Projector projector;
+    if (shape.is_null() ||
+        !make_hlr_projector(dir_x, dir_y, dir_z, up_x, up_y, up_z, projector)) {
+        state->done = true;
+        return std::make_unique<HlrJob>(state);
+    }
+    if (deflection <= 0) {
+        deflection = 0.01;
+    }
+
+    HlrCacheKey key;
+    TopoDS_Shape source;
+    try {
+        key = make_hlr_cache_key(shape.get(), dir_x, dir_y, dir_z, up_x, up_y, up_z, deflection);
+        if (auto cached = hlr_cache().get(key)) {
+            state->result = std::move(*cached);
+            finish_hlr_result_v2(state->result, scale);
+            state->done = true;
+            return std::make_unique<HlrJob>(state);
+        }
+
+        // Meshing the caller's shape (e.g. for a preview) appends polygons to
+        // the edge representations exact HLR walks, so the worker gets its own
+        // topology; geometry is shared, triangulations are not copied
+        BRepBuilderAPI_Copy copier(shape.get(), Standard_False, Standard_False);
+        source = copier.Shape();
+    } catch (const Standard_Failure& e) {
+        std::cerr << "[HLR-Job] OCCT Exception: " << e.GetMessageString() << std::endl;
+        state->done = true;
+        return std::make_unique<HlrJob>(state);
+    }
+
+    try {
+        std::thread([state, source, projector, key, scale, deflection]() {
+            HLRProjectionResultV2 result = empty_hlr_result_v2();
+            bool complete = false;
+            try {
+                complete = run_exact_hlr(source, projector, deflection, result, &state->cancelled);
+                if (complete) {
+                    hlr_cache().put(key, result, hlr_result_bytes(result));
+                }
+                finish_hlr_result_v2(result, scale);
+            } catch (const Standard_Failure& e) {
+                std::cerr << "[HLR-Job] OCCT Exception: " << e.GetMessageString() << std::endl;
+            } catch (...) {
+                std::cerr << "[HLR-Job] Unknown exception" << std::endl;
+            }
+
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (complete && !state->cancelled) {
+                state->result = std::move(result);
+            }
+            state->done = true;
+            state->done_cv.notify_all();
+        }).detach();
+    } catch (const std::system_error& e) {
+        std::cerr << "[HLR-Job] Could not start worker: " << e.what() << std::endl;
+        state->done = true;
+    }
+
+    return std::make_unique<HlrJob>(state);
+}
+
+bool hlr_job_is_ready(const HlrJob& job) {
+    HlrJob::State& state = job.state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.done || state.cancelled;
+}
+
+void hlr_job_cancel(const HlrJob& job) {
+    HlrJob::State& state = job.state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.cancelled = true;
+    state.done_cv.notify_all();
+}
+
+HLRProjectionResultV2 hlr_job_take_result(const HlrJob& job) {
+    HlrJob::State& state = job.state();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.done_cv.wait(lock, [&state]() { return state.done || state.cancelled.load(); });
+
+    HLRProjectionResultV2 result = empty_hlr_result_v2();
+    finish_hlr_result_v2(result, 1.0);
+    if (state.done && !state.cancelled && !state.taken) {
+        std::swap(result, state.result);
+        state.taken = true;
+    }
+    return result;
+}
+
 std::unique_ptr<OcctShape> compute_section(
     const OcctShape& shape,
     double origin_x, double origin_y, double origin_z,
@@ -3845,6 +5125,61 @@ std::unique_ptr<OcctShape> compute_section(
     }
 }
 
+static PlaneSectionFFI plane_section_from_result(const cadhy::projection::SectionResult& section) {
+    PlaneSectionFFI result;
+    result.outlines = static_cast<uint32_t>(section.outlines.size());
+    result.outline_length = 0.0;
+    for (const auto& outline : section.outlines) {
+        for (size_t i = 1; i < outline.points.size(); ++i) {
+            result.outline_length += std::hypot(outline.points[i].first - outline.points[i - 1].first,
+                                                outline.points[i].second - outline.points[i - 1].second);
+        }
+    }
+    result.is_closed = section.is_closed;
+    result.area = section.section_area;
+    result.centroid_x = section.centroid.x;
+    result.centroid_y = section.centroid.y;
+    result.centroid_z = section.centroid.z;
+    return result;
+}
+
+PlaneSectionFFI section_by_plane(
+    const OcctShape& shape,
+    double origin_x, double origin_y, double origin_z,
+    double normal_x, double normal_y, double normal_z
+) {
+    try {
+        return plane_section_from_result(cadhy::projection::section_by_plane(
+            shape, cadhy::projection::SectionPlane{
+                cadhy::Point3D{origin_x, origin_y, origin_z},
+                cadhy::Vector3D{normal_x, normal_y, normal_z}}));
+    } catch (const Standard_Failure& e) {
+        std::cerr << "section_by_plane exception: " << e.GetMessageString() << std::endl;
+        return plane_section_from_result(cadhy::projection::SectionResult{});
+    }
+}
+
+rust::Vec<PlaneSectionFFI> sections_at_offsets(
+    const OcctShape& shape,
+    double normal_x, double normal_y, double normal_z,
+    rust::Slice<const double> offsets
+) {
+    rust::Vec<PlaneSectionFFI> result;
+    try {
+        std::vector<cadhy::projection::SectionResult> sections = cadhy::projection::sections_at_offsets(
+            shape, cadhy::Vector3D{normal_x, normal_y, normal_z},
+            std::vector<double>(offsets.begin(), offsets.end()));
+        result.reserve(sections.size());
+        for (const auto& section : sections) {
+            result.push_back(plane_section_from_result(section));
+        }
+    } catch (const Standard_Failure& e) {
+        std::cerr << "sections_at_offsets exception: " << e.GetMessageString() << std::endl;
+        result.clear();
+    }
+    return result;
+}
+
 // ============================================================
 // SECTION WITH HATCHING FOR TECHNICAL DRAWINGS
 // ============================================================
@@ -3863,93 +5198,6 @@ static void project_point_to_plane(
     y2d = v.Dot(gp_Vec(yAxis));
 }
 
-// Helper: Generate hatch lines for a closed polygon
-static void generate_hatch_lines_for_region(
-    const std::vector<std::pair<double, double>>& boundary,
-    double angle_deg,
-    double spacing,
-    rust::Vec<HatchLineFFI>& hatch_lines,
-    double min_x, double min_y,
-    double max_x, double max_y
-) {
-    if (boundary.size() < 3 || spacing <= 0) return;
-
-    double angle_rad = angle_deg * M_PI / 180.0;
-    double cos_a = std::cos(angle_rad);
-    double sin_a = std::sin(angle_rad);
-
-    // Calculate the range needed for hatch lines
-    // Extend bbox to ensure we cover rotated hatches
-    double diag = std::sqrt(std::pow(max_x - min_x, 2) + std::pow(max_y - min_y, 2));
-    double cx = (min_x + max_x) / 2.0;
-    double cy = (min_y + max_y) / 2.0;
-
-    // Number of hatch lines needed
-    int num_lines = static_cast<int>(diag / spacing) + 2;
-
-    // For each potential hatch line
-    for (int i = -num_lines; i <= num_lines; i++) {
-        double offset = i * spacing;
-
-        // Hatch line passes through this point with direction (cos_a, sin_a)
-        double hx = cx + offset * sin_a;
-        double hy = cy - offset * cos_a;
-
-        // Find intersections with all polygon edges
-        std::vector<double> intersections;
-
-        size_t n = boundary.size();
-        for (size_t j = 0; j < n; j++) {
-            size_t k = (j + 1) % n;
-
-            double x1 = boundary[j].first;
-            double y1 = boundary[j].second;
-            double x2 = boundary[k].first;
-            double y2 = boundary[k].second;
-
-            // Edge direction
-            double dx = x2 - x1;
-            double dy = y2 - y1;
-
-            // Parametric intersection
-            double denom = dx * sin_a - dy * cos_a;
-            if (std::abs(denom) < 1e-10) continue;  // Parallel
-
-            double t_edge = ((hx - x1) * sin_a - (hy - y1) * cos_a) / denom;
-
-            if (t_edge >= 0.0 && t_edge <= 1.0) {
-                // Find parameter along hatch line
-                double ix = x1 + t_edge * dx;
-                double iy = y1 + t_edge * dy;
-                double t_hatch = (ix - hx) * cos_a + (iy - hy) * sin_a;
-                intersections.push_back(t_hatch);
-            }
-        }
-
-        // Sort intersections and pair them up
-        std::sort(intersections.begin(), intersections.end());
-
-        // Create hatch line segments (every other pair)
-        for (size_t j = 0; j + 1 < intersections.size(); j += 2) {
-            double t1 = intersections[j];
-            double t2 = intersections[j + 1];
-
-            HatchLineFFI line;
-            line.start_x = hx + t1 * cos_a;
-            line.start_y = hy + t1 * sin_a;
-            line.end_x = hx + t2 * cos_a;
-            line.end_y = hy + t2 * sin_a;
-
-            // Skip very short lines
-            double len = std::sqrt(std::pow(line.end_x - line.start_x, 2) +
-                                   std::pow(line.end_y - line.start_y, 2));
-            if (len > 1e-6) {
-                hatch_lines.push_back(line);
-            }
-        }
-    }
-}
-
 // Helper: Calculate signed area of a polygon (positive = CCW)
 static double polygon_signed_area(const std::vector<std::pair<double, double>>& pts) {
     double area = 0.0;
@@ -3962,6 +5210,121 @@ static double polygon_signed_area(const std::vector<std::pair<double, double>>&
     return area / 2.0;
 }
 
+// Helper: Add a region for a closed section boundary; its hatch lines are
+// filled in by hatch_section_regions once every loop is known
+static void append_section_region(
+    SectionWithHatchResult& result,
+    const std::vector<std::pair<double, double>>& boundary
+) {
+    HatchRegionFFI region;
+    region.area = std::abs(polygon_signed_area(boundary));
+    region.is_outer = polygon_signed_area(boundary) > 0;  // CCW = outer
+
+    // Copy boundary points
+    for (const auto& p : boundary) {
+        TessPoint2D tp;
+        tp.x = p.first;
+        tp.y = p.second;
+        region.boundary.push_back(tp);
+    }
+
+    result.regions.push_back(std::move(region));
+}
+
+// Helper: Even-odd point in polygon test against [x0,y0, x1,y1, ...]
+static bool point_in_ring(const std::vector<double>& ring, double x, double y) {
+    bool inside = false;
+    const size_t n = ring.size() / 2;
+    for (size_t i = 0, j = n - 1; i < n; j = i++) {
+        const double xi = ring[2 * i], yi = ring[2 * i + 1];
+        const double xj = ring[2 * j], yj = ring[2 * j + 1];
+        if ((yi > y) != (yj > y) && x < xi + (y - yi) * (xj - xi) / (yj - yi)) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+// Helper: Hatch all regions of a section in one even-odd pass, so holes and
+// islands inside holes come out right. Each segment goes to the innermost
+// region containing its midpoint. Lines are anchored at the centre of the
+// result's bounding box, which must already include every boundary.
+static void hatch_section_regions(
+    SectionWithHatchResult& result,
+    double angle_deg,
+    double spacing
+) {
+    if (result.regions.empty() || spacing <= 0) return;
+
+    // Region rings and bounds, tested smallest first so the first hit is
+    // the innermost region
+    struct RegionRing {
+        std::vector<double> points;
+        double min_x, min_y, max_x, max_y;
+        size_t region;
+    };
+    std::vector<RegionRing> rings;
+    rings.reserve(result.regions.size());
+    for (size_t r = 0; r < result.regions.size(); r++) {
+        const HatchRegionFFI& region = result.regions[r];
+        RegionRing ring;
+        ring.region = r;
+        ring.min_x = ring.min_y = std::numeric_limits<double>::max();
+        ring.max_x = ring.max_y = std::numeric_limits<double>::lowest();
+        ring.points.reserve(region.boundary.size() * 2);
+        for (const TessPoint2D& p : region.boundary) {
+            ring.points.push_back(p.x);
+            ring.points.push_back(p.y);
+            ring.min_x = std::min(ring.min_x, p.x);
+            ring.min_y = std::min(ring.min_y, p.y);
+            ring.max_x = std::max(ring.max_x, p.x);
+            ring.max_y = std::max(ring.max_y, p.y);
+        }
+        rings.push_back(std::move(ring));
+    }
+    std::sort(rings.begin(), rings.end(), [&](const RegionRing& a, const RegionRing& b) {
+        return result.regions[a.region].area < result.regions[b.region].area;
+    });
+
+    std::vector<cadhy::projection::HatchRing> hatchRings;
+    hatchRings.reserve(rings.size());
+    for (const RegionRing& ring : rings) {
+        hatchRings.push_back({ring.points.data(), ring.points.size() / 2});
+    }
+
+    cadhy::projection::HatchOptions options;
+    options.angle_deg = angle_deg;
+    options.spacing = spacing;
+    options.anchor_x = (result.min_x + result.max_x) / 2.0;
+    options.anchor_y = (result.min_y + result.max_y) / 2.0;
+    options.rule = cadhy::projection::FillRule::EvenOdd;
+
+    size_t emitted = cadhy::projection::hatch_rings(hatchRings, options,
+        [&](const cadhy::projection::HatchSegment& segment) {
+            const double mx = 0.5 * (segment.x0 + segment.x1);
+            const double my = 0.5 * (segment.y0 + segment.y1);
+
+            // Largest region if rounding puts the midpoint on no boundary
+            size_t target = rings.back().region;
+            for (const RegionRing& ring : rings) {
+                if (mx < ring.min_x || mx > ring.max_x || my < ring.min_y || my > ring.max_y) continue;
+                if (point_in_ring(ring.points, mx, my)) {
+                    target = ring.region;
+                    break;
+                }
+            }
+
+            HatchLineFFI line;
+            line.start_x = segment.x0;
+            line.start_y = segment.y0;
+            line.end_x = segment.x1;
+            line.end_y = segment.y1;
+            result.regions[target].hatch_lines.push_back(line);
+        });
+
+    result.num_hatch_lines += static_cast<int32_t>(emitted);
+}
+
 SectionWithHatchResult compute_section_with_hatch(
     const OcctShape& shape,
     double origin_x, double origin_y, double origin_z,
@@ -4056,54 +5419,163 @@ SectionWithHatchResult compute_section_with_hatch(
 
             if (boundary.size() >= 3) {
                 result.curves.push_back(std::move(curve));
+                append_section_region(result, boundary);
+            }
+        }
 
-                // Create hatch region
-                HatchRegionFFI region;
-                region.area = std::abs(polygon_signed_area(boundary));
-                region.is_outer = polygon_signed_area(boundary) > 0;  // CCW = outer
-
-                // Copy boundary points
-                for (const auto& p : boundary) {
-                    TessPoint2D tp;
-                    tp.x = p.first;
-                    tp.y = p.second;
-                    region.boundary.push_back(tp);
-                }
+        // Process open wires (just curves, no hatching)
+        for (TopExp_Explorer exp(openWires, TopAbs_WIRE); exp.More(); exp.Next()) {
+            TopoDS_Wire wire = TopoDS::Wire(exp.Current());
+            openCount++;
+
+            SectionCurveFFI curve;
+            curve.is_closed = false;
+
+            for (BRepTools_WireExplorer wexp(wire); wexp.More(); wexp.Next()) {
+                TopoDS_Vertex v1 = wexp.CurrentVertex();
+                gp_Pnt pt = BRep_Tool::Pnt(v1);
+
+                double x2d, y2d;
+                project_point_to_plane(pt, origin, xAxis, yAxis, x2d, y2d);
+
+                TessPoint2D tp;
+                tp.x = x2d;
+                tp.y = y2d;
+                curve.points.push_back(tp);
+
+                result.min_x = std::min(result.min_x, x2d);
+                result.min_y = std::min(result.min_y, y2d);
+                result.max_x = std::max(result.max_x, x2d);
+                result.max_y = std::max(result.max_y, y2d);
+            }
+
+            if (curve.points.size() >= 2) {
+                result.curves.push_back(std::move(curve));
+            }
+        }
+
+        result.num_regions = closedCount;
+        hatch_section_regions(result, hatch_angle, hatch_spacing);
+
+        std::cerr << "[Section] Found " << closedCount << " closed wires, "
+                  << openCount << " open wires, "
+                  << result.num_hatch_lines << " hatch lines" << std::endl;
+
+        // Handle empty result
+        if (result.curves.empty()) {
+            result.min_x = 0;
+            result.min_y = 0;
+            result.max_x = 0;
+            result.max_y = 0;
+        }
+
+    } catch (const Standard_Failure& e) {
+        std::cerr << "[Section] OCCT Exception: " << e.GetMessageString() << std::endl;
+        result.min_x = 0;
+        result.min_y = 0;
+        result.max_x = 0;
+        result.max_y = 0;
+    } catch (const std::exception& e) {
+        std::cerr << "[Section] C++ Exception: " << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "[Section] Unknown exception" << std::endl;
+    }
+
+    return result;
+}
+
+// ============================================================
+// FAST MESH SECTION FOR INTERACTIVE CLIPPING PLANES
+// ============================================================
+
+std::unique_ptr<SectionSlicer> create_section_slicer(const OcctShape& shape, double deflection) {
+    try {
+        if (shape.is_null()) return nullptr;
+        if (!shape.mesh_cache().ensure(shape.get(), cadhy::MeshCacheKey{deflection, 0.5, false})) return nullptr;
+
+        // A crease angle of pi merges every corner, so section loops chain
+        // across sharp edges too
+        cadhy::mesh::WeldedMesh welded = cadhy::mesh::weld_triangulation(shape.get(), M_PI);
+        if (welded.triangles.empty()) return nullptr;
+
+        std::vector<float> positions;
+        positions.reserve(welded.positions.size() * 3);
+        for (const auto& p : welded.positions) {
+            positions.push_back(static_cast<float>(p.x));
+            positions.push_back(static_cast<float>(p.y));
+            positions.push_back(static_cast<float>(p.z));
+        }
+        std::vector<uint32_t> indices;
+        indices.reserve(welded.triangles.size() * 3);
+        for (const auto& t : welded.triangles) {
+            indices.push_back(t.v0);
+            indices.push_back(t.v1);
+            indices.push_back(t.v2);
+        }
+
+        return std::make_unique<SectionSlicer>(std::make_unique<cadhy::mesh::MeshSlicer>(
+            positions.data(), welded.positions.size(), indices.data(), welded.triangles.size()));
+    } catch (const Standard_Failure& e) {
+        std::cerr << "[Section] OCCT Exception: " << e.GetMessageString() << std::endl;
+        return nullptr;
+    } catch (...) {
+        return nullptr;
+    }
+}
 
-                // Generate hatch lines for this region
-                generate_hatch_lines_for_region(
-                    boundary,
-                    hatch_angle,
-                    hatch_spacing,
-                    region.hatch_lines,
-                    result.min_x, result.min_y,
-                    result.max_x, result.max_y
-                );
+SectionWithHatchResult compute_section_with_hatch_fast(
+    const SectionSlicer& slicer,
+    double origin_x, double origin_y, double origin_z,
+    double normal_x, double normal_y, double normal_z,
+    double up_x, double up_y, double up_z,
+    double hatch_angle,
+    double hatch_spacing
+) {
+    SectionWithHatchResult result;
+    result.curves = rust::Vec<SectionCurveFFI>();
+    result.regions = rust::Vec<HatchRegionFFI>();
+    result.min_x = std::numeric_limits<double>::max();
+    result.min_y = std::numeric_limits<double>::max();
+    result.max_x = std::numeric_limits<double>::lowest();
+    result.max_y = std::numeric_limits<double>::lowest();
+    result.num_regions = 0;
+    result.num_hatch_lines = 0;
 
-                result.num_hatch_lines += region.hatch_lines.size();
-                result.regions.push_back(std::move(region));
-            }
+    try {
+        // Same 2D frame as compute_section_with_hatch
+        gp_Dir normal(normal_x, normal_y, normal_z);
+        gp_Dir upDir(up_x, up_y, up_z);
+        gp_Dir xAxis;
+        try {
+            xAxis = upDir.Crossed(normal);
+        } catch (...) {
+            xAxis = gp_Dir(1, 0, 0);
         }
+        gp_Dir yAxis = normal.Crossed(xAxis);
 
-        // Process open wires (just curves, no hatching)
-        for (TopExp_Explorer exp(openWires, TopAbs_WIRE); exp.More(); exp.Next()) {
-            TopoDS_Wire wire = TopoDS::Wire(exp.Current());
-            openCount++;
+        cadhy::mesh::SlicePlane plane{
+            {origin_x, origin_y, origin_z},
+            {normal.X(), normal.Y(), normal.Z()},
+            {xAxis.X(), xAxis.Y(), xAxis.Z()},
+            {yAxis.X(), yAxis.Y(), yAxis.Z()}
+        };
+        std::vector<cadhy::mesh::SliceLoop> loops = slicer.slicer().slice(plane);
 
+        int closedCount = 0;
+        for (const auto& loop : loops) {
+            std::vector<std::pair<double, double>> boundary;
             SectionCurveFFI curve;
-            curve.is_closed = false;
-
-            for (BRepTools_WireExplorer wexp(wire); wexp.More(); wexp.Next()) {
-                TopoDS_Vertex v1 = wexp.CurrentVertex();
-                gp_Pnt pt = BRep_Tool::Pnt(v1);
+            curve.is_closed = loop.closed;
 
-                double x2d, y2d;
-                project_point_to_plane(pt, origin, xAxis, yAxis, x2d, y2d);
+            for (size_t i = 0; i + 1 < loop.points.size(); i += 2) {
+                double x2d = loop.points[i];
+                double y2d = loop.points[i + 1];
 
                 TessPoint2D tp;
                 tp.x = x2d;
                 tp.y = y2d;
                 curve.points.push_back(tp);
+                boundary.push_back({x2d, y2d});
 
                 result.min_x = std::min(result.min_x, x2d);
                 result.min_y = std::min(result.min_y, y2d);
@@ -4111,37 +5583,34 @@ SectionWithHatchResult compute_section_with_hatch(
                 result.max_y = std::max(result.max_y, y2d);
             }
 
-            if (curve.points.size() >= 2) {
+            if (loop.closed) {
+                closedCount++;
+                if (boundary.size() >= 3) {
+                    result.curves.push_back(std::move(curve));
+                    append_section_region(result, boundary);
+                }
+            } else if (curve.points.size() >= 2) {
                 result.curves.push_back(std::move(curve));
             }
         }
 
         result.num_regions = closedCount;
-
-        std::cerr << "[Section] Found " << closedCount << " closed wires, "
-                  << openCount << " open wires, "
-                  << result.num_hatch_lines << " hatch lines" << std::endl;
-
-        // Handle empty result
-        if (result.curves.empty()) {
-            result.min_x = 0;
-            result.min_y = 0;
-            result.max_x = 0;
-            result.max_y = 0;
-        }
-
+        hatch_section_regions(result, hatch_angle, hatch_spacing);
     } catch (const Standard_Failure& e) {
         std::cerr << "[Section] OCCT Exception: " << e.GetMessageString() << std::endl;
-        result.min_x = 0;
-        result.min_y = 0;
-        result.max_x = 0;
-        result.max_y = 0;
     } catch (const std::exception& e) {
         std::cerr << "[Section] C++ Exception: " << e.what() << std::endl;
     } catch (...) {
         std::cerr << "[Section] Unknown exception" << std::endl;
     }
 
+    if (result.curves.empty()) {
+        result.min_x = 0;
+        result.min_y = 0;
+        result.max_x = 0;
+        result.max_y = 0;
+    }
+
     return result;
 }
 
@@ -4198,6 +5667,221 @@ rust::Vec<VertexInfo> get_topology_vertices(const OcctShape& shape) {
     return result;
 }
 
+// Per-face geometry shared by get_full_topology and the topology snapshot
+struct FaceTopologySlot {
+    int32_t surface_type = 10;
+    double area = 0.0;
+    double center[3] = {0.0, 0.0, 0.0};
+    double normal[3] = {0.0, 0.0, 1.0};
+};
+
+// Surface type code, area, mass center and normal at the UV mid-point
+// (flipped for reversed faces)
+static void analyze_topology_face(const TopoDS_Face& face, FaceTopologySlot& slot) {
+    BRepAdaptor_Surface adaptor(face);
+    switch (adaptor.GetType()) {
+        case GeomAbs_Plane: slot.surface_type = 0; break;
+        case GeomAbs_Cylinder: slot.surface_type = 1; break;
+        case GeomAbs_Cone: slot.surface_type = 2; break;
+        case GeomAbs_Sphere: slot.surface_type = 3; break;
+        case GeomAbs_Torus: slot.surface_type = 4; break;
+        case GeomAbs_BezierSurface: slot.surface_type = 5; break;
+        case GeomAbs_BSplineSurface: slot.surface_type = 6; break;
+        case GeomAbs_SurfaceOfRevolution: slot.surface_type = 7; break;
+        case GeomAbs_SurfaceOfExtrusion: slot.surface_type = 8; break;
+        case GeomAbs_OffsetSurface: slot.surface_type = 9; break;
+        default: slot.surface_type = 10; break;
+    }
+
+    GProp_GProps props;
+    BRepGProp::SurfaceProperties(face, props);
+    slot.area = props.Mass();
+    gp_Pnt center = props.CentreOfMass();
+    slot.center[0] = center.X();
+    slot.center[1] = center.Y();
+    slot.center[2] = center.Z();
+
+    double uMid = (adaptor.FirstUParameter() + adaptor.LastUParameter()) / 2.0;
+    double vMid = (adaptor.FirstVParameter() + adaptor.LastVParameter()) / 2.0;
+    gp_Pnt pnt;
+    gp_Vec d1u, d1v;
+    adaptor.D1(uMid, vMid, pnt, d1u, d1v);
+
+    gp_Vec normal = d1u.Crossed(d1v);
+    if (normal.Magnitude() > 1e-10) {
+        normal.Normalize();
+        if (face.Orientation() == TopAbs_REVERSED) {
+            normal.Reverse();
+        }
+    } else {
+        normal = gp_Vec(0, 0, 1); // fallback
+    }
+    slot.normal[0] = normal.X();
+    slot.normal[1] = normal.Y();
+    slot.normal[2] = normal.Z();
+}
+
+// Per-edge slot for wireframe tessellation. Slots are filled concurrently and
+// copied into the rust::Vec output in edge order afterwards.
+struct EdgeTessellationSlot {
+    int32_t curve_type = 8;
+    uint32_t start_vertex = 0;
+    uint32_t end_vertex = 0;
+    double length = 0.0;
+    bool is_degenerated = false;
+    std::vector<EdgePoint> points;
+    std::vector<uint32_t> adjacent_faces;
+    bool ok = false;
+};
+
+// Below this many edges the thread dispatch costs more than it saves
+static const size_t PARALLEL_TESSELLATE_MIN_EDGES = 256;
+
+// Curve type code of EdgeTessellation
+static int32_t edge_curve_type(GeomAbs_CurveType curveType) {
+    switch (curveType) {
+        case GeomAbs_Line: return 0;
+        case GeomAbs_Circle: return 1;
+        case GeomAbs_Ellipse: return 2;
+        case GeomAbs_Hyperbola: return 3;
+        case GeomAbs_Parabola: return 4;
+        case GeomAbs_BezierCurve: return 5;
+        case GeomAbs_BSplineCurve: return 6;
+        case GeomAbs_OffsetCurve: return 7;
+        default: return 8;
+    }
+}
+
+// Discretise a non-degenerated edge (GCPnts_TangentialDeflection) and
+// return its curve type code. The length is exact for lines and circles and
+// taken from the discretisation otherwise (within the deflection), which
+// avoids a BRepGProp integration per edge.
+static int32_t discretize_edge(
+    const TopoDS_Edge& edge,
+    double deflection,
+    std::vector<EdgePoint>& points,
+    double& length
+) {
+    BRepAdaptor_Curve adaptor(edge);
+    GeomAbs_CurveType curveType = adaptor.GetType();
+
+    double firstParam = adaptor.FirstParameter();
+    double lastParam = adaptor.LastParameter();
+    double totalParam = lastParam - firstParam;
+
+    // Adapts point density to curvature (deflection, angular deflection)
+    GCPnts_TangentialDeflection tessellator(adaptor, deflection, 0.1);
+    if (tessellator.NbPoints() > 0) {
+        points.reserve(tessellator.NbPoints());
+        for (int j = 1; j <= tessellator.NbPoints(); j++) {
+            gp_Pnt pnt = tessellator.Value(j);
+            double param = tessellator.Parameter(j);
+            points.push_back(EdgePoint{pnt.X(), pnt.Y(), pnt.Z(),
+                (totalParam > 1e-10) ? (param - firstParam) / totalParam : 0.0});
+        }
+    } else {
+        // Fallback: just use start and end points
+        gp_Pnt startPt = adaptor.Value(firstParam);
+        gp_Pnt endPt = adaptor.Value(lastParam);
+        points.push_back(EdgePoint{startPt.X(), startPt.Y(), startPt.Z(), 0.0});
+        points.push_back(EdgePoint{endPt.X(), endPt.Y(), endPt.Z(), 1.0});
+    }
+
+    length = 0.0;
+    if (curveType == GeomAbs_Line) {
+        length = adaptor.Value(firstParam).Distance(adaptor.Value(lastParam));
+    } else if (curveType == GeomAbs_Circle) {
+        length = adaptor.Circle().Radius() * std::abs(totalParam);
+    } else {
+        for (size_t j = 1; j < points.size(); j++) {
+            const EdgePoint& p = points[j - 1];
+            const EdgePoint& q = points[j];
+            length += std::sqrt((q.x - p.x) * (q.x - p.x) + (q.y - p.y) * (q.y - p.y) +
+                                (q.z - p.z) * (q.z - p.z));
+        }
+    }
+
+    return edge_curve_type(curveType);
+}
+
+// Tessellate one edge into its slot
+static void tessellate_edge_slot(
+    const TopoDS_Edge& edge,
+    double deflection,
+    const TopTools_IndexedMapOfShape& vertexMap,
+    const TopTools_IndexedMapOfShape& faceMap,
+    const TopTools_IndexedDataMapOfShapeListOfShape& edgeFaceMap,
+    EdgeTessellationSlot& slot
+) {
+    slot.is_degenerated = BRep_Tool::Degenerated(edge);
+
+    TopoDS_Vertex v1, v2;
+    TopExp::Vertices(edge, v1, v2);
+    slot.start_vertex = v1.IsNull() ? 0 : static_cast<uint32_t>(vertexMap.FindIndex(v1) - 1);
+    slot.end_vertex = v2.IsNull() ? 0 : static_cast<uint32_t>(vertexMap.FindIndex(v2) - 1);
+
+    if (!slot.is_degenerated) {
+        slot.curve_type = discretize_edge(edge, deflection, slot.points, slot.length);
+    }
+
+    if (edgeFaceMap.Contains(edge)) {
+        const TopTools_ListOfShape& faces = edgeFaceMap.FindFromKey(edge);
+        for (TopTools_ListIteratorOfListOfShape faceIt(faces); faceIt.More(); faceIt.Next()) {
+            int faceIdx = faceMap.FindIndex(faceIt.Value());
+            if (faceIdx > 0) {
+                slot.adjacent_faces.push_back(static_cast<uint32_t>(faceIdx - 1));
+            }
+        }
+    }
+
+    slot.ok = true;
+}
+
+// Tessellate every edge of `edgeMap` concurrently. Returns the number of
+// leading slots that succeeded; like the serial walk this replaces, output
+// stops at the first edge that throws.
+static size_t tessellate_edge_slots(
+    const TopTools_IndexedMapOfShape& edgeMap,
+    const TopTools_IndexedMapOfShape& vertexMap,
+    const TopTools_IndexedMapOfShape& faceMap,
+    const TopTools_IndexedDataMapOfShapeListOfShape& edgeFaceMap,
+    double deflection,
+    std::vector<EdgeTessellationSlot>& slots
+) {
+    slots.assign(static_cast<size_t>(edgeMap.Extent()), EdgeTessellationSlot());
+
+    OSD_Parallel::For(0, edgeMap.Extent(), [&](int i) {
+        try {
+            tessellate_edge_slot(TopoDS::Edge(edgeMap(i + 1)), deflection,
+                                 vertexMap, faceMap, edgeFaceMap, slots[i]);
+        } catch (...) {
+            slots[i].ok = false;
+        }
+    }, slots.size() < PARALLEL_TESSELLATE_MIN_EDGES);
+
+    size_t emitted = 0;
+    while (emitted < slots.size() && slots[emitted].ok) emitted++;
+    return emitted;
+}
+
+// EdgeTessellation for a filled slot
+static EdgeTessellation edge_tessellation_from_slot(uint32_t index, const EdgeTessellationSlot& slot) {
+    EdgeTessellation edgeTess;
+    edgeTess.index = index;
+    edgeTess.curve_type = slot.curve_type;
+    edgeTess.start_vertex = slot.start_vertex;
+    edgeTess.end_vertex = slot.end_vertex;
+    edgeTess.length = slot.length;
+    edgeTess.is_degenerated = slot.is_degenerated;
+    edgeTess.points = rust::Vec<EdgePoint>();
+    edgeTess.points.reserve(slot.points.size());
+    for (const EdgePoint& p : slot.points) edgeTess.points.push_back(p);
+    edgeTess.adjacent_faces = rust::Vec<uint32_t>();
+    edgeTess.adjacent_faces.reserve(slot.adjacent_faces.size());
+    for (uint32_t f : slot.adjacent_faces) edgeTess.adjacent_faces.push_back(f);
+    return edgeTess;
+}
+
 rust::Vec<EdgeTessellation> tessellate_edges(const OcctShape& shape, double deflection) {
     rust::Vec<EdgeTessellation> result;
 
@@ -4216,109 +5900,14 @@ rust::Vec<EdgeTessellation> tessellate_edges(const OcctShape& shape, double defl
         TopTools_IndexedDataMapOfShapeListOfShape edgeFaceMap;
         TopExp::MapShapesAndAncestors(shape.get(), TopAbs_EDGE, TopAbs_FACE, edgeFaceMap);
 
-        // Process each edge
-        for (int i = 1; i <= edgeMap.Extent(); i++) {
-            const TopoDS_Edge& edge = TopoDS::Edge(edgeMap(i));
-
-            EdgeTessellation edgeTess;
-            edgeTess.index = static_cast<uint32_t>(i - 1); // 0-based
-            edgeTess.is_degenerated = BRep_Tool::Degenerated(edge);
-            edgeTess.points = rust::Vec<EdgePoint>();
-            edgeTess.adjacent_faces = rust::Vec<uint32_t>();
-
-            // Get edge vertices
-            TopoDS_Vertex v1, v2;
-            TopExp::Vertices(edge, v1, v2);
-
-            // Find vertex indices
-            edgeTess.start_vertex = v1.IsNull() ? 0 : static_cast<uint32_t>(vertexMap.FindIndex(v1) - 1);
-            edgeTess.end_vertex = v2.IsNull() ? 0 : static_cast<uint32_t>(vertexMap.FindIndex(v2) - 1);
-
-            // Get edge length
-            GProp_GProps props;
-            BRepGProp::LinearProperties(edge, props);
-            edgeTess.length = props.Mass();
-
-            // Get curve type and tessellate
-            if (!edgeTess.is_degenerated) {
-                BRepAdaptor_Curve adaptor(edge);
-                GeomAbs_CurveType curveType = adaptor.GetType();
-
-                // Map curve type to our enum
-                switch (curveType) {
-                    case GeomAbs_Line: edgeTess.curve_type = 0; break;
-                    case GeomAbs_Circle: edgeTess.curve_type = 1; break;
-                    case GeomAbs_Ellipse: edgeTess.curve_type = 2; break;
-                    case GeomAbs_Hyperbola: edgeTess.curve_type = 3; break;
-                    case GeomAbs_Parabola: edgeTess.curve_type = 4; break;
-                    case GeomAbs_BezierCurve: edgeTess.curve_type = 5; break;
-                    case GeomAbs_BSplineCurve: edgeTess.curve_type = 6; break;
-                    case GeomAbs_OffsetCurve: edgeTess.curve_type = 7; break;
-                    default: edgeTess.curve_type = 8; break;
-                }
-
-                // Tessellate the curve
-                double firstParam = adaptor.FirstParameter();
-                double lastParam = adaptor.LastParameter();
-
-                // Use GCPnts_TangentialDeflection for high-quality tessellation
-                // It adapts point density based on curvature
-                GCPnts_TangentialDeflection tessellator(adaptor, deflection, 0.1); // deflection, angular deflection
-
-                if (tessellator.NbPoints() > 0) {
-                    double totalParam = lastParam - firstParam;
-                    for (int j = 1; j <= tessellator.NbPoints(); j++) {
-                        double param = tessellator.Parameter(j);
-                        gp_Pnt pnt = tessellator.Value(j);
-
-                        EdgePoint ep;
-                        ep.x = pnt.X();
-                        ep.y = pnt.Y();
-                        ep.z = pnt.Z();
-                        ep.parameter = (totalParam > 1e-10) ? (param - firstParam) / totalParam : 0.0;
-
-                        edgeTess.points.push_back(ep);
-                    }
-                } else {
-                    // Fallback: just use start and end points
-                    gp_Pnt startPt = adaptor.Value(firstParam);
-                    gp_Pnt endPt = adaptor.Value(lastParam);
-
-                    EdgePoint ep1;
-                    ep1.x = startPt.X();
-                    ep1.y = startPt.Y();
-                    ep1.z = startPt.Z();
-                    ep1.parameter = 0.0;
-                    edgeTess.points.push_back(ep1);
-
-                    EdgePoint ep2;
-                    ep2.x = endPt.X();
-                    ep2.y = endPt.Y();
-                    ep2.z = endPt.Z();
-                    ep2.parameter = 1.0;
-                    edgeTess.points.push_back(ep2);
-                }
-            } else {
-                edgeTess.curve_type = 8; // Other/degenerated
-            }
-
-            // Get adjacent faces
-            if (edgeFaceMap.Contains(edge)) {
-                const TopTools_ListOfShape& faces = edgeFaceMap.FindFromKey(edge);
-                TopTools_ListIteratorOfListOfShape faceIt(faces);
-                for (; faceIt.More(); faceIt.Next()) {
-                    int faceIdx = faceMap.FindIndex(faceIt.Value());
-                    if (faceIdx > 0) {
-                        edgeTess.adjacent_faces.push_back(static_cast<uint32_t>(faceIdx - 1));
-                    }
-                }
-            }
+        std::vector<EdgeTessellationSlot> slots;
+        size_t emitted = tessellate_edge_slots(edgeMap, vertexMap, faceMap, edgeFaceMap, deflection, slots);
 
-            result.push_back(edgeTess);
+        result.reserve(emitted);
+        for (size_t i = 0; i < emitted; i++) {
+            result.push_back(edge_tessellation_from_slot(static_cast<uint32_t>(i), slots[i]));
         }
 
-        std::cerr << "[Topology] Tessellated " << result.size() << " edges" << std::endl;
-
     } catch (const Standard_Failure& e) {
         std::cerr << "[Topology] OCCT Exception in tessellate_edges: " << e.GetMessageString() << std::endl;
     } catch (...) {
@@ -4402,100 +5991,25 @@ TopologyResult get_full_topology(const OcctShape& shape, double edge_deflection)
         // =====================
         // Tessellate edges
         // =====================
-        result.edge_to_faces_offset.push_back(0);
-        for (int i = 1; i <= edgeMap.Extent(); i++) {
-            const TopoDS_Edge& edge = TopoDS::Edge(edgeMap(i));
-
-            EdgeTessellation edgeTess;
-            edgeTess.index = static_cast<uint32_t>(i - 1);
-            edgeTess.is_degenerated = BRep_Tool::Degenerated(edge);
-            edgeTess.points = rust::Vec<EdgePoint>();
-            edgeTess.adjacent_faces = rust::Vec<uint32_t>();
-
-            // Get vertices
-            TopoDS_Vertex v1, v2;
-            TopExp::Vertices(edge, v1, v2);
-            edgeTess.start_vertex = v1.IsNull() ? 0 : static_cast<uint32_t>(vertexMap.FindIndex(v1) - 1);
-            edgeTess.end_vertex = v2.IsNull() ? 0 : static_cast<uint32_t>(vertexMap.FindIndex(v2) - 1);
-
-            // Get length
-            GProp_GProps props;
-            BRepGProp::LinearProperties(edge, props);
-            edgeTess.length = props.Mass();
-
-            // Tessellate if not degenerated
-            if (!edgeTess.is_degenerated) {
-                BRepAdaptor_Curve adaptor(edge);
-                GeomAbs_CurveType curveType = adaptor.GetType();
-
-                switch (curveType) {
-                    case GeomAbs_Line: edgeTess.curve_type = 0; break;
-                    case GeomAbs_Circle: edgeTess.curve_type = 1; break;
-                    case GeomAbs_Ellipse: edgeTess.curve_type = 2; break;
-                    case GeomAbs_Hyperbola: edgeTess.curve_type = 3; break;
-                    case GeomAbs_Parabola: edgeTess.curve_type = 4; break;
-                    case GeomAbs_BezierCurve: edgeTess.curve_type = 5; break;
-                    case GeomAbs_BSplineCurve: edgeTess.curve_type = 6; break;
-                    case GeomAbs_OffsetCurve: edgeTess.curve_type = 7; break;
-                    default: edgeTess.curve_type = 8; break;
-                }
-
-                double firstParam = adaptor.FirstParameter();
-                double lastParam = adaptor.LastParameter();
-
-                GCPnts_TangentialDeflection tessellator(adaptor, edge_deflection, 0.1);
-
-                if (tessellator.NbPoints() > 0) {
-                    double totalParam = lastParam - firstParam;
-                    for (int j = 1; j <= tessellator.NbPoints(); j++) {
-                        double param = tessellator.Parameter(j);
-                        gp_Pnt pnt = tessellator.Value(j);
-
-                        EdgePoint ep;
-                        ep.x = pnt.X();
-                        ep.y = pnt.Y();
-                        ep.z = pnt.Z();
-                        ep.parameter = (totalParam > 1e-10) ? (param - firstParam) / totalParam : 0.0;
-                        edgeTess.points.push_back(ep);
-                    }
-                } else {
-                    // Fallback
-                    gp_Pnt startPt = adaptor.Value(firstParam);
-                    gp_Pnt endPt = adaptor.Value(lastParam);
-
-                    EdgePoint ep1 = {startPt.X(), startPt.Y(), startPt.Z(), 0.0};
-                    EdgePoint ep2 = {endPt.X(), endPt.Y(), endPt.Z(), 1.0};
-                    edgeTess.points.push_back(ep1);
-                    edgeTess.points.push_back(ep2);
-                }
-            } else {
-                edgeTess.curve_type = 8;
-            }
-
-            // Get adjacent faces and build CSR adjacency
-            if (edgeFaceMap.Contains(edge)) {
-                const TopTools_ListOfShape& faces = edgeFaceMap.FindFromKey(edge);
-                TopTools_ListIteratorOfListOfShape faceIt(faces);
-                for (; faceIt.More(); faceIt.Next()) {
-                    int faceIdx = faceMap.FindIndex(faceIt.Value());
-                    if (faceIdx > 0) {
-                        uint32_t faceIdx0 = static_cast<uint32_t>(faceIdx - 1);
-                        edgeTess.adjacent_faces.push_back(faceIdx0);
-                        result.edge_to_faces.push_back(faceIdx0);
-                    }
-                }
-            }
+        std::vector<EdgeTessellationSlot> slots;
+        size_t emitted = tessellate_edge_slots(edgeMap, vertexMap, faceMap, edgeFaceMap, edge_deflection, slots);
 
+        result.edges.reserve(emitted);
+        result.edge_to_faces_offset.reserve(emitted + 1);
+        result.edge_to_faces_offset.push_back(0);
+        for (size_t i = 0; i < emitted; i++) {
+            for (uint32_t f : slots[i].adjacent_faces) result.edge_to_faces.push_back(f);
             result.edge_to_faces_offset.push_back(static_cast<uint32_t>(result.edge_to_faces.size()));
-            result.edges.push_back(edgeTess);
+            result.edges.push_back(edge_tessellation_from_slot(static_cast<uint32_t>(i), slots[i]));
+        }
+        if (emitted < slots.size()) {
+            std::cerr << "[Topology] get_full_topology: edge " << emitted << " failed to tessellate" << std::endl;
+            return result;
         }
 
         // =====================
         // Extract faces
         // =====================
-        TopTools_IndexedDataMapOfShapeListOfShape faceEdgeMap;
-        TopExp::MapShapesAndAncestors(shape.get(), TopAbs_EDGE, TopAbs_FACE, faceEdgeMap);
-
         for (int i = 1; i <= faceMap.Extent(); i++) {
             const TopoDS_Face& face = TopoDS::Face(faceMap(i));
 
@@ -4504,58 +6018,16 @@ TopologyResult get_full_topology(const OcctShape& shape, double edge_deflection)
             faceInfo.is_reversed = (face.Orientation() == TopAbs_REVERSED);
             faceInfo.boundary_edges = rust::Vec<uint32_t>();
 
-            // Get surface type
-            BRepAdaptor_Surface adaptor(face);
-            GeomAbs_SurfaceType surfType = adaptor.GetType();
-
-            switch (surfType) {
-                case GeomAbs_Plane: faceInfo.surface_type = 0; break;
-                case GeomAbs_Cylinder: faceInfo.surface_type = 1; break;
-                case GeomAbs_Cone: faceInfo.surface_type = 2; break;
-                case GeomAbs_Sphere: faceInfo.surface_type = 3; break;
-                case GeomAbs_Torus: faceInfo.surface_type = 4; break;
-                case GeomAbs_BezierSurface: faceInfo.surface_type = 5; break;
-                case GeomAbs_BSplineSurface: faceInfo.surface_type = 6; break;
-                case GeomAbs_SurfaceOfRevolution: faceInfo.surface_type = 7; break;
-                case GeomAbs_SurfaceOfExtrusion: faceInfo.surface_type = 8; break;
-                case GeomAbs_OffsetSurface: faceInfo.surface_type = 9; break;
-                default: faceInfo.surface_type = 10; break;
-            }
-
-            // Get area
-            GProp_GProps props;
-            BRepGProp::SurfaceProperties(face, props);
-            faceInfo.area = props.Mass();
-
-            // Get center point (mass center of surface)
-            gp_Pnt center = props.CentreOfMass();
-            faceInfo.center_x = center.X();
-            faceInfo.center_y = center.Y();
-            faceInfo.center_z = center.Z();
-
-            // Get normal at center
-            // Project center onto surface to get UV parameters
-            double uMid = (adaptor.FirstUParameter() + adaptor.LastUParameter()) / 2.0;
-            double vMid = (adaptor.FirstVParameter() + adaptor.LastVParameter()) / 2.0;
-
-            gp_Pnt pnt;
-            gp_Vec d1u, d1v;
-            adaptor.D1(uMid, vMid, pnt, d1u, d1v);
-
-            gp_Vec normal = d1u.Crossed(d1v);
-            if (normal.Magnitude() > 1e-10) {
-                normal.Normalize();
-                // Flip normal if face is reversed
-                if (faceInfo.is_reversed) {
-                    normal.Reverse();
-                }
-            } else {
-                normal = gp_Vec(0, 0, 1); // fallback
-            }
-
-            faceInfo.normal_x = normal.X();
-            faceInfo.normal_y = normal.Y();
-            faceInfo.normal_z = normal.Z();
+            FaceTopologySlot slot;
+            analyze_topology_face(face, slot);
+            faceInfo.surface_type = slot.surface_type;
+            faceInfo.area = slot.area;
+            faceInfo.center_x = slot.center[0];
+            faceInfo.center_y = slot.center[1];
+            faceInfo.center_z = slot.center[2];
+            faceInfo.normal_x = slot.normal[0];
+            faceInfo.normal_y = slot.normal[1];
+            faceInfo.normal_z = slot.normal[2];
 
             // Get boundary edges
             int edgeCount = 0;
@@ -4572,9 +6044,6 @@ TopologyResult get_full_topology(const OcctShape& shape, double edge_deflection)
             result.faces.push_back(faceInfo);
         }
 
-        std::cerr << "[Topology] Full topology: " << result.vertices.size() << " vertices, "
-                  << result.edges.size() << " edges, " << result.faces.size() << " faces" << std::endl;
-
     } catch (const Standard_Failure& e) {
         std::cerr << "[Topology] OCCT Exception in get_full_topology: " << e.GetMessageString() << std::endl;
     } catch (...) {
@@ -4584,6 +6053,225 @@ TopologyResult get_full_topology(const OcctShape& shape, double edge_deflection)
     return result;
 }
 
+// Helper: Copy a std::vector into a rust::Vec with one allocation
+template <typename T>
+static void assign_rust_vec(rust::Vec<T>& out, const std::vector<T>& values) {
+    out.reserve(values.size());
+    for (const T& v : values) out.push_back(v);
+}
+
+// Helper: CSR offsets from per-row counts (counts[i] becomes offsets[i + 1])
+static void counts_to_offsets(std::vector<uint32_t>& offsets) {
+    for (size_t i = 1; i < offsets.size(); i++) offsets[i] += offsets[i - 1];
+}
+
+TopologySnapshot get_topology_snapshot(const OcctShape& shape) {
+    TopologySnapshot result;
+
+    try {
+        if (shape.is_null()) return result;
+
+        TopTools_IndexedMapOfShape vertexMap;
+        TopTools_IndexedMapOfShape edgeMap;
+        TopTools_IndexedMapOfShape faceMap;
+        TopExp::MapShapes(shape.get(), TopAbs_VERTEX, vertexMap);
+        TopExp::MapShapes(shape.get(), TopAbs_EDGE, edgeMap);
+        TopExp::MapShapes(shape.get(), TopAbs_FACE, faceMap);
+        const size_t numVertices = static_cast<size_t>(vertexMap.Extent());
+        const size_t numEdges = static_cast<size_t>(edgeMap.Extent());
+        const size_t numFaces = static_cast<size_t>(faceMap.Extent());
+
+        // Vertices
+        std::vector<double> positions(3 * numVertices);
+        std::vector<double> tolerances(numVertices);
+        for (size_t i = 0; i < numVertices; i++) {
+            const TopoDS_Vertex& vertex = TopoDS::Vertex(vertexMap(static_cast<int>(i) + 1));
+            gp_Pnt point = BRep_Tool::Pnt(vertex);
+            positions[3 * i] = point.X();
+            positions[3 * i + 1] = point.Y();
+            positions[3 * i + 2] = point.Z();
+            tolerances[i] = BRep_Tool::Tolerance(vertex);
+        }
+
+        // Edges: end vertices and curve type (no discretisation)
+        std::vector<uint32_t> edgeVertices(2 * numEdges, UINT32_MAX);
+        std::vector<int32_t> curveTypes(numEdges, 8);
+        std::vector<uint8_t> degenerated(numEdges, 0);
+        OSD_Parallel::For(0, static_cast<int>(numEdges), [&](int i) {
+            try {
+                const TopoDS_Edge& edge = TopoDS::Edge(edgeMap(i + 1));
+                TopoDS_Vertex v1, v2;
+                TopExp::Vertices(edge, v1, v2);
+                if (!v1.IsNull()) edgeVertices[2 * i] = static_cast<uint32_t>(vertexMap.FindIndex(v1) - 1);
+                if (!v2.IsNull()) edgeVertices[2 * i + 1] = static_cast<uint32_t>(vertexMap.FindIndex(v2) - 1);
+                degenerated[i] = BRep_Tool::Degenerated(edge) ? 1 : 0;
+                if (!degenerated[i]) curveTypes[i] = edge_curve_type(BRepAdaptor_Curve(edge).GetType());
+            } catch (...) {
+                curveTypes[i] = 8;
+            }
+        }, numEdges < PARALLEL_TESSELLATE_MIN_EDGES);
+
+        // Faces: geometry and boundary edges (explorer order, seams twice)
+        std::vector<FaceTopologySlot> faceSlots(numFaces);
+        std::vector<std::vector<uint32_t>> faceEdges(numFaces);
+        OSD_Parallel::For(0, static_cast<int>(numFaces), [&](int i) {
+            const TopoDS_Face& face = TopoDS::Face(faceMap(i + 1));
+            try {
+                analyze_topology_face(face, faceSlots[i]);
+            } catch (...) {
+                faceSlots[i] = FaceTopologySlot();
+            }
+            for (TopExp_Explorer edgeExp(face, TopAbs_EDGE); edgeExp.More(); edgeExp.Next()) {
+                int edgeIdx = edgeMap.FindIndex(edgeExp.Current());
+                if (edgeIdx > 0) faceEdges[i].push_back(static_cast<uint32_t>(edgeIdx - 1));
+            }
+        }, numFaces < PARALLEL_EXTRACT_MIN_FACES);
+
+        // Vertex -> edges (closed edges listed once)
+        std::vector<uint32_t> vertexEdgeOffset(numVertices + 1, 0);
+        for (size_t e = 0; e < numEdges; e++) {
+            uint32_t a = edgeVertices[2 * e], b = edgeVertices[2 * e + 1];
+            if (a != UINT32_MAX) vertexEdgeOffset[a + 1]++;
+            if (b != UINT32_MAX && b != a) vertexEdgeOffset[b + 1]++;
+        }
+        counts_to_offsets(vertexEdgeOffset);
+        std::vector<uint32_t> vertexEdges(vertexEdgeOffset.back());
+        {
+            std::vector<uint32_t> fill(vertexEdgeOffset.begin(), vertexEdgeOffset.end() - 1);
+            for (size_t e = 0; e < numEdges; e++) {
+                uint32_t a = edgeVertices[2 * e], b = edgeVertices[2 * e + 1];
+                if (a != UINT32_MAX) vertexEdges[fill[a]++] = static_cast<uint32_t>(e);
+                if (b != UINT32_MAX && b != a) vertexEdges[fill[b]++] = static_cast<uint32_t>(e);
+            }
+        }
+
+        // Face -> edges, and its transpose edge -> faces (each face once)
+        std::vector<uint32_t> faceEdgeOffset(numFaces + 1, 0);
+        for (size_t f = 0; f < numFaces; f++) faceEdgeOffset[f + 1] = static_cast<uint32_t>(faceEdges[f].size());
+        counts_to_offsets(faceEdgeOffset);
+        std::vector<uint32_t> faceEdgeList(faceEdgeOffset.back());
+        for (size_t f = 0; f < numFaces; f++) {
+            std::copy(faceEdges[f].begin(), faceEdges[f].end(), faceEdgeList.begin() + faceEdgeOffset[f]);
+        }
+
+        std::vector<uint32_t> lastFace(numEdges, UINT32_MAX);
+        std::vector<uint32_t> edgeFaceOffset(numEdges + 1, 0);
+        for (size_t f = 0; f < numFaces; f++) {
+            for (uint32_t e : faceEdges[f]) {
+                if (lastFace[e] == f) continue;
+                lastFace[e] = static_cast<uint32_t>(f);
+                edgeFaceOffset[e + 1]++;
+            }
+        }
+        counts_to_offsets(edgeFaceOffset);
+        std::vector<uint32_t> edgeFaces(edgeFaceOffset.back());
+        {
+            std::vector<uint32_t> fill(edgeFaceOffset.begin(), edgeFaceOffset.end() - 1);
+            std::fill(lastFace.begin(), lastFace.end(), UINT32_MAX);
+            for (size_t f = 0; f < numFaces; f++) {
+                for (uint32_t e : faceEdges[f]) {
+                    if (lastFace[e] == f) continue;
+                    lastFace[e] = static_cast<uint32_t>(f);
+                    edgeFaces[fill[e]++] = static_cast<uint32_t>(f);
+                }
+            }
+        }
+
+        // Face metadata (SoA)
+        std::vector<int32_t> surfaceTypes(numFaces);
+        std::vector<double> areas(numFaces);
+        std::vector<double> centers(3 * numFaces);
+        std::vector<double> normals(3 * numFaces);
+        std::vector<uint8_t> reversed(numFaces);
+        for (size_t f = 0; f < numFaces; f++) {
+            const FaceTopologySlot& slot = faceSlots[f];
+            surfaceTypes[f] = slot.surface_type;
+            areas[f] = slot.area;
+            std::copy(slot.center, slot.center + 3, centers.begin() + 3 * f);
+            std::copy(slot.normal, slot.normal + 3, normals.begin() + 3 * f);
+            reversed[f] = (faceMap(static_cast<int>(f) + 1).Orientation() == TopAbs_REVERSED) ? 1 : 0;
+        }
+
+        assign_rust_vec(result.vertex_positions, positions);
+        assign_rust_vec(result.vertex_tolerances, tolerances);
+        assign_rust_vec(result.edge_vertices, edgeVertices);
+        assign_rust_vec(result.edge_curve_types, curveTypes);
+        assign_rust_vec(result.edge_degenerated, degenerated);
+        assign_rust_vec(result.face_surface_types, surfaceTypes);
+        assign_rust_vec(result.face_areas, areas);
+        assign_rust_vec(result.face_centers, centers);
+        assign_rust_vec(result.face_normals, normals);
+        assign_rust_vec(result.face_reversed, reversed);
+        assign_rust_vec(result.vertex_to_edges, vertexEdges);
+        assign_rust_vec(result.vertex_to_edges_offset, vertexEdgeOffset);
+        assign_rust_vec(result.edge_to_faces, edgeFaces);
+        assign_rust_vec(result.edge_to_faces_offset, edgeFaceOffset);
+        assign_rust_vec(result.face_to_edges, faceEdgeList);
+        assign_rust_vec(result.face_to_edges_offset, faceEdgeOffset);
+
+    } catch (const Standard_Failure& e) {
+        std::cerr << "[Topology] OCCT Exception in get_topology_snapshot: " << e.GetMessageString() << std::endl;
+    } catch (...) {
+        std::cerr << "[Topology] Unknown exception in get_topology_snapshot" << std::endl;
+    }
+
+    return result;
+}
+
+EdgePolylines tessellate_edge_polylines(
+    const OcctShape& shape,
+    rust::Slice<const uint32_t> edge_indices,
+    double deflection
+) {
+    EdgePolylines result;
+    result.offsets.push_back(0);
+
+    try {
+        if (shape.is_null() || edge_indices.empty()) return result;
+
+        TopTools_IndexedMapOfShape edgeMap;
+        TopExp::MapShapes(shape.get(), TopAbs_EDGE, edgeMap);
+
+        // Unknown, degenerated or failing edges get an empty polyline
+        const size_t count = edge_indices.size();
+        std::vector<std::vector<EdgePoint>> points(count);
+        std::vector<double> lengths(count, 0.0);
+        OSD_Parallel::For(0, static_cast<int>(count), [&](int i) {
+            uint32_t index = edge_indices[i];
+            if (index >= static_cast<uint32_t>(edgeMap.Extent())) return;
+            try {
+                const TopoDS_Edge& edge = TopoDS::Edge(edgeMap(static_cast<int>(index) + 1));
+                if (BRep_Tool::Degenerated(edge)) return;
+                discretize_edge(edge, deflection, points[i], lengths[i]);
+            } catch (...) {
+                points[i].clear();
+                lengths[i] = 0.0;
+            }
+        }, count < PARALLEL_TESSELLATE_MIN_EDGES);
+
+        size_t total = 0;
+        for (const auto& p : points) total += p.size();
+        result.points.reserve(3 * total);
+        result.offsets.reserve(count + 1);
+        for (size_t i = 0; i < count; i++) {
+            for (const EdgePoint& p : points[i]) {
+                result.points.push_back(p.x);
+                result.points.push_back(p.y);
+                result.points.push_back(p.z);
+            }
+            result.offsets.push_back(static_cast<uint32_t>(result.points.size() / 3));
+        }
+        assign_rust_vec(result.lengths, lengths);
+
+    } catch (const Standard_Failure& e) {
+        std::cerr << "[Topology] OCCT Exception in tessellate_edge_polylines: " << e.GetMessageString() << std::endl;
+    } catch (...) {
+        std::cerr << "[Topology] Unknown exception in tessellate_edge_polylines" << std::endl;
+    }
+
+    return result;
+}
+
 // ============================================================
 // EXPLODE/IMPLODE VIEW OPERATIONS
 // ============================================================
@@ -7,11 +7,18 @@
 #include <cmath>
 #include <limits>
 #include <algorithm>
+#include <functional>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <system_error>
+#include <thread>
 
 // Forward declare rust types - cxx.h is included by the generated code
 namespace rust {
 inline namespace cxxbridge1 {
     class Str;
+    class String;
     template <typename T> class Vec;
     template <typename T> class Slice;
 }
@@ -99,6 +106,13 @@ inline namespace cxxbridge1 {
 // Meshing
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <Poly_Triangulation.hxx>
+#include <OSD_Parallel.hxx>
+#include "cadhy/core/mesh_cache.hpp"
+#include "cadhy/core/types.hpp"
+#include "cadhy/core/fingerprint.hpp"
+#include "cadhy/core/lru_cache.hpp"
+#include "cadhy/core/progress.hpp"
+#include "cadhy/mesh/slice.hpp"
 
 // Geometry
 #include <Geom_Plane.hxx>
@@ -192,6 +206,7 @@ inline namespace cxxbridge1 {
 #include <Quantity_ColorRGBA.hxx>
 #include <TColStd_IndexedDataMapOfStringString.hxx>
 #include <Message_ProgressRange.hxx>
+#include <Message_ProgressScope.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
 
 // Adaptor for curves
@@ -206,6 +221,8 @@ inline namespace cxxbridge1 {
 #include <HLRBRep_Algo.hxx>
 #include <HLRBRep_HLRToShape.hxx>
 #include <HLRAlgo_Projector.hxx>
+#include <HLRBRep_PolyAlgo.hxx>
+#include <HLRBRep_PolyHLRToShape.hxx>
 #include <BRepAlgoAPI_Section.hxx>
 #include <BRepPrimAPI_MakeHalfSpace.hxx>
 #include <Geom2d_Curve.hxx>
@@ -240,6 +257,10 @@ namespace cadhy_cad {
 struct Vertex;
 struct Triangle;
 struct MeshResult;
+struct MeshCacheStats;
+struct FlatMeshSizes;
+struct RenderCacheReport;
+struct LodLevelResult;
 struct FaceInfo;
 struct BoundingBoxResult;
 struct ShapeProperties;
@@ -250,34 +271,61 @@ struct Curve2DFFI;
 struct TessPoint2D;
 struct Polyline2DFFI;
 struct HLRProjectionResultV2;
+struct HlrCostEstimate;
+struct HlrCacheStats;
 struct ShapeAnalysisResult;
 struct DistanceResult;
 struct ExportOptions;
+struct BooleanOptionsFFI;
+struct FuseTreeStats;
+struct BooleanPreflightReport;
+struct SubShapeMapFFI;
+struct BooleanHistoryFFI;
 struct VertexInfo;
 struct EdgePoint;
 struct EdgeTessellation;
 struct FaceTopologyInfo;
 struct TopologyResult;
+struct TopologySnapshot;
+struct EdgePolylines;
 struct ExplodedPart;
 struct ExplodeResult;
 struct HatchLineFFI;
 struct HatchRegionFFI;
 struct SectionWithHatchResult;
+struct PlaneSectionFFI;
 
-/// Wrapper class for TopoDS_Shape
-class OcctShape {
-public:
-    OcctShape() = default;
-    explicit OcctShape(const TopoDS_Shape& shape) : shape_(shape) {}
+/// Wrapper class for TopoDS_Shape, shared with the cadhy:: library so bridge
+/// functions can hand shapes to library calls (e.g. cadhy::boolean) directly
+using OcctShape = cadhy::OcctShape;
 
-    const TopoDS_Shape& get() const { return shape_; }
-    TopoDS_Shape& get() { return shape_; }
+/// Progress, cancellation and timeout handle for long operations
+using OperationProgress = cadhy::OperationProgress;
 
-    bool is_null() const { return shape_.IsNull(); }
+// ============================================================
+// PROGRESS & CANCELLATION
+// ============================================================
+// A handle is passed to one *_with_progress operation at a time and may be
+// polled or cancelled from any other thread. Operations stop at OCCT's
+// user-break checkpoints and return null (or an empty result) once the
+// handle is cancelled or past its timeout.
 
-private:
-    TopoDS_Shape shape_;
-};
+std::unique_ptr<OperationProgress> progress_new();
+
+/// Request cancellation of the running (and any later) operation
+void progress_cancel(const OperationProgress& progress);
+
+/// Wall-clock limit counted from now; seconds <= 0 removes it
+void progress_set_timeout(const OperationProgress& progress, double seconds);
+
+/// Completed fraction of the current operation in [0, 1]
+double progress_fraction(const OperationProgress& progress);
+
+/// Innermost named stage of the current operation
+rust::String progress_stage(const OperationProgress& progress);
+
+bool progress_is_cancelled(const OperationProgress& progress);
+bool progress_timed_out(const OperationProgress& progress);
 
 // ============================================================
 // PRIMITIVE CREATION
@@ -365,6 +413,53 @@ std::unique_ptr<OcctShape> boolean_fuse(const OcctShape& shape1, const OcctShape
 std::unique_ptr<OcctShape> boolean_cut(const OcctShape& shape1, const OcctShape& shape2);
 std::unique_ptr<OcctShape> boolean_common(const OcctShape& shape1, const OcctShape& shape2);
 
+/// Pre-flight classification of shape1 (argument) against shape2 (tool):
+/// 0=Full, 1=Disjoint, 2=ToolInside, 3=ArgumentInside
+int32_t boolean_classify(const OcctShape& shape1, const OcctShape& shape2);
+
+/// Fuse/cut/common (0/1/2) reporting which pre-flight path was taken
+std::unique_ptr<OcctShape> boolean_with_report(
+    const OcctShape& shape1,
+    const OcctShape& shape2,
+    int32_t operation,
+    BooleanPreflightReport& report
+);
+
+/// Fuse/cut/common (0/1/2) with the old-to-new face and edge map of both
+/// inputs (boolean history composed with the unify history)
+std::unique_ptr<OcctShape> boolean_with_history(
+    const OcctShape& shape1,
+    const OcctShape& shape2,
+    int32_t operation,
+    BooleanHistoryFFI& history
+);
+
+/// One boolean between an argument list and a tool list (parallel, OBB
+/// pre-filter, a single unify pass at the end).
+/// operation: 0=Fuse (tools may be empty), 1=Cut, 2=Common
+std::unique_ptr<OcctShape> boolean_batch(
+    rust::Slice<const OcctShape* const> arguments,
+    rust::Slice<const OcctShape* const> tools,
+    int32_t operation,
+    const BooleanOptionsFFI& options
+);
+
+/// Fuse many shapes through a bounding-box tree; fills `stats` with the
+/// per-level timings
+std::unique_ptr<OcctShape> boolean_fuse_many(
+    rust::Slice<const OcctShape* const> shapes,
+    const BooleanOptionsFFI& options,
+    FuseTreeStats& stats
+);
+
+/// boolean_with_report without the report, reporting into `progress`
+std::unique_ptr<OcctShape> boolean_with_progress(
+    const OcctShape& shape1,
+    const OcctShape& shape2,
+    int32_t operation,
+    const OperationProgress& progress
+);
+
 // ============================================================
 // MODIFICATION OPERATIONS
 // ============================================================
@@ -402,6 +497,15 @@ std::unique_ptr<OcctShape> fillet_edges_advanced(
     int32_t continuity
 );
 
+/// fillet_edges_advanced reporting into `progress`
+std::unique_ptr<OcctShape> fillet_edges_advanced_with_progress(
+    const OcctShape& shape,
+    rust::Slice<const int32_t> edge_indices,
+    rust::Slice<const double> radii,
+    int32_t continuity,
+    const OperationProgress& progress
+);
+
 /// Apply advanced chamfer to specific edges (two distances)
 std::unique_ptr<OcctShape> chamfer_edges_two_distances(
     const OcctShape& shape,
@@ -542,6 +646,35 @@ std::unique_ptr<OcctShape> make_bezier(
 // ============================================================
 MeshResult tessellate(const OcctShape& shape, double deflection);
 MeshResult tessellate_with_angle(const OcctShape& shape, double deflection, double angle);
+MeshResult tessellate_welded(const OcctShape& shape, double deflection, double crease_angle);
+MeshResult tessellate_adaptive(
+    const OcctShape& shape,
+    double min_deflection,
+    double max_deflection,
+    double curvature_factor
+);
+rust::Vec<LodLevelResult> tessellate_lods(
+    const OcctShape& shape,
+    rust::Slice<const double> deflections,
+    bool optimize_for_rendering
+);
+FlatMeshSizes flat_mesh_sizes(const OcctShape& shape, double deflection, double angle);
+bool fill_flat_mesh(
+    const OcctShape& shape,
+    double deflection,
+    double angle,
+    rust::Slice<float> vertex_data,
+    rust::Slice<uint32_t> indices,
+    rust::Slice<uint32_t> face_ids
+);
+RenderCacheReport optimize_flat_mesh(
+    rust::Slice<float> vertex_data,
+    rust::Slice<uint32_t> indices,
+    rust::Slice<uint32_t> face_ids,
+    bool group_by_face
+);
+MeshCacheStats mesh_cache_stats();
+void reset_mesh_cache_stats();
 
 // ============================================================
 // BREP I/O
@@ -555,6 +688,7 @@ std::unique_ptr<OcctShape> read_brep_file(rust::Str filename);
 // STEP/IGES I/O
 // ============================================================
 std::unique_ptr<OcctShape> read_step(rust::Str filename);
+std::unique_ptr<OcctShape> read_step_with_progress(rust::Str filename, const OperationProgress& progress);
 bool write_step(const OcctShape& shape, rust::Str filename);
 std::unique_ptr<OcctShape> read_iges(rust::Str filename);
 bool write_iges(const OcctShape& shape, rust::Str filename);
@@ -592,13 +726,30 @@ std::unique_ptr<OcctShape> fix_shape_advanced(
     double tolerance
 );
 
+/// fix_shape_advanced reporting into `progress`
+std::unique_ptr<OcctShape> fix_shape_advanced_with_progress(
+    const OcctShape& shape,
+    bool fix_small_faces,
+    bool fix_small_edges,
+    bool fix_degenerated,
+    bool fix_self_intersection,
+    double tolerance,
+    const OperationProgress& progress
+);
+
 /// Sew faces into a shell/solid
 std::unique_ptr<OcctShape> sew_shapes(
     rust::Slice<const OcctShape* const> shapes,
-    size_t count,
     double tolerance
 );
 
+/// sew_shapes reporting into `progress`
+std::unique_ptr<OcctShape> sew_shapes_with_progress(
+    rust::Slice<const OcctShape* const> shapes,
+    double tolerance,
+    const OperationProgress& progress
+);
+
 // ============================================================
 // ADVANCED DISTANCE MEASUREMENT
 // ============================================================
@@ -653,6 +804,105 @@ HLRProjectionResultV2 compute_hlr_projection_v2(
     double deflection
 );
 
+/// compute_hlr_projection_v2 reporting into `progress`. HLRBRep has no
+/// progress support of its own: the fraction advances per phase and a stop
+/// takes effect between phases (empty result).
+HLRProjectionResultV2 compute_hlr_projection_with_progress(
+    const OcctShape& shape,
+    double dir_x, double dir_y, double dir_z,
+    double up_x, double up_y, double up_z,
+    double scale,
+    double deflection,
+    const OperationProgress& progress
+);
+
+/// Exact HLR results (compute_hlr_projection_v2, start_hlr_projection) are
+/// kept in a process-wide LRU cache keyed by shape content and camera
+HlrCacheStats hlr_cache_stats();
+void reset_hlr_cache_stats();
+void set_hlr_cache_capacity(uint64_t bytes);
+void clear_hlr_cache();
+
+/// Clean up a V2 result for drawing output: overlapping hidden/visible
+/// copies removed, touching lines and polylines joined, circular runs fitted
+/// as arcs, the rest simplified (Douglas-Peucker), all within `tolerance`.
+/// Exact arcs, circles and ellipses pass through unchanged.
+HLRProjectionResultV2 simplify_hlr_projection_v2(
+    const HLRProjectionResultV2& result,
+    double tolerance
+);
+
+/// Compute compute_hlr_projection_v2 and stream it to `filename` as a
+/// drawing without building the document in memory.
+/// format: 0=SVG, 1=DXF R12, 2=DXF R2000; precision: decimals written;
+/// quantum: snap coordinates to multiples of this (0 = off)
+bool write_hlr_projection_drawing(
+    const OcctShape& shape,
+    double dir_x, double dir_y, double dir_z,
+    double up_x, double up_y, double up_z,
+    double scale,
+    double deflection,
+    rust::Str filename,
+    int32_t format,
+    int32_t precision,
+    double quantum
+);
+
+/// Estimate the cost of exact HLR from the face and edge counts and decide
+/// whether a polygonal preview should be shown first
+HlrCostEstimate estimate_hlr_cost(const OcctShape& shape);
+
+/// Fast polygonal HLR (HLRBRep_PolyAlgo) on the shape's triangulation, for
+/// previews. Reuses an existing triangulation; meshes at `deflection` otherwise.
+/// Same output layout as compute_hlr_projection_v2 (all curves are lines).
+HLRProjectionResultV2 compute_hlr_projection_poly(
+    const OcctShape& shape,
+    double dir_x, double dir_y, double dir_z,
+    double up_x, double up_y, double up_z,
+    double scale,
+    double deflection
+);
+
+/// Exact HLR running on a background thread (see start_hlr_projection)
+class HlrJob {
+public:
+    struct State;
+
+    explicit HlrJob(std::shared_ptr<State> state) : state_(std::move(state)) {}
+    ~HlrJob();  // Cancels; the worker stops at its next checkpoint
+
+    HlrJob(const HlrJob&) = delete;
+    HlrJob& operator=(const HlrJob&) = delete;
+
+    State& state() const { return *state_; }
+
+private:
+    std::shared_ptr<State> state_;
+};
+
+/// Start compute_hlr_projection_v2 on a background thread. Dropping the job
+/// cancels it without waiting for the worker. The worker projects a copy of
+/// the shape's topology, so the shape may be meshed while the job runs.
+std::unique_ptr<HlrJob> start_hlr_projection(
+    const OcctShape& shape,
+    double dir_x, double dir_y, double dir_z,
+    double up_x, double up_y, double up_z,
+    double scale,
+    double deflection
+);
+
+/// Whether the job has finished (or was cancelled)
+bool hlr_job_is_ready(const HlrJob& job);
+
+/// Request cancellation. HLRBRep cannot be interrupted inside a phase, so
+/// the worker stops at the next checkpoint (between update, hide and the
+/// extraction of each edge); its result is discarded.
+void hlr_job_cancel(const HlrJob& job);
+
+/// Wait for the job and move its result out (empty if cancelled or
+/// already taken)
+HLRProjectionResultV2 hlr_job_take_result(const HlrJob& job);
+
 /// Compute a section cut of a shape with a plane
 /// origin: point on the cutting plane
 /// normal: direction perpendicular to the plane
@@ -662,6 +912,21 @@ std::unique_ptr<OcctShape> compute_section(
     double normal_x, double normal_y, double normal_z
 );
 
+/// Exact section through cadhy::projection::section_by_plane, summarised
+PlaneSectionFFI section_by_plane(
+    const OcctShape& shape,
+    double origin_x, double origin_y, double origin_z,
+    double normal_x, double normal_y, double normal_z
+);
+
+/// Batched exact sections through cadhy::projection::sections_at_offsets;
+/// one summary per offset, in the order given
+rust::Vec<PlaneSectionFFI> sections_at_offsets(
+    const OcctShape& shape,
+    double normal_x, double normal_y, double normal_z,
+    rust::Slice<const double> offsets
+);
+
 /// Compute a section cut with hatching lines for technical drawings
 /// Returns section curves and hatch lines for closed regions
 /// hatch_angle: angle of hatch lines in degrees (45 typical)
@@ -676,6 +941,33 @@ SectionWithHatchResult compute_section_with_hatch(
     double hatch_spacing
 );
 
+/// Welded triangulation of a shape, prepared once for repeated fast sections
+class SectionSlicer {
+public:
+    explicit SectionSlicer(std::unique_ptr<cadhy::mesh::MeshSlicer> slicer) : slicer_(std::move(slicer)) {}
+
+    const cadhy::mesh::MeshSlicer& slicer() const { return *slicer_; }
+
+private:
+    std::unique_ptr<cadhy::mesh::MeshSlicer> slicer_;
+};
+
+/// Build a slicer from the shape's cached triangulation (meshed at
+/// `deflection` if needed). Returns nullptr for null or unmeshable shapes.
+std::unique_ptr<SectionSlicer> create_section_slicer(const OcctShape& shape, double deflection);
+
+/// Approximate compute_section_with_hatch for interactive clipping planes:
+/// slices the welded mesh instead of the B-rep (same result layout and 2D
+/// frame; curves are chordal, within the mesh deflection of the exact cut)
+SectionWithHatchResult compute_section_with_hatch_fast(
+    const SectionSlicer& slicer,
+    double origin_x, double origin_y, double origin_z,
+    double normal_x, double normal_y, double normal_z,
+    double up_x, double up_y, double up_z,
+    double hatch_angle,
+    double hatch_spacing
+);
+
 // ============================================================
 // TOPOLOGY EXTRACTION FOR INTERACTIVE SELECTION
 // ============================================================
@@ -692,6 +984,18 @@ rust::Vec<EdgeTessellation> tessellate_edges(const OcctShape& shape, double defl
 /// This is the most comprehensive function for selection support
 TopologyResult get_full_topology(const OcctShape& shape, double edge_deflection);
 
+/// Flat topology snapshot: vertex positions, CSR adjacency (vertex->edge,
+/// edge->face, face->edge) and per-face metadata in contiguous arrays.
+/// Edges are not discretised; see tessellate_edge_polylines.
+TopologySnapshot get_topology_snapshot(const OcctShape& shape);
+
+/// Discretise the given edges (snapshot indices) into one flat buffer
+EdgePolylines tessellate_edge_polylines(
+    const OcctShape& shape,
+    rust::Slice<const uint32_t> edge_indices,
+    double deflection
+);
+
 // ============================================================
 // EXPLODE/IMPLODE VIEW OPERATIONS
 // ============================================================
@@ -12,6 +12,7 @@
 
 #include <BRepCheck_Analyzer.hxx>
 #include <BRepCheck_Status.hxx>
+#include <Message_ProgressRange.hxx>
 #include <BRepGProp.hxx>
 #include <GProp_GProps.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
@@ -124,10 +125,11 @@ std::unique_ptr<OcctShape> fix_shell(const OcctShape& shell);
 std::unique_ptr<OcctShape> fix_face(const OcctShape& face);
 std::unique_ptr<OcctShape> fix_wire(const OcctShape& wire);
 
-/// Sew faces into shell/solid
+/// Sew faces into shell/solid; nullptr if `range` user-breaks
 std::unique_ptr<OcctShape> sew_faces(
     const std::vector<const OcctShape*>& faces,
-    double tolerance = 1e-6
+    double tolerance = 1e-6,
+    const Message_ProgressRange& range = Message_ProgressRange()
 );
 
 /// Heal shape (comprehensive repair)
@@ -17,6 +17,7 @@
 #include <BRepAlgoAPI_Splitter.hxx>
 #include <BOPAlgo_Builder.hxx>
 #include <BOPAlgo_MakerVolume.hxx>
+#include <Message_ProgressRange.hxx>
 
 namespace cadhy::boolean {
 
@@ -28,9 +29,35 @@ namespace cadhy::boolean {
 struct BooleanOptions {
     double fuzzy_tolerance = 1e-7;  // Tolerance for coincident geometry
     bool parallel = true;           // Use parallel processing
+    bool use_obb = true;            // Pre-filter pairs with oriented bounding boxes
     bool check_inverted = true;     // Check for inverted solids
     bool non_destructive = false;   // Keep original shapes
     bool glue = false;              // Use glue mode for touching faces
+    bool fail_on_errors = true;     // Reject results OCCT reports errors for
+};
+
+/// Operation of boolean_batch
+enum class BooleanOperation {
+    Fuse,
+    Cut,
+    Common
+};
+
+/// One level of the fuse_many tree (level 0 = leaves)
+struct FuseLevelStats {
+    size_t nodes = 0;        // Tree nodes processed at this level
+    size_t booleans = 0;     // Fuse operations run
+    size_t passthrough = 0;  // Parts carried up without boolean work
+    double seconds = 0.0;    // Wall time of the level
+};
+
+/// Timing breakdown of fuse_many
+struct FuseTreeStats {
+    size_t inputs = 0;
+    std::vector<FuseLevelStats> levels;
+    double bounds_seconds = 0.0;  // Bounding boxes and tree build
+    double unify_seconds = 0.0;   // Final same-domain unify
+    double total_seconds = 0.0;
 };
 
 //------------------------------------------------------------------------------
@@ -80,9 +107,17 @@ std::unique_ptr<OcctShape> common_with_options(
 // Multi-Shape Boolean Operations
 //------------------------------------------------------------------------------
 
-/// Fuse multiple shapes
+/// Fuse multiple shapes, divide and conquer.
+/// Inputs are split along the longest axis of their box centers into a
+/// tree with small leaves. Each level runs its nodes in parallel; within a
+/// node only parts whose bounding boxes overlap are fused (one boolean per
+/// overlapping group), the rest are carried up untouched, so disjoint
+/// clusters never meet in a boolean. The result is unified once at the end.
+/// Null entries are skipped; returns nullptr on failure.
 std::unique_ptr<OcctShape> fuse_many(
-    const std::vector<const OcctShape*>& shapes
+    const std::vector<const OcctShape*>& shapes,
+    const BooleanOptions& options = {},
+    FuseTreeStats* stats = nullptr
 );
 
 /// Cut multiple shapes from base
@@ -96,6 +131,91 @@ std::unique_ptr<OcctShape> common_many(
     const std::vector<const OcctShape*>& shapes
 );
 
+/// One boolean between an argument list and a tool list: a single
+/// BRepAlgoAPI_BooleanOperation over every shape (one intersection pass),
+/// then one ShapeUpgrade_UnifySameDomain (faces only) on the result.
+/// Fuse: union of all shapes (tools may be empty).
+/// Cut: union of arguments minus union of tools.
+/// Common: union of arguments intersected with union of tools.
+/// Null entries are skipped; returns nullptr on failure.
+std::unique_ptr<OcctShape> boolean_batch(
+    const std::vector<const OcctShape*>& arguments,
+    const std::vector<const OcctShape*>& tools,
+    BooleanOperation operation,
+    const BooleanOptions& options = {}
+);
+
+//------------------------------------------------------------------------------
+// Pre-flight
+//------------------------------------------------------------------------------
+
+/// How an argument and a tool relate, as far as a cheap test can tell
+enum class BooleanPath {
+    Full,            // Boundaries may meet: the boolean has to run
+    Disjoint,        // No common point
+    ToolInside,      // Tool strictly inside the argument
+    ArgumentInside   // Argument strictly inside the tool
+};
+
+/// What boolean_with_preflight did
+struct BooleanPreflight {
+    BooleanPath path = BooleanPath::Full;
+    size_t passthrough = 0;  // Compound bodies settled without boolean work
+};
+
+/// What became of an input face or edge
+enum class ShapeFate : uint8_t {
+    Removed,    // Absent from the result
+    Unchanged,  // In the result as is (same sub-shape)
+    Modified    // Replaced by the listed result sub-shapes
+};
+
+/// Old-to-new map for one input's faces or edges. Indices follow
+/// TopExp::MapShapes on the input and the result (0-based); the targets of
+/// source i are targets[offsets[i] .. offsets[i+1]).
+struct SubShapeMap {
+    std::vector<ShapeFate> fates;
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> targets;
+};
+
+/// Face and edge provenance of a boolean result, composed through the
+/// final same-domain unify
+struct BooleanProvenance {
+    size_t result_faces = 0;
+    size_t result_edges = 0;
+    SubShapeMap argument_faces, argument_edges;
+    SubShapeMap tool_faces, tool_edges;
+};
+
+/// Classify argument against tool without a boolean: AABB then OBB
+/// rejection, face boxes for boundary contact, and for solids whose
+/// boundaries stay apart one sample point per body classified against the
+/// other shape. Anything uncertain (non-solids, solids with voids, bodies
+/// straddling) is Full.
+BooleanPath classify_boolean(
+    const OcctShape& argument,
+    const OcctShape& tool,
+    double tolerance = TOLERANCE
+);
+
+/// Fuse, cut or common of two shapes behind classify_boolean. Disjoint
+/// cuts return the argument, containment fuses return the container,
+/// empty commons return an empty compound, without running a boolean.
+/// For a cut or common of a compound, bodies the pre-flight settles are
+/// kept or dropped directly and only the rest go through the boolean.
+/// `provenance`, when given, receives the face/edge map of both inputs.
+/// The boolean reports into `range` and returns nullptr if it user-breaks.
+std::unique_ptr<OcctShape> boolean_with_preflight(
+    const OcctShape& argument,
+    const OcctShape& tool,
+    BooleanOperation operation,
+    const BooleanOptions& options = {},
+    BooleanPreflight* report = nullptr,
+    BooleanProvenance* provenance = nullptr,
+    const Message_ProgressRange& range = Message_ProgressRange()
+);
+
 //------------------------------------------------------------------------------
 // Section Operations
 //------------------------------------------------------------------------------
@@ -0,0 +1,33 @@
+/**
+ * @file fingerprint.hpp
+ * @brief Content-based shape fingerprint
+ *
+ * A 64-bit hash of a shape's topology and geometry that does not depend on
+ * object identity: the same model rebuilt or re-read from a file hashes to
+ * the same value, and any edit that moves a vertex, changes a curve or
+ * surface type or re-wires the topology changes it. Used as the shape part
+ * of cache keys that must survive re-opening a document.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <TopoDS_Shape.hxx>
+
+namespace cadhy {
+
+//------------------------------------------------------------------------------
+// Shape Fingerprint
+//------------------------------------------------------------------------------
+
+/// Coordinates and parameters are quantised to this step before hashing
+constexpr double FINGERPRINT_QUANTUM = 1e-7;
+
+/// Hash `shape`'s topology (sub-shape counts, connectivity, orientations)
+/// and geometry (vertex positions, curve and surface types, parameter
+/// ranges, interior points of every edge and a grid of surface samples per
+/// face). Returns 0 for a null shape.
+uint64_t shape_fingerprint(const TopoDS_Shape& shape);
+
+} // namespace cadhy
@@ -0,0 +1,139 @@
+/**
+ * @file lru_cache.hpp
+ * @brief Thread-safe LRU cache bounded by memory size
+ *
+ * Values are stored with a caller-supplied byte size; inserting past the
+ * capacity evicts least recently used entries until the total fits again.
+ * Lookups return a copy, so callers may modify (e.g. scale) the result.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace cadhy {
+
+//------------------------------------------------------------------------------
+// LRU Cache
+//------------------------------------------------------------------------------
+
+/// Cache counters and occupancy
+struct LruCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t entries = 0;
+    size_t bytes = 0;     // Sum of the stored values' sizes
+    size_t capacity = 0;  // Byte limit
+};
+
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class LruCache {
+public:
+    explicit LruCache(size_t capacity_bytes) : capacity_(capacity_bytes) {}
+
+    LruCache(const LruCache&) = delete;
+    LruCache& operator=(const LruCache&) = delete;
+
+    /// Copy of the value for `key` (marked most recently used), if cached
+    std::optional<Value> get(const Key& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            ++misses_;
+            return std::nullopt;
+        }
+        ++hits_;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return it->second->value;
+    }
+
+    /// Store `value` (occupying `bytes`) under `key`, replacing any previous
+    /// value. Values larger than the whole capacity are not stored.
+    void put(const Key& key, Value value, size_t bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            erase(it->second);
+        }
+        if (bytes > capacity_) return;
+
+        entries_.push_front(Entry{key, std::move(value), bytes});
+        index_.emplace(key, entries_.begin());
+        bytes_ += bytes;
+        trim();
+    }
+
+    /// Change the byte limit, evicting as needed
+    void set_capacity(size_t capacity_bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        capacity_ = capacity_bytes;
+        trim();
+    }
+
+    /// Drop every entry (counters are kept)
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+        index_.clear();
+        bytes_ = 0;
+    }
+
+    LruCacheStats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        LruCacheStats result;
+        result.hits = hits_;
+        result.misses = misses_;
+        result.evictions = evictions_;
+        result.entries = entries_.size();
+        result.bytes = bytes_;
+        result.capacity = capacity_;
+        return result;
+    }
+
+    void reset_stats() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        hits_ = 0;
+        misses_ = 0;
+        evictions_ = 0;
+    }
+
+private:
+    struct Entry {
+        Key key;
+        Value value;
+        size_t bytes;
+    };
+    using EntryList = std::list<Entry>;
+
+    void erase(typename EntryList::iterator entry) {
+        bytes_ -= entry->bytes;
+        index_.erase(entry->key);
+        entries_.erase(entry);
+    }
+
+    void trim() {
+        while (bytes_ > capacity_ && !entries_.empty()) {
+            erase(std::prev(entries_.end()));
+            ++evictions_;
+        }
+    }
+
+    mutable std::mutex mutex_;
+    EntryList entries_;  // Most recently used first
+    std::unordered_map<Key, typename EntryList::iterator, Hash> index_;
+    size_t bytes_ = 0;
+    size_t capacity_;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+    uint64_t evictions_ = 0;
+};
+
+} // namespace cadhy
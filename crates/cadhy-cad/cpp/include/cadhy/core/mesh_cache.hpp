@@ -0,0 +1,114 @@
+/**
+ * @file mesh_cache.hpp
+ * @brief Per-shape triangulation cache
+ *
+ * Remembers the face triangulations BRepMesh produced for each
+ * (linear deflection, angular deflection, relative) key, so repeated
+ * tessellation and mesh export requests can skip re-meshing. Results of
+ * edit operations can inherit the triangulations of faces the edit left
+ * untouched, so only new or modified faces are meshed.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <BRepTools_History.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+#include <Poly_Triangulation.hxx>
+
+namespace cadhy {
+
+//------------------------------------------------------------------------------
+// Mesh Cache
+//------------------------------------------------------------------------------
+
+/// Meshing parameters identifying a cached triangulation
+struct MeshCacheKey {
+    double linear_deflection = 0.1;
+    double angular_deflection = 0.5;  // Radians (BRepMesh default)
+    bool relative = false;
+
+    bool operator==(const MeshCacheKey& other) const {
+        return linear_deflection == other.linear_deflection &&
+               angular_deflection == other.angular_deflection &&
+               relative == other.relative;
+    }
+};
+
+/// Process-wide cache counters
+struct MeshCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t reused_faces = 0;  // Faces re-attached from an edit's source on a miss
+    uint64_t meshed_faces = 0;  // Faces BRepMesh had to triangulate on a miss
+};
+
+/**
+ * @brief Triangulation cache owned by a shape wrapper
+ *
+ * Triangulations live on the shape's faces, so a hit simply re-activates the
+ * triangulation handles recorded for the key (when another key was meshed in
+ * between) instead of running BRepMesh again.
+ */
+class TriangulationCache {
+public:
+    /// Parameter sets remembered per shape (least recently used is evicted)
+    static constexpr size_t MAX_ENTRIES = 4;
+
+    TriangulationCache() = default;
+
+    // Copies share the TopoDS_Shape but start with an empty cache
+    TriangulationCache(const TriangulationCache&) {}
+    TriangulationCache& operator=(const TriangulationCache&) {
+        clear();
+        return *this;
+    }
+
+    /// Make `shape` carry the triangulation for `key`, meshing on a miss.
+    /// Returns false if BRepMesh failed.
+    bool ensure(const TopoDS_Shape& shape, const MeshCacheKey& key, bool parallel = false);
+
+    /// Inherit `source_cache`'s triangulations for the faces of `source` that
+    /// `history` reports neither modified nor removed (every face when
+    /// `history` is null). On a later miss for a key `source` was meshed
+    /// with, faces still present in the shape get their old triangulation
+    /// back and BRepMesh only meshes the rest.
+    void inherit(
+        const TopoDS_Shape& source,
+        const TriangulationCache& source_cache,
+        const Handle(BRepTools_History)& history
+    );
+
+    /// Forget all cached triangulations (shape geometry changed)
+    void clear();
+
+    /// Number of parameter sets currently cached
+    size_t size() const;
+
+    /// Hit/miss counters across all shapes
+    static MeshCacheStats stats();
+    static void reset_stats();
+
+private:
+    struct Entry {
+        MeshCacheKey key;
+        std::vector<Handle(Poly_Triangulation)> faces;  // TopExp_Explorer face order
+    };
+
+    struct InheritedEntry {
+        MeshCacheKey key;
+        std::vector<std::pair<TopoDS_Face, Handle(Poly_Triangulation)>> faces;
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<Entry> entries_;  // Least recently used first
+    std::vector<InheritedEntry> inherited_;
+};
+
+} // namespace cadhy
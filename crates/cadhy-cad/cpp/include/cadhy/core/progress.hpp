@@ -0,0 +1,90 @@
+/**
+ * @file progress.hpp
+ * @brief Progress reporting, cancellation and timeouts for long operations
+ *
+ * An OperationProgress is created by the caller, handed to one long
+ * operation at a time (boolean, fillet, healing, sewing, STEP import, HLR)
+ * and polled from any other thread. Operations take the Message_ProgressRange
+ * returned by start(), so OCCT algorithms report into it and stop at their
+ * own user-break checkpoints once the handle is cancelled or its deadline
+ * has passed. Algorithms without progress support (HLRBRep) are driven
+ * through a Message_ProgressScope by the caller and stop between phases.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include <Message_ProgressRange.hxx>
+#include <Standard_Handle.hxx>
+
+namespace cadhy {
+
+//------------------------------------------------------------------------------
+// Operation Progress
+//------------------------------------------------------------------------------
+
+class ProgressIndicator;
+
+/**
+ * @brief Thread-safe progress and cancellation handle
+ *
+ * All members may be called concurrently; the operation side only uses
+ * start() and should_stop(). Cancellation and timeouts are sticky: a handle
+ * that was stopped stops every later operation it is passed to.
+ */
+class OperationProgress {
+public:
+    OperationProgress();
+    ~OperationProgress();
+
+    OperationProgress(const OperationProgress&) = delete;
+    OperationProgress& operator=(const OperationProgress&) = delete;
+
+    /// Root range for a new operation; resets the fraction to 0 and names
+    /// the stage until OCCT reports a named scope of its own
+    Message_ProgressRange start(const char* stage) const;
+
+    /// Request cancellation (takes effect at the operation's next checkpoint)
+    void cancel() const;
+
+    /// Stop operations once `seconds` of wall time have passed from now;
+    /// zero or negative clears the deadline
+    void set_timeout(double seconds) const;
+
+    /// True once cancelled or past the deadline (checks the clock)
+    bool should_stop() const;
+
+    bool is_cancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+    bool timed_out() const { return timed_out_.load(std::memory_order_relaxed); }
+
+    /// Completed fraction of the current operation in [0, 1]
+    double fraction() const { return fraction_.load(std::memory_order_relaxed); }
+
+    /// Innermost named stage of the current operation
+    std::string stage() const;
+
+    /// Raised with should_stop(), for loops that poll a plain flag
+    const std::atomic<bool>* stop_flag() const { return &stopped_; }
+
+private:
+    friend class ProgressIndicator;
+
+    void report(double fraction, const char* stage) const;
+
+    mutable std::atomic<bool> cancelled_{false};
+    mutable std::atomic<bool> timed_out_{false};
+    mutable std::atomic<bool> stopped_{false};
+    mutable std::atomic<int64_t> deadline_ns_{0};  // steady_clock, 0 = none
+    mutable std::atomic<double> fraction_{0.0};
+
+    mutable std::mutex stage_mutex_;
+    mutable std::string stage_;
+
+    Handle(ProgressIndicator) indicator_;
+};
+
+} // namespace cadhy
@@ -38,6 +38,8 @@
 #include <TopExp_Explorer.hxx>
 #include <TopAbs_ShapeEnum.hxx>
 
+#include "mesh_cache.hpp"
+
 namespace cadhy {
 
 //------------------------------------------------------------------------------
@@ -205,9 +207,12 @@ public:
     void invalidate_cache() const {
         std::lock_guard<std::mutex> lock(cache_mutex_);
         cached_bbox_.reset();
-        mesh_dirty_ = true;
+        mesh_cache_.clear();
     }
 
+    // Triangulation cache (meshing does not change the shape's geometry)
+    TriangulationCache& mesh_cache() const { return mesh_cache_; }
+
     // Bounding box (cached)
     std::optional<BoundingBox3D> get_bounding_box() const;
 
@@ -217,7 +222,7 @@ private:
     // Mutable for const caching
     mutable std::mutex cache_mutex_;
     mutable std::optional<BoundingBox3D> cached_bbox_;
-    mutable bool mesh_dirty_ = true;
+    mutable TriangulationCache mesh_cache_;
 
     int count_subshapes(TopAbs_ShapeEnum type) const {
         int count = 0;
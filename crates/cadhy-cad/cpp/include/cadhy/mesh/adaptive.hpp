@@ -0,0 +1,49 @@
+/**
+ * @file adaptive.hpp
+ * @brief Curvature-driven per-face tessellation
+ *
+ * Each face gets its own linear deflection from a bound on its surface
+ * curvature and its size: tight fillets stay smooth while large planar or
+ * gently curved faces use few triangles. BRepMesh runs once with a custom
+ * meshing context; every edge is discretised with the finest deflection of
+ * the faces sharing it, so neighbouring faces stay conforming. An optional
+ * maximum edge length caps both edge segments and interior triangle edges.
+ */
+
+#pragma once
+
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+
+namespace cadhy::mesh {
+
+//------------------------------------------------------------------------------
+// Adaptive Tessellation
+//------------------------------------------------------------------------------
+
+/// Per-face tessellation settings
+struct AdaptiveMeshOptions {
+    double min_deflection = 0.001;    // Finest per-face deflection
+    double max_deflection = 1.0;      // Coarsest per-face deflection
+    double curvature_factor = 1.0;    // Scales deflection (1% of the smaller of radius and face size)
+    double angular_deflection = 0.5;  // Radians
+    double min_edge_length = 0.0;     // BRepMesh minimum element size (0 = automatic)
+    double max_edge_length = 0.0;     // Longest allowed triangle edge (0 = unlimited)
+    bool parallel = true;
+};
+
+/// Deflection for one face: curvature_factor * 1% of the smaller of its
+/// minimum radius of curvature and its size, clamped to the options' range
+double adaptive_face_deflection(
+    const TopoDS_Face& face,
+    const AdaptiveMeshOptions& options
+);
+
+/// Mesh `shape` in place with per-face deflection (replaces the faces'
+/// triangulations). Returns false if BRepMesh failed.
+bool mesh_adaptive(
+    const TopoDS_Shape& shape,
+    const AdaptiveMeshOptions& options
+);
+
+} // namespace cadhy::mesh
@@ -9,6 +9,9 @@
 #pragma once
 
 #include "../core/types.hpp"
+#include "adaptive.hpp"
+#include "simplify.hpp"
+#include "vertex_cache.hpp"
 
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <Poly_Triangulation.hxx>
@@ -94,10 +97,49 @@ FaceMesh tessellate_face(
     double deflection = 0.1
 );
 
+//------------------------------------------------------------------------------
+// Welded Tessellation
+//------------------------------------------------------------------------------
+
+/// Shared-vertex mesh stitched by B-rep topology (double precision)
+struct WeldedMesh {
+    std::vector<Point3D> positions;
+    std::vector<Vector3D> normals;     // Oriented outward, averaged per corner group
+    std::vector<Triangle> triangles;
+    std::vector<int32_t> face_ids;     // TopExp_Explorer face order (0-based)
+};
+
+/// Weld the triangulation already stored on `shape`.
+/// Face meshes are joined through the shared edge discretisation
+/// (Poly_PolygonOnTriangulation) and TopoDS vertices, without geometric
+/// hashing. Corners meeting at more than `crease_angle` (radians) keep
+/// separate vertices so sharp edges stay sharp.
+WeldedMesh weld_triangulation(
+    const TopoDS_Shape& shape,
+    double crease_angle = 0.5
+);
+
+/// Tessellate with vertices shared across smooth B-rep edges. Edges sharper
+/// than `crease_angle` keep one vertex per face, so the mesh is only closed
+/// there when `crease_angle` is pi.
+MeshData tessellate_welded(
+    const OcctShape& shape,
+    double deflection,
+    double crease_angle = 0.5
+);
+
 //------------------------------------------------------------------------------
 // Adaptive Tessellation
 //------------------------------------------------------------------------------
 
+/// Tessellate with per-face deflection from curvature and face size
+/// (see AdaptiveMeshOptions). A copy of the shape is meshed, so the
+/// shape's own triangulations are left untouched.
+MeshData tessellate_adaptive(
+    const OcctShape& shape,
+    const AdaptiveMeshOptions& options
+);
+
 /// Tessellate with curvature-based refinement
 MeshData tessellate_adaptive(
     const OcctShape& shape,
@@ -106,7 +148,8 @@ MeshData tessellate_adaptive(
     double curvature_factor = 1.0
 );
 
-/// Tessellate with edge length control
+/// Tessellate with edge length control: no triangle edge longer than
+/// `max_edge_length`, no element smaller than `min_edge_length`
 MeshData tessellate_edge_length(
     const OcctShape& shape,
     double min_edge_length,
@@ -117,14 +160,39 @@ MeshData tessellate_edge_length(
 // LOD (Level of Detail)
 //------------------------------------------------------------------------------
 
+/// One level of detail
+struct LODLevel {
+    MeshData mesh;
+    double deflection = 0.0;  // Requested linear deflection
+    double error = 0.0;       // Estimated deviation from the exact surface
+};
+
+/// Build one level per deflection, finest first. The shape is meshed once at
+/// the finest deflection; coarser levels are derived from the previous level
+/// by quadric simplification (B-rep face borders preserved), so the shape's
+/// stored triangulation is never replaced by a coarser one.
+/// Each level's error is the tessellation deflection plus the accumulated
+/// simplification error (RMS), kept at or below the level's deflection.
+std::vector<LODLevel> generate_lod_levels(
+    const OcctShape& shape,
+    const std::vector<double>& deflections
+);
+
 /// Generate multiple LODs
 struct LODMesh {
     MeshData high;
     MeshData medium;
     MeshData low;
     MeshData preview;
+
+    // Estimated deviation from the exact surface per level
+    double high_error = 0.0;
+    double medium_error = 0.0;
+    double low_error = 0.0;
+    double preview_error = 0.0;
 };
 
+/// Four-level convenience wrapper around generate_lod_levels()
 LODMesh generate_lods(
     const OcctShape& shape,
     double high_deflection = 0.01,
@@ -178,13 +246,15 @@ WireframeMesh extract_sharp_edges(
 // Mesh Simplification
 //------------------------------------------------------------------------------
 
-/// Decimate mesh to target triangle count
+/// Decimate mesh to target triangle count (quadric error edge collapse).
+/// Positions are welded for connectivity; with face_ids, B-rep face borders
+/// are kept as edges and each triangle keeps its face's normals.
 MeshData decimate(
     const MeshData& mesh,
     uint32_t target_triangles
 );
 
-/// Decimate to target vertex count
+/// Decimate to target vertex count (distinct positions)
 MeshData decimate_vertices(
     const MeshData& mesh,
     uint32_t target_vertices
@@ -193,16 +263,35 @@ MeshData decimate_vertices(
 /// Simplify preserving features
 MeshData simplify_preserve_features(
     const MeshData& mesh,
-    double feature_angle,  // Preserve edges above this angle
-    float reduction_ratio  // 0.5 = half triangles
+    double feature_angle,  // Preserve edges above this angle (radians)
+    float reduction_ratio  // Fraction of triangles to remove (0.5 = half)
+);
+
+/// Simplify with explicit limits (see SimplifyOptions).
+/// `error`, if given, receives the largest collapse error.
+MeshData simplify(
+    const MeshData& mesh,
+    const SimplifyOptions& options,
+    double* error = nullptr
 );
 
 //------------------------------------------------------------------------------
 // Mesh Optimization
 //------------------------------------------------------------------------------
 
-/// Optimize mesh for rendering (reorder for cache)
-MeshData optimize_for_rendering(const MeshData& mesh);
+/// Optimize mesh for rendering: reorder triangles for the post-transform
+/// vertex cache and overdraw, then vertices for fetch locality.
+/// With options.group_by_face, each face's triangles stay contiguous.
+MeshData optimize_for_rendering(
+    const MeshData& mesh,
+    const RenderOptimizeOptions& options = {}
+);
+
+/// Simulated vertex cache efficiency (ACMR/ATVR) of a mesh
+VertexCacheStats analyze_vertex_cache(
+    const MeshData& mesh,
+    uint32_t cache_size = DEFAULT_VERTEX_CACHE_SIZE
+);
 
 /// Merge duplicate vertices
 MeshData merge_vertices(
@@ -0,0 +1,57 @@
+/**
+ * @file simplify.hpp
+ * @brief Quadric-error edge-collapse mesh simplification
+ *
+ * Garland-Heckbert quadric error metric with half-edge collapses (vertices
+ * collapse onto a neighbour, so no new vertices are created), driven by a
+ * priority queue. Open boundaries, borders between triangle groups (B-rep
+ * faces) and creases above a feature angle only slide along themselves;
+ * their corners never move. Collapses that flip a triangle or make the
+ * surface non-manifold are rejected.
+ *
+ * Input must be welded (vertices shared between adjacent triangles).
+ * This header has no OpenCASCADE dependency.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace cadhy::mesh {
+
+//------------------------------------------------------------------------------
+// Mesh Simplification
+//------------------------------------------------------------------------------
+
+/// Simplification settings. Collapsing stops at whichever limit is hit first.
+struct SimplifyOptions {
+    size_t target_triangles = 0;  // Stop at or below this many triangles (0 = no limit)
+    size_t target_vertices = 0;   // Stop at or below this many vertices (0 = no limit)
+    double max_error = std::numeric_limits<double>::infinity();  // Max RMS deviation of a collapse
+    bool preserve_group_borders = true;  // Borders between triangle groups are kept as edges
+    double feature_angle = 0.0;  // Keep edges with a dihedral angle above this (radians, 0 = off)
+};
+
+/// Simplification result
+struct SimplifyResult {
+    std::vector<uint32_t> indices;    // Remaining triangles (input vertex indices)
+    std::vector<uint32_t> triangles;  // Input triangle each remaining triangle came from
+    double error = 0.0;               // Largest collapse error (RMS distance)
+};
+
+/// Simplify a welded triangle mesh.
+/// `positions` is [x0,y0,z0, x1,y1,z1, ...]; `triangle_groups` (one id per
+/// triangle, may be null) marks group borders to preserve.
+SimplifyResult simplify_mesh(
+    const float* positions,
+    size_t vertex_count,
+    const uint32_t* indices,
+    size_t triangle_count,
+    const uint32_t* triangle_groups,
+    const SimplifyOptions& options
+);
+
+} // namespace cadhy::mesh
@@ -0,0 +1,75 @@
+/**
+ * @file slice.hpp
+ * @brief Fast plane sections of welded triangle meshes
+ *
+ * Approximate counterpart of BRepAlgoAPI_Section for interactive clipping
+ * planes. Signed vertex distances are computed by a branch-free loop over
+ * structure-of-arrays positions (auto-vectorised); each triangle that
+ * straddles the plane contributes one segment between two mesh-edge
+ * crossings, and segments are chained into loops through a hash on their
+ * edge keys. On a closed, consistently oriented mesh, loops are closed and
+ * outer boundaries run counter-clockwise in plane coordinates (holes
+ * clockwise).
+ *
+ * Input must be welded (vertices shared between adjacent triangles).
+ * This header has no OpenCASCADE dependency.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace cadhy::mesh {
+
+//------------------------------------------------------------------------------
+// Mesh Slicing
+//------------------------------------------------------------------------------
+
+/// Plane with an in-plane frame; (x_axis, y_axis, normal) must be
+/// orthonormal and right-handed
+struct SlicePlane {
+    double origin[3];
+    double normal[3];
+    double x_axis[3];
+    double y_axis[3];
+};
+
+/// One section polyline in plane coordinates
+struct SliceLoop {
+    std::vector<double> points;  // [x0,y0, x1,y1, ...] (closing point not repeated)
+    bool closed = false;
+};
+
+/**
+ * @brief Welded mesh prepared for repeated slicing
+ *
+ * Keeps its own copy of the mesh, so one instance serves every position of
+ * an interactive section plane. slice() may be called from several threads
+ * (calls are serialised on internal scratch buffers).
+ */
+class MeshSlicer {
+public:
+    /// `positions` is [x0,y0,z0, ...]; `indices` holds three per triangle
+    MeshSlicer(const float* positions, size_t vertex_count,
+               const uint32_t* indices, size_t triangle_count);
+
+    /// Section loops of the mesh with `plane`
+    std::vector<SliceLoop> slice(const SlicePlane& plane) const;
+
+    size_t vertex_count() const { return xs_.size(); }
+    size_t triangle_count() const { return indices_.size() / 3; }
+
+private:
+    std::vector<float> xs_, ys_, zs_;  // Structure of arrays for the distance kernel
+    std::vector<uint32_t> indices_;
+
+    // Per-call scratch, reused across calls
+    mutable std::mutex mutex_;
+    mutable std::vector<float> distances_;
+    mutable std::vector<uint8_t> above_;
+};
+
+} // namespace cadhy::mesh
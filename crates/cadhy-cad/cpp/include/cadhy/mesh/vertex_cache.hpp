@@ -0,0 +1,92 @@
+/**
+ * @file vertex_cache.hpp
+ * @brief Triangle and vertex reordering for GPU rendering
+ *
+ * Triangles are reordered with Tipsify (Sander, Nehab & Barczak, "Fast
+ * Triangle Reordering for Vertex Locality and Reduced Overdraw", 2007) for a
+ * FIFO post-transform vertex cache. The resulting clusters (or the triangles
+ * of each B-rep face) are then sorted outside-in to reduce overdraw, and
+ * vertices are renumbered in first-use order for fetch locality.
+ *
+ * This header has no OpenCASCADE dependency.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cadhy::mesh {
+
+//------------------------------------------------------------------------------
+// Vertex Cache Optimization
+//------------------------------------------------------------------------------
+
+/// Post-transform cache size assumed when none is given
+constexpr uint32_t DEFAULT_VERTEX_CACHE_SIZE = 16;
+
+/// Simulated post-transform cache efficiency
+struct VertexCacheStats {
+    double acmr = 0.0;  // Average cache miss ratio: vertex transforms per triangle
+    double atvr = 0.0;  // Average transform to vertex ratio: 1.0 is optimal
+};
+
+/// Rendering optimization settings
+struct RenderOptimizeOptions {
+    uint32_t cache_size = DEFAULT_VERTEX_CACHE_SIZE;  // FIFO cache size to optimize for
+    bool group_by_face = true;    // Keep each face's triangles contiguous (face picking)
+    bool reduce_overdraw = true;  // Draw outward-facing clusters first
+};
+
+/// Cache statistics before and after optimization
+struct RenderOptimizeReport {
+    VertexCacheStats before;
+    VertexCacheStats after;
+};
+
+/// Simulate a FIFO vertex cache over an index buffer
+VertexCacheStats analyze_vertex_cache(
+    const uint32_t* indices,
+    size_t index_count,
+    size_t vertex_count,
+    uint32_t cache_size = DEFAULT_VERTEX_CACHE_SIZE
+);
+
+/// Triangle order for rendering (output triangle -> input triangle).
+/// `triangle_groups` (one id per triangle, may be null) keeps triangles with
+/// equal ids contiguous. `positions` (x, y, z at the start of every
+/// `position_stride` floats, may be null) is needed for overdraw sorting.
+std::vector<uint32_t> optimize_triangle_order(
+    const uint32_t* indices,
+    size_t triangle_count,
+    size_t vertex_count,
+    const uint32_t* triangle_groups,
+    const float* positions,
+    size_t position_stride,
+    const RenderOptimizeOptions& options = {}
+);
+
+/// Vertex renumbering in first-use order (input vertex -> output vertex).
+/// Unreferenced vertices are kept and moved to the end.
+std::vector<uint32_t> optimize_vertex_fetch(
+    const uint32_t* indices,
+    size_t index_count,
+    size_t vertex_count
+);
+
+/// Reorder an indexed mesh in place: triangles together with their group ids
+/// (may be null), then the interleaved vertex data (`vertex_stride` floats per
+/// vertex, position first). Buffers are left untouched if an index is out of
+/// range.
+RenderOptimizeReport optimize_mesh_buffers(
+    float* vertex_data,
+    size_t vertex_stride,
+    size_t vertex_count,
+    uint32_t* indices,
+    size_t triangle_count,
+    uint32_t* triangle_groups,
+    const RenderOptimizeOptions& options = {}
+);
+
+} // namespace cadhy::mesh
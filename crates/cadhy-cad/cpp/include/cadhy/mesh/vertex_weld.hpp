@@ -0,0 +1,60 @@
+/**
+ * @file vertex_weld.hpp
+ * @brief Tolerance-based vertex welding engine
+ *
+ * Merges mesh vertices that lie within a distance tolerance of each other.
+ * Positions are quantised into packed 64-bit cell keys; small and medium
+ * meshes use an open-addressing spatial hash, very large meshes a parallel
+ * radix sort over the keys. Neighbouring cells are probed so that points
+ * within tolerance across a cell boundary still merge.
+ *
+ * This header has no OpenCASCADE dependency.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cadhy::mesh {
+
+//------------------------------------------------------------------------------
+// Vertex Welding
+//------------------------------------------------------------------------------
+
+/// Vertex count above which weld_positions() switches to the sort path
+constexpr size_t WELD_SORT_THRESHOLD = 10000000;
+
+/// Welding result
+struct WeldMap {
+    std::vector<uint32_t> remap;   // Input vertex -> output vertex
+    std::vector<uint32_t> unique;  // Output vertex -> representative input vertex
+};
+
+/// Weld positions ([x0,y0,z0, x1,y1,z1, ...]) within `tolerance`.
+/// Each vertex maps to the lowest-index representative within tolerance;
+/// output vertices keep the order of their first occurrence.
+WeldMap weld_positions(
+    const float* positions,
+    size_t vertex_count,
+    double tolerance
+);
+
+/// Spatial-hash path (single-threaded, used below WELD_SORT_THRESHOLD)
+WeldMap weld_positions_hashed(
+    const float* positions,
+    size_t vertex_count,
+    double tolerance
+);
+
+/// Parallel radix-sort path (used at or above WELD_SORT_THRESHOLD).
+/// Quantisation, sorting and neighbour search run in parallel; the final
+/// greedy pass is linear. Produces the same result as the hash path.
+WeldMap weld_positions_sorted(
+    const float* positions,
+    size_t vertex_count,
+    double tolerance
+);
+
+} // namespace cadhy::mesh
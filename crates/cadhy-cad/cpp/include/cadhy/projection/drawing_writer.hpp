@@ -0,0 +1,128 @@
+/**
+ * @file drawing_writer.hpp
+ * @brief Streaming SVG/DXF writer for 2D drawing output
+ *
+ * Entities are formatted straight into a fixed-size buffer that is handed
+ * to a sink (file descriptor or callback) whenever it fills, so exporting a
+ * large sheet never holds the whole document in memory. Numbers go through
+ * std::to_chars, optionally snapped to a coordinate quantum first.
+ *
+ * Formats:
+ * - SVG: one <path> per entity, y flipped so drawing +Y points up
+ * - DXF R12 (AC1009): LINE, ARC, CIRCLE, POLYLINE/VERTEX; ellipses are
+ *   written as polylines (R12 has no ELLIPSE)
+ * - DXF R2000 (AC1015): LINE, ARC, CIRCLE, ELLIPSE, LWPOLYLINE, with
+ *   handles, owners and subclass markers, plus the minimal structure R2000
+ *   readers require: $HANDSEED, the full symbol table set with
+ *   BLOCK_RECORD, *Model_Space and *Paper_Space blocks and the root OBJECTS
+ *   dictionary
+ *
+ * Layers VISIBLE, HIDDEN and CENTER carry the line style.
+ * This header has no OpenCASCADE dependency.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace cadhy::projection {
+
+//------------------------------------------------------------------------------
+// Drawing Writer
+//------------------------------------------------------------------------------
+
+enum class DrawingFormat {
+    Svg,
+    DxfR12,
+    DxfR2000
+};
+
+/// Line style / DXF layer of an entity
+enum class DrawingLayer {
+    Visible,
+    Hidden,
+    Center
+};
+
+struct DrawingWriterOptions {
+    DrawingFormat format = DrawingFormat::Svg;
+    int precision = 4;               // Digits after the decimal point (trailing zeros dropped)
+    double quantum = 0.0;            // Snap coordinates to multiples of this (0 = off)
+    double chord_tolerance = 1e-3;   // Ellipse flattening for DXF R12
+    size_t buffer_size = 64 * 1024;  // Bytes buffered before each sink call
+};
+
+/// Receives consecutive chunks of the document; return false to abort
+using DrawingSink = std::function<bool(const char* data, size_t size)>;
+
+/// Sink writing to an open file descriptor (left open)
+DrawingSink fd_sink(int fd);
+
+/**
+ * @brief Streaming writer for one drawing document
+ *
+ * Call begin(), any number of entity methods, then finish(). Angles are in
+ * radians; arcs and elliptical arcs run from start to end counter-clockwise
+ * when `ccw` is set, clockwise otherwise. Once the sink fails, further
+ * output is dropped and ok() returns false.
+ */
+class DrawingWriter {
+public:
+    explicit DrawingWriter(DrawingSink sink, const DrawingWriterOptions& options = {});
+
+    DrawingWriter(const DrawingWriter&) = delete;
+    DrawingWriter& operator=(const DrawingWriter&) = delete;
+
+    /// Write the document header; the extents set the SVG view box
+    void begin(double min_x, double min_y, double max_x, double max_y);
+
+    void line(DrawingLayer layer, double x0, double y0, double x1, double y1);
+
+    void arc(DrawingLayer layer, double cx, double cy, double radius,
+             double start_angle, double end_angle, bool ccw);
+
+    void circle(DrawingLayer layer, double cx, double cy, double radius);
+
+    /// `rotation` is the major axis angle; start/end are ellipse parameters
+    /// (a full ellipse spans 2*pi)
+    void ellipse(DrawingLayer layer, double cx, double cy,
+                 double major_radius, double minor_radius, double rotation,
+                 double start_param, double end_param, bool ccw);
+
+    /// `points` is [x0,y0, x1,y1, ...]
+    void polyline(DrawingLayer layer, const double* points, size_t count, bool closed = false);
+
+    /// Write the trailer and flush; false if any sink call failed
+    bool finish();
+
+    bool ok() const { return ok_; }
+    uint64_t bytes_written() const { return bytes_written_; }
+
+private:
+    void put(const char* text, size_t size);
+    void put(const char* text);
+    void put_number(double value, bool coordinate = true);
+    void put_integer(int64_t value);
+    void put_handle();
+    void flush();
+
+    void dxf_code(int code);
+    void dxf_number(int code, double value, bool coordinate = true);
+    void dxf_handle(int code, uint64_t handle);
+    void dxf_layer(DrawingLayer layer);
+    void dxf_entity(const char* type, DrawingLayer layer, const char* subclass);
+    void svg_open_path(DrawingLayer layer);
+    void svg_point(char command, double x, double y);
+
+    DrawingSink sink_;
+    DrawingWriterOptions options_;
+    std::string buffer_;
+    uint64_t bytes_written_ = 0;
+    uint64_t next_handle_ = 0x100;
+    bool ok_ = true;
+};
+
+} // namespace cadhy::projection
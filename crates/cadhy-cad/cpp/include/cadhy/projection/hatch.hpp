@@ -0,0 +1,86 @@
+/**
+ * @file hatch.hpp
+ * @brief Scanline hatch generation for section regions
+ *
+ * Hatch lines are swept in a frame rotated to the hatch angle, so every
+ * hatch line is a scanline. Polygon edges are bucketed by the first
+ * scanline they reach and kept in an active edge table while the sweep
+ * passes them; each scanline only sorts the crossings of its active edges.
+ * Cost is O(edges + crossings · log(active)) instead of testing every
+ * hatch line against every edge.
+ *
+ * Several rings can be hatched together: with the even-odd or nonzero rule,
+ * holes (and overlapping regions) are handled in one pass.
+ * This header has no OpenCASCADE dependency.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace cadhy::projection {
+
+//------------------------------------------------------------------------------
+// Scanline Hatching
+//------------------------------------------------------------------------------
+
+/// Inside test for overlapping rings
+enum class FillRule {
+    EvenOdd,  // Inside where an odd number of rings cover the point
+    NonZero   // Inside where the ring winding number is non-zero
+};
+
+/// Hatch line layout. Lines run at `angle_deg` and lie `spacing` apart,
+/// one of them through the anchor point.
+struct HatchOptions {
+    double angle_deg = 45.0;
+    double spacing = 1.0;
+    double anchor_x = 0.0;
+    double anchor_y = 0.0;
+    FillRule rule = FillRule::EvenOdd;
+    double min_length = 1e-6;  // Shorter segments are dropped
+};
+
+/// One hatch segment
+struct HatchSegment {
+    double x0, y0;
+    double x1, y1;
+};
+
+/// Polygon ring as [x0,y0, x1,y1, ...] (closing point not repeated)
+struct HatchRing {
+    const double* points;
+    size_t count;  // Number of points
+};
+
+/**
+ * @brief Hatch the area enclosed by `rings`
+ *
+ * Segments are appended to `out`, which callers may reserve (or reuse
+ * across calls) to avoid reallocation. Segments of one hatch line come in
+ * order along the line direction; lines come in order of their offset.
+ *
+ * @return Number of segments appended
+ */
+size_t hatch_rings(const std::vector<HatchRing>& rings,
+                   const HatchOptions& options,
+                   std::vector<HatchSegment>& out);
+
+/// Receives the segments of hatch_rings() in output order
+using HatchSink = std::function<void(const HatchSegment&)>;
+
+/**
+ * @brief Hatch the area enclosed by `rings`, handing each segment to `sink`
+ *
+ * Same segments and order as the vector overload, for callers that write
+ * into their own output buffers.
+ *
+ * @return Number of segments emitted
+ */
+size_t hatch_rings(const std::vector<HatchRing>& rings,
+                   const HatchOptions& options,
+                   const HatchSink& sink);
+
+} // namespace cadhy::projection
@@ -0,0 +1,72 @@
+/**
+ * @file hlr_cleanup.hpp
+ * @brief Post-processing of HLR line output for drawings
+ *
+ * HLR of B-spline-heavy models yields many short segments and dense
+ * polylines, often drawn twice (a visible edge over its hidden copy, or a
+ * sharp edge coinciding with an outline). cleanup_hlr_strokes() turns that
+ * into compact drawing geometry, all under one chordal tolerance:
+ *
+ * 1. Overlap removal: strokes are split into segments; visible segments are
+ *    accepted first, and each later segment loses the parts lying along an
+ *    already accepted one (uniform grid over accepted segments).
+ * 2. Joining: segment ends are welded through a spatial hash and chains of
+ *    one line type are followed through every two-way junction.
+ * 3. Arc fitting: runs of points that lie on a circle (and not on a line)
+ *    become arcs, found by a greedy grow-and-bisect search.
+ * 4. Douglas-Peucker on what remains, which also merges collinear runs.
+ *
+ * This header has no OpenCASCADE dependency.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cadhy::projection {
+
+//------------------------------------------------------------------------------
+// HLR Cleanup
+//------------------------------------------------------------------------------
+
+/// Polyline of one line type
+struct HlrStroke {
+    std::vector<double> points;  // [x0,y0, x1,y1, ...]
+    int32_t line_type = 0;       // Caller's line type code, kept on output
+    bool hidden = false;         // Hidden strokes yield to visible ones
+    bool closed = false;         // Output only: last point joins the first
+};
+
+/// Circular arc fitted to a stroke run; full circles have end = start + 2*pi
+struct HlrArc {
+    double cx, cy, radius;
+    double start_angle, end_angle;  // Radians
+    bool ccw;
+    bool full_circle;
+    int32_t line_type;
+    bool hidden;
+};
+
+struct HlrCleanupOptions {
+    double tolerance = 0.01;       // Chordal tolerance (drawing units)
+    bool remove_overlaps = true;
+    bool fit_arcs = true;
+    size_t min_arc_points = 6;     // Fewer points are left to Douglas-Peucker
+    double max_arc_radius = 1e6;   // Flatter runs stay polylines
+    double min_length = 0.0;       // Output strokes shorter than this are dropped
+};
+
+struct HlrCleanupResult {
+    std::vector<HlrStroke> strokes;
+    std::vector<HlrArc> arcs;
+    size_t input_points = 0;
+    size_t output_points = 0;      // Stroke points plus two per arc
+};
+
+/// Clean up `input` (see file comment). Output order is deterministic.
+HlrCleanupResult cleanup_hlr_strokes(const std::vector<HlrStroke>& input,
+                                     const HlrCleanupOptions& options = {});
+
+} // namespace cadhy::projection
@@ -9,6 +9,8 @@
 #pragma once
 
 #include "../core/types.hpp"
+#include "drawing_writer.hpp"
+#include "hlr_cleanup.hpp"
 
 #include <HLRBRep_Algo.hxx>
 #include <HLRBRep_HLRToShape.hxx>
@@ -108,6 +110,7 @@ struct HLROptions {
     int iso_count = 5;               // Number of iso lines per direction
     bool use_poly_algo = false;      // Use faster polygon-based HLR
     double poly_deflection = 0.1;    // Deflection for poly algo
+    unsigned max_workers = 0;        // Views computed concurrently (0 = hardware threads)
 };
 
 /// Compute HLR with standard view
@@ -167,6 +170,17 @@ struct EngineeringViews {
     HLRResult isometric;
 };
 
+/// Compute HLR for several view directions.
+/// The shape is prepared once for the whole batch (bounding box, and the
+/// triangulation when `use_poly_algo` is set); the per-view hide passes then
+/// run concurrently on up to `options.max_workers` threads. Results are in
+/// the order of `directions`.
+std::vector<HLRResult> compute_hlr_views(
+    const OcctShape& shape,
+    const std::vector<Vector3D>& directions,
+    const HLROptions& options = {}
+);
+
 /// Generate standard engineering views
 EngineeringViews generate_engineering_views(
     const OcctShape& shape,
@@ -212,7 +226,8 @@ SectionResult section_at_x(const OcctShape& shape, double x);
 SectionResult section_at_y(const OcctShape& shape, double y);
 SectionResult section_at_z(const OcctShape& shape, double z);
 
-/// Compute multiple sections
+/// Compute `count` evenly spaced sections; plane i passes through
+/// normal * (start + i * step). Batched like sections_at_offsets.
 std::vector<SectionResult> sections_parallel(
     const OcctShape& shape,
     const Vector3D& normal,
@@ -221,6 +236,19 @@ std::vector<SectionResult> sections_parallel(
     int count
 );
 
+/// Sections with the planes perpendicular to `normal` at signed distances
+/// `offsets` from the origin (along the normalised normal). Face extents
+/// along the normal are computed once and swept against the sorted planes,
+/// so each plane only intersects the faces it crosses; planes are cut
+/// concurrently on up to `max_workers` threads (0 = hardware threads).
+/// Results match section_by_plane and are in the order of `offsets`.
+std::vector<SectionResult> sections_at_offsets(
+    const OcctShape& shape,
+    const Vector3D& normal,
+    const std::vector<double>& offsets,
+    unsigned max_workers = 0
+);
+
 /// Section with another shape (intersection)
 SectionResult section_with_shape(
     const OcctShape& shape1,
@@ -399,6 +427,15 @@ std::string hlr_to_svg_path(
 /// Convert HLR result to DXF entities
 std::string hlr_to_dxf(const HLRResult& hlr);
 
+/// Stream an HLR result as a complete SVG or DXF document (begin, entities,
+/// finish). Unlike hlr_to_svg_path/hlr_to_dxf nothing is accumulated beyond
+/// the writer's buffer. Returns false if the writer's sink failed.
+bool write_hlr_drawing(
+    const HLRResult& hlr,
+    DrawingWriter& writer,
+    bool visible_only = false
+);
+
 /// Scale and center projection
 HLRResult fit_to_view(
     const HLRResult& hlr,
@@ -418,4 +455,13 @@ HLRResult simplify_hlr(
     double min_length = 0.1
 );
 
+/// Simplify HLR result with cleanup_hlr_strokes (overlap removal, joining,
+/// arc fitting, Douglas-Peucker). Fitted arcs are flattened back within the
+/// tolerance, since HLRResult only holds lines and polylines; source
+/// edge/face indices are lost (-1).
+HLRResult simplify_hlr(
+    const HLRResult& hlr,
+    const HlrCleanupOptions& options
+);
+
 } // namespace cadhy::projection
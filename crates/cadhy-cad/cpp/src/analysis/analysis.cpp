@@ -329,7 +329,8 @@ std::unique_ptr<OcctShape> fix_wire(const OcctShape& wire) {
 
 std::unique_ptr<OcctShape> sew_faces(
     const std::vector<const OcctShape*>& faces,
-    double tolerance
+    double tolerance,
+    const Message_ProgressRange& range
 ) {
     BRepBuilderAPI_Sewing sewer(tolerance);
 
@@ -337,7 +338,8 @@ std::unique_ptr<OcctShape> sew_faces(
         sewer.Add(face->get());
     }
 
-    sewer.Perform();
+    sewer.Perform(range);
+    if (range.UserBreak()) return nullptr;
     TopoDS_Shape result = sewer.SewedShape();
 
     if (result.IsNull()) return nullptr;
@@ -7,20 +7,24 @@
 
 #include <cadhy/boolean/boolean.hpp>
 
+#include <BRepAlgoAPI_BooleanOperation.hxx>
 #include <BRepAlgoAPI_Fuse.hxx>
 #include <BRepAlgoAPI_Cut.hxx>
 #include <BRepAlgoAPI_Common.hxx>
 #include <BRepAlgoAPI_Section.hxx>
 #include <BRepAlgoAPI_Splitter.hxx>
+#include <BRepTools_History.hxx>
 #include <BRepCheck_Analyzer.hxx>
 #include <ShapeUpgrade_UnifySameDomain.hxx>
 #include <ShapeFix_Shape.hxx>
 #include <TopTools_ListOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <BOPAlgo_PaveFiller.hxx>
 #include <BOPAlgo_MakerVolume.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
 #include <BRep_Builder.hxx>
+#include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <gp_Pln.hxx>
@@ -28,6 +32,18 @@
 #include <BRepExtrema_DistShapeShape.hxx>
 #include <BRepGProp.hxx>
 #include <GProp_GProps.hxx>
+#include <Bnd_Box.hxx>
+#include <Bnd_OBB.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BRep_Tool.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <OSD_Parallel.hxx>
+#include <Precision.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
 
 namespace cadhy::boolean {
 
@@ -42,6 +58,7 @@ template<typename T>
 void apply_options(T& op, const BooleanOptions& options) {
     op.SetFuzzyValue(options.fuzzy_tolerance);
     op.SetRunParallel(options.parallel);
+    op.SetUseOBB(options.use_obb);
     op.SetNonDestructive(options.non_destructive);
 
     if (options.check_inverted) {
@@ -53,19 +70,75 @@ void apply_options(T& op, const BooleanOptions& options) {
     }
 }
 
-/// Validate and clean result
-std::unique_ptr<OcctShape> finalize_result(const TopoDS_Shape& result) {
+/// Whether the operation failed under `options`
+template<typename T>
+bool failed(const T& op, const BooleanOptions& options) {
+    return !op.IsDone() || (options.fail_on_errors && op.HasErrors());
+}
+
+/// Validate and clean result. Faces the operation left untouched keep the
+/// arguments' cached triangulations, so re-meshing only touches new faces.
+/// `history` maps the sources to `result` and is extended by the unify.
+/// `unify_edges` = false leaves edges alone (closed curves on cones and
+/// cylinders can break when their edges are merged). `passthrough` shapes
+/// join the unified result in a compound, untouched.
+std::unique_ptr<OcctShape> finalize_shape(
+    const TopoDS_Shape& result,
+    const Handle(BRepTools_History)& history,
+    const std::vector<const OcctShape*>& sources,
+    bool unify_edges = true,
+    const std::vector<TopoDS_Shape>& passthrough = {}
+) {
     if (result.IsNull()) {
         return nullptr;
     }
 
     // Unify same domain faces to clean up result
-    ShapeUpgrade_UnifySameDomain unifier(result);
+    ShapeUpgrade_UnifySameDomain unifier(result, unify_edges, Standard_True, Standard_False);
     unifier.Build();
 
-    TopoDS_Shape final_shape = unifier.Shape().IsNull() ? result : unifier.Shape();
+    TopoDS_Shape final_shape = result;
+    if (!unifier.Shape().IsNull()) {
+        final_shape = unifier.Shape();
+        history->Merge(unifier.History());
+    }
+
+    if (!passthrough.empty()) {
+        TopoDS_Compound compound;
+        BRep_Builder builder;
+        builder.MakeCompound(compound);
+        for (const TopoDS_Shape& kept : passthrough) {
+            builder.Add(compound, kept);
+        }
+        if (final_shape.ShapeType() == TopAbs_COMPOUND) {
+            for (TopoDS_Iterator it(final_shape); it.More(); it.Next()) {
+                builder.Add(compound, it.Value());
+            }
+        } else {
+            builder.Add(compound, final_shape);
+        }
+        final_shape = compound;
+    }
+
+    auto shape = std::make_unique<OcctShape>(final_shape);
+    for (const OcctShape* source : sources) {
+        if (source) {
+            shape->mesh_cache().inherit(source->get(), source->mesh_cache(), history);
+        }
+    }
+    return shape;
+}
 
-    return std::make_unique<OcctShape>(final_shape);
+std::unique_ptr<OcctShape> finalize_result(
+    BRepAlgoAPI_BuilderAlgo& op,
+    const std::vector<const OcctShape*>& sources,
+    bool unify_edges = true
+) {
+    Handle(BRepTools_History) history = new BRepTools_History;
+    if (!op.History().IsNull()) {
+        history->Merge(op.History());
+    }
+    return finalize_shape(op.Shape(), history, sources, unify_edges);
 }
 
 /// Get const reference to underlying shape
@@ -73,6 +146,310 @@ inline const TopoDS_Shape& get_shape(const OcctShape& s) {
     return s.get();
 }
 
+//------------------------------------------------------------------------------
+// Fuse Tree
+//------------------------------------------------------------------------------
+
+/// Leaves of the fuse_many tree hold at most this many inputs
+constexpr size_t FUSE_TREE_LEAF_SIZE = 8;
+
+using Clock = std::chrono::steady_clock;
+
+double seconds_since(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/// Shape carried up the tree. Parts of one node never intersect each other,
+/// although their boxes may overlap.
+struct FusePart {
+    TopoDS_Shape shape;
+    Bnd_Box box;
+};
+
+struct FuseNode {
+    size_t begin = 0, end = 0;  // Range of the input order (leaves only)
+    int left = -1, right = -1;
+    int height = 0;             // 0 for leaves
+    std::vector<FusePart> parts;
+    std::vector<Handle(BRepTools_History)> histories;
+    size_t booleans = 0;
+    size_t passthrough = 0;
+    bool ok = true;
+};
+
+/// Split order[begin, end) at the median center along the longest axis
+int build_fuse_tree(
+    std::vector<FuseNode>& nodes,
+    std::vector<size_t>& order,
+    const std::vector<gp_Pnt>& centers,
+    size_t begin,
+    size_t end
+) {
+    const int index = static_cast<int>(nodes.size());
+    nodes.emplace_back();
+    nodes[index].begin = begin;
+    nodes[index].end = end;
+    if (end - begin <= FUSE_TREE_LEAF_SIZE) {
+        return index;
+    }
+
+    Bnd_Box extent;
+    for (size_t i = begin; i < end; ++i) {
+        extent.Add(centers[order[i]]);
+    }
+    double xmin, ymin, zmin, xmax, ymax, zmax;
+    extent.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+    int axis = 1;
+    if (ymax - ymin > xmax - xmin) axis = 2;
+    if (zmax - zmin > std::max(xmax - xmin, ymax - ymin)) axis = 3;
+
+    const size_t mid = begin + (end - begin) / 2;
+    std::nth_element(order.begin() + begin, order.begin() + mid, order.begin() + end,
+        [&](size_t a, size_t b) { return centers[a].Coord(axis) < centers[b].Coord(axis); });
+
+    const int left = build_fuse_tree(nodes, order, centers, begin, mid);
+    const int right = build_fuse_tree(nodes, order, centers, mid, end);
+    nodes[index].left = left;
+    nodes[index].right = right;
+    nodes[index].height = std::max(nodes[left].height, nodes[right].height) + 1;
+    return index;
+}
+
+int find_root(std::vector<int>& parent, int i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+/// Group `parts` by box overlap and fuse each group of two or more with one
+/// boolean. Only pairs straddling `split` are tested (the parts on either
+/// side are already disjoint); split = 0 tests every pair.
+void fuse_overlapping(
+    FuseNode& node,
+    std::vector<FusePart> parts,
+    size_t split,
+    const BooleanOptions& options
+) {
+    const int count = static_cast<int>(parts.size());
+    std::vector<int> parent(count);
+    std::iota(parent.begin(), parent.end(), 0);
+
+    const bool straddle = split > 0;
+    Bnd_Box right_box;
+    for (size_t j = split; straddle && j < parts.size(); ++j) {
+        right_box.Add(parts[j].box);
+    }
+    for (int i = 0; i < count; ++i) {
+        if (straddle && (static_cast<size_t>(i) >= split || parts[i].box.IsOut(right_box))) {
+            continue;
+        }
+        for (int j = straddle ? static_cast<int>(split) : i + 1; j < count; ++j) {
+            if (!parts[i].box.IsOut(parts[j].box)) {
+                parent[find_root(parent, j)] = find_root(parent, i);
+            }
+        }
+    }
+
+    std::vector<std::vector<int>> groups(count);
+    for (int i = 0; i < count; ++i) {
+        groups[find_root(parent, i)].push_back(i);
+    }
+
+    for (const std::vector<int>& group : groups) {
+        if (group.empty()) continue;
+        if (group.size() == 1) {
+            node.parts.push_back(std::move(parts[group[0]]));
+            ++node.passthrough;
+            continue;
+        }
+
+        TopTools_ListOfShape arguments, tools;
+        FusePart fused;
+        for (int i : group) {
+            (i == group[0] ? arguments : tools).Append(parts[i].shape);
+            fused.box.Add(parts[i].box);
+        }
+
+        BRepAlgoAPI_Fuse op;
+        op.SetArguments(arguments);
+        op.SetTools(tools);
+        apply_options(op, options);
+        op.Build();
+        if (failed(op, options) || op.Shape().IsNull()) {
+            node.ok = false;
+            return;
+        }
+
+        fused.shape = op.Shape();
+        node.parts.push_back(std::move(fused));
+        if (!op.History().IsNull()) {
+            node.histories.push_back(op.History());
+        }
+        ++node.booleans;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Pre-flight
+//------------------------------------------------------------------------------
+
+/// Where the bodies of one shape lie relative to another shape
+enum class Placement {
+    Inside,
+    Outside,
+    Mixed
+};
+
+/// Append the solids of `shape`; false if it holds anything but solids
+bool collect_solids(const TopoDS_Shape& shape, std::vector<TopoDS_Shape>& solids) {
+    if (shape.ShapeType() == TopAbs_SOLID) {
+        solids.push_back(shape);
+        return true;
+    }
+    if (shape.ShapeType() != TopAbs_COMPOUND && shape.ShapeType() != TopAbs_COMPSOLID) {
+        return false;
+    }
+    for (TopoDS_Iterator it(shape); it.More(); it.Next()) {
+        if (!collect_solids(it.Value(), solids)) return false;
+    }
+    return true;
+}
+
+/// Whether every solid is bounded by a single shell (no internal voids)
+bool single_shell_solids(const std::vector<TopoDS_Shape>& solids) {
+    for (const TopoDS_Shape& solid : solids) {
+        int shells = 0;
+        for (TopoDS_Iterator it(solid); it.More(); it.Next()) {
+            if (it.Value().ShapeType() == TopAbs_SHELL && ++shells > 1) return false;
+        }
+    }
+    return true;
+}
+
+/// Geometric (not triangulation) box, so curved faces are never clipped
+Bnd_Box exact_box(const TopoDS_Shape& shape, double tolerance) {
+    Bnd_Box box;
+    BRepBndLib::Add(shape, box, Standard_False);
+    box.Enlarge(tolerance);
+    return box;
+}
+
+/// Boxes of the faces of `shape` that reach into `region`
+std::vector<Bnd_Box> face_boxes(const TopoDS_Shape& shape, const Bnd_Box& region, double tolerance) {
+    std::vector<Bnd_Box> boxes;
+    for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next()) {
+        Bnd_Box box = exact_box(exp.Current(), tolerance);
+        if (!box.IsOut(region)) boxes.push_back(box);
+    }
+    return boxes;
+}
+
+/// False only when no face box of `a` meets a face box of `b`
+bool boundaries_may_touch(
+    const TopoDS_Shape& a, const Bnd_Box& box_a,
+    const TopoDS_Shape& b, const Bnd_Box& box_b,
+    double tolerance
+) {
+    const std::vector<Bnd_Box> faces_a = face_boxes(a, box_b, tolerance);
+    if (faces_a.empty()) return false;
+    const std::vector<Bnd_Box> faces_b = face_boxes(b, box_a, tolerance);
+    for (const Bnd_Box& fa : faces_a) {
+        for (const Bnd_Box& fb : faces_b) {
+            if (!fa.IsOut(fb)) return true;
+        }
+    }
+    return false;
+}
+
+/// Classify one vertex of each body against `solids`. Only valid once the
+/// boundaries are known to stay apart, so no vertex lies on a boundary.
+Placement place_bodies(
+    const std::vector<TopoDS_Shape>& bodies,
+    const std::vector<TopoDS_Shape>& solids,
+    double tolerance
+) {
+    std::vector<Bnd_Box> solid_boxes;
+    for (const TopoDS_Shape& solid : solids) {
+        solid_boxes.push_back(exact_box(solid, tolerance));
+    }
+
+    size_t inside = 0;
+    for (const TopoDS_Shape& body : bodies) {
+        TopExp_Explorer vertex(body, TopAbs_VERTEX);
+        if (!vertex.More()) return Placement::Mixed;
+        const gp_Pnt point = BRep_Tool::Pnt(TopoDS::Vertex(vertex.Current()));
+
+        for (size_t i = 0; i < solids.size(); ++i) {
+            if (solid_boxes[i].IsOut(point)) continue;
+            BRepClass3d_SolidClassifier classifier(solids[i], point, tolerance);
+            if (classifier.State() == TopAbs_IN) {
+                ++inside;
+                break;
+            }
+        }
+    }
+
+    if (inside == bodies.size()) return Placement::Inside;
+    return inside == 0 ? Placement::Outside : Placement::Mixed;
+}
+
+BooleanPath classify_shapes(const TopoDS_Shape& a, const TopoDS_Shape& b, double tolerance) {
+    if (a.IsNull() || b.IsNull()) return BooleanPath::Full;
+
+    const Bnd_Box box_a = exact_box(a, tolerance);
+    const Bnd_Box box_b = exact_box(b, tolerance);
+    if (box_a.IsVoid() || box_b.IsVoid()) return BooleanPath::Full;
+    if (box_a.IsOut(box_b)) return BooleanPath::Disjoint;
+
+    Bnd_OBB obb_a, obb_b;
+    BRepBndLib::AddOBB(a, obb_a, Standard_False);
+    BRepBndLib::AddOBB(b, obb_b, Standard_False);
+    if (!obb_a.IsVoid() && !obb_b.IsVoid()) {
+        obb_a.Enlarge(tolerance);
+        obb_b.Enlarge(tolerance);
+        if (obb_a.IsOut(obb_b)) return BooleanPath::Disjoint;
+    }
+
+    std::vector<TopoDS_Shape> solids_a, solids_b;
+    if (!collect_solids(a, solids_a) || !collect_solids(b, solids_b) ||
+        solids_a.empty() || solids_b.empty()) {
+        return BooleanPath::Full;
+    }
+    // A void can hold the other shape or sit inside it, so one point no
+    // longer tells where a whole body lies
+    if (!single_shell_solids(solids_a) || !single_shell_solids(solids_b)) return BooleanPath::Full;
+    if (boundaries_may_touch(a, box_a, b, box_b, tolerance)) return BooleanPath::Full;
+
+    // Boundaries apart: every single-shell body is wholly inside or wholly outside
+    const Placement tool_place = place_bodies(solids_b, solids_a, tolerance);
+    if (tool_place == Placement::Inside) return BooleanPath::ToolInside;
+    const Placement argument_place = place_bodies(solids_a, solids_b, tolerance);
+    if (argument_place == Placement::Inside) return BooleanPath::ArgumentInside;
+    if (tool_place == Placement::Outside && argument_place == Placement::Outside) {
+        return BooleanPath::Disjoint;
+    }
+    return BooleanPath::Full;
+}
+
+TopoDS_Compound make_compound(const std::vector<TopoDS_Shape>& shapes) {
+    TopoDS_Compound compound;
+    BRep_Builder builder;
+    builder.MakeCompound(compound);
+    for (const TopoDS_Shape& shape : shapes) {
+        builder.Add(compound, shape);
+    }
+    return compound;
+}
+
+/// Copy of `source` that keeps its cached triangulations
+std::unique_ptr<OcctShape> keep_shape(const OcctShape& source) {
+    auto shape = std::make_unique<OcctShape>(source.get());
+    shape->mesh_cache().inherit(source.get(), source.mesh_cache(), Handle(BRepTools_History)());
+    return shape;
+}
+
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -88,7 +465,7 @@ std::unique_ptr<OcctShape> fuse(
     if (!op.IsDone() || op.HasErrors()) {
         return nullptr;
     }
-    return finalize_result(op.Shape());
+    return finalize_result(op, {&shape1, &shape2});
 }
 
 std::unique_ptr<OcctShape> fuse_with_options(
@@ -106,10 +483,10 @@ std::unique_ptr<OcctShape> fuse_with_options(
     apply_options(op, options);
     op.Build();
 
-    if (!op.IsDone() || op.HasErrors()) {
+    if (failed(op, options)) {
         return nullptr;
     }
-    return finalize_result(op.Shape());
+    return finalize_result(op, {&shape1, &shape2});
 }
 
 std::unique_ptr<OcctShape> cut(
@@ -121,7 +498,7 @@ std::unique_ptr<OcctShape> cut(
     if (!op.IsDone() || op.HasErrors()) {
         return nullptr;
     }
-    return finalize_result(op.Shape());
+    return finalize_result(op, {&shape1, &shape2});
 }
 
 std::unique_ptr<OcctShape> cut_with_options(
@@ -139,10 +516,10 @@ std::unique_ptr<OcctShape> cut_with_options(
     apply_options(op, options);
     op.Build();
 
-    if (!op.IsDone() || op.HasErrors()) {
+    if (failed(op, options)) {
         return nullptr;
     }
-    return finalize_result(op.Shape());
+    return finalize_result(op, {&shape1, &shape2});
 }
 
 std::unique_ptr<OcctShape> common(
@@ -154,7 +531,7 @@ std::unique_ptr<OcctShape> common(
     if (!op.IsDone() || op.HasErrors()) {
         return nullptr;
     }
-    return finalize_result(op.Shape());
+    return finalize_result(op, {&shape1, &shape2});
 }
 
 std::unique_ptr<OcctShape> common_with_options(
@@ -172,10 +549,10 @@ std::unique_ptr<OcctShape> common_with_options(
     apply_options(op, options);
     op.Build();
 
-    if (!op.IsDone() || op.HasErrors()) {
+    if (failed(op, options)) {
         return nullptr;
     }
-    return finalize_result(op.Shape());
+    return finalize_result(op, {&shape1, &shape2});
 }
 
 //------------------------------------------------------------------------------
@@ -183,46 +560,130 @@ std::unique_ptr<OcctShape> common_with_options(
 //------------------------------------------------------------------------------
 
 std::unique_ptr<OcctShape> fuse_many(
-    const std::vector<const OcctShape*>& shapes
+    const std::vector<const OcctShape*>& shapes,
+    const BooleanOptions& options,
+    FuseTreeStats* stats
 ) {
-    if (shapes.empty()) return nullptr;
-    if (shapes.size() == 1 && shapes[0]) {
-        return std::make_unique<OcctShape>(get_shape(*shapes[0]));
-    }
+    const Clock::time_point start = Clock::now();
 
-    TopTools_ListOfShape args;
+    std::vector<const OcctShape*> inputs;
     for (const auto* s : shapes) {
-        if (s && !s->is_null()) {
-            args.Append(get_shape(*s));
-        }
+        if (s && !s->is_null()) inputs.push_back(s);
+    }
+    if (inputs.empty()) return nullptr;
+    if (inputs.size() == 1) {
+        return std::make_unique<OcctShape>(get_shape(*inputs[0]));
     }
 
-    if (args.Size() < 2) return nullptr;
+    // Geometric input boxes, enlarged so that touching shapes land in one
+    // group; triangulation boxes can fall short and keep overlaps apart
+    std::vector<Bnd_Box> boxes(inputs.size());
+    std::vector<gp_Pnt> centers(inputs.size());
+    const double box_gap = std::max(options.fuzzy_tolerance, Precision::Confusion());
+    OSD_Parallel::For(0, static_cast<int>(inputs.size()), [&](int i) {
+        boxes[i] = exact_box(get_shape(*inputs[i]), box_gap);
+        if (!boxes[i].IsVoid()) {
+            double xmin, ymin, zmin, xmax, ymax, zmax;
+            boxes[i].Get(xmin, ymin, zmin, xmax, ymax, zmax);
+            centers[i] = gp_Pnt((xmin + xmax) / 2, (ymin + ymax) / 2, (zmin + zmax) / 2);
+        }
+    }, !options.parallel);
 
-    // Use first shape as argument, rest as tools
-    TopTools_ListOfShape tools;
-    auto it = args.cbegin();
-    TopoDS_Shape first_shape = *it;
-    ++it;
+    std::vector<size_t> order(inputs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<FuseNode> nodes;
+    const int root = build_fuse_tree(nodes, order, centers, 0, order.size());
 
-    TopTools_ListOfShape first_list;
-    first_list.Append(first_shape);
+    std::vector<std::vector<int>> levels(nodes[root].height + 1);
+    for (int i = 0; i < static_cast<int>(nodes.size()); ++i) {
+        levels[nodes[i].height].push_back(i);
+    }
 
-    while (it != args.cend()) {
-        tools.Append(*it);
-        ++it;
+    FuseTreeStats local_stats;
+    FuseTreeStats& out = stats ? *stats : local_stats;
+    out = FuseTreeStats{};
+    out.inputs = inputs.size();
+    out.bounds_seconds = seconds_since(start);
+
+    // Bottom-up. Nodes of one level are independent; the boolean itself only
+    // runs in parallel when the level has a single node. Concurrent fuses
+    // must not touch their inputs, which may share TShapes (repeated or
+    // merely relocated parts).
+    for (const std::vector<int>& level : levels) {
+        const Clock::time_point level_start = Clock::now();
+        BooleanOptions level_options = options;
+        level_options.parallel = options.parallel && level.size() == 1;
+        if (level.size() > 1) level_options.non_destructive = true;
+
+        OSD_Parallel::For(0, static_cast<int>(level.size()), [&](int k) {
+            FuseNode& node = nodes[level[k]];
+            try {
+                std::vector<FusePart> parts;
+                size_t split = 0;
+                if (node.left < 0) {
+                    for (size_t i = node.begin; i < node.end; ++i) {
+                        parts.push_back({get_shape(*inputs[order[i]]), boxes[order[i]]});
+                    }
+                } else {
+                    FuseNode& left = nodes[node.left];
+                    FuseNode& right = nodes[node.right];
+                    parts = std::move(left.parts);
+                    split = parts.size();
+                    for (FusePart& part : right.parts) {
+                        parts.push_back(std::move(part));
+                    }
+                    left.parts.clear();
+                    right.parts.clear();
+                }
+                fuse_overlapping(node, std::move(parts), split, level_options);
+            } catch (const Standard_Failure&) {
+                node.ok = false;
+            }
+        }, !options.parallel || level.size() < 2);
+
+        FuseLevelStats level_stats;
+        level_stats.nodes = level.size();
+        for (int index : level) {
+            if (!nodes[index].ok) return nullptr;
+            level_stats.booleans += nodes[index].booleans;
+            level_stats.passthrough += nodes[index].passthrough;
+        }
+        level_stats.seconds = seconds_since(level_start);
+        out.levels.push_back(level_stats);
     }
 
-    BRepAlgoAPI_Fuse op;
-    op.SetArguments(first_list);
-    op.SetTools(tools);
-    op.SetRunParallel(true);
-    op.Build();
+    // Histories of one level touch disjoint shapes, so merging them in level
+    // order maps every input to the root parts
+    Handle(BRepTools_History) history = new BRepTools_History;
+    for (const std::vector<int>& level : levels) {
+        for (int index : level) {
+            for (const Handle(BRepTools_History)& h : nodes[index].histories) {
+                history->Merge(h);
+            }
+        }
+    }
 
-    if (!op.IsDone() || op.HasErrors()) {
-        return nullptr;
+    const std::vector<FusePart>& parts = nodes[root].parts;
+    TopoDS_Shape result;
+    if (parts.size() == 1) {
+        result = parts[0].shape;
+    } else {
+        TopoDS_Compound compound;
+        BRep_Builder builder;
+        builder.MakeCompound(compound);
+        for (const FusePart& part : parts) {
+            builder.Add(compound, part.shape);
+        }
+        result = compound;
     }
-    return finalize_result(op.Shape());
+
+    const Clock::time_point unify_start = Clock::now();
+    // Edges are left alone: merging them can break the closed curves of
+    // cylinders and cones, which fused part sets are full of
+    std::unique_ptr<OcctShape> shape = finalize_shape(result, history, inputs, false);
+    out.unify_seconds = seconds_since(unify_start);
+    out.total_seconds = seconds_since(start);
+    return shape;
 }
 
 std::unique_ptr<OcctShape> cut_many(
@@ -251,7 +712,9 @@ std::unique_ptr<OcctShape> cut_many(
     if (!op.IsDone() || op.HasErrors()) {
         return nullptr;
     }
-    return finalize_result(op.Shape());
+    std::vector<const OcctShape*> sources = tools;
+    sources.push_back(&base);
+    return finalize_result(op, sources);
 }
 
 std::unique_ptr<OcctShape> common_many(
@@ -273,6 +736,228 @@ std::unique_ptr<OcctShape> common_many(
     return result;
 }
 
+std::unique_ptr<OcctShape> boolean_batch(
+    const std::vector<const OcctShape*>& arguments,
+    const std::vector<const OcctShape*>& tools,
+    BooleanOperation operation,
+    const BooleanOptions& options
+) {
+    TopTools_ListOfShape arg_list, tool_list;
+    for (const auto* a : arguments) {
+        if (a && !a->is_null()) arg_list.Append(get_shape(*a));
+    }
+    for (const auto* t : tools) {
+        if (t && !t->is_null()) tool_list.Append(get_shape(*t));
+    }
+
+    // A fuse needs two groups; split a single list after its first shape
+    if (operation == BooleanOperation::Fuse && tool_list.IsEmpty() && arg_list.Size() > 1) {
+        TopTools_ListOfShape::Iterator it(arg_list);
+        for (it.Next(); it.More(); it.Next()) tool_list.Append(it.Value());
+        TopoDS_Shape first = arg_list.First();
+        arg_list.Clear();
+        arg_list.Append(first);
+    }
+    if (arg_list.IsEmpty() || tool_list.IsEmpty()) return nullptr;
+
+    BRepAlgoAPI_BooleanOperation op;
+    switch (operation) {
+        case BooleanOperation::Fuse: op.SetOperation(BOPAlgo_FUSE); break;
+        case BooleanOperation::Cut: op.SetOperation(BOPAlgo_CUT); break;
+        case BooleanOperation::Common: op.SetOperation(BOPAlgo_COMMON); break;
+    }
+    op.SetArguments(arg_list);
+    op.SetTools(tool_list);
+    apply_options(op, options);
+    op.Build();
+
+    if (failed(op, options)) {
+        return nullptr;
+    }
+
+    std::vector<const OcctShape*> sources = arguments;
+    sources.insert(sources.end(), tools.begin(), tools.end());
+    return finalize_result(op, sources, false);
+}
+
+//------------------------------------------------------------------------------
+// Pre-flight
+//------------------------------------------------------------------------------
+
+BooleanPath classify_boolean(
+    const OcctShape& argument,
+    const OcctShape& tool,
+    double tolerance
+) {
+    return classify_shapes(get_shape(argument), get_shape(tool), tolerance);
+}
+
+namespace {
+
+/// Pre-flight and boolean behind boolean_with_preflight (history set only if a boolean ran)
+std::unique_ptr<OcctShape> run_with_preflight(
+    const OcctShape& argument,
+    const OcctShape& tool,
+    BooleanOperation operation,
+    const BooleanOptions& options,
+    BooleanPreflight& out,
+    Handle(BRepTools_History)& history,
+    const Message_ProgressRange& range
+) {
+    const double tolerance = std::max(options.fuzzy_tolerance, Precision::Confusion());
+    out.path = classify_shapes(get_shape(argument), get_shape(tool), tolerance);
+
+    switch (out.path) {
+        case BooleanPath::Disjoint:
+            if (operation == BooleanOperation::Fuse) {
+                auto shape = std::make_unique<OcctShape>(
+                    make_compound({get_shape(argument), get_shape(tool)}));
+                shape->mesh_cache().inherit(argument.get(), argument.mesh_cache(), Handle(BRepTools_History)());
+                shape->mesh_cache().inherit(tool.get(), tool.mesh_cache(), Handle(BRepTools_History)());
+                return shape;
+            }
+            if (operation == BooleanOperation::Cut) return keep_shape(argument);
+            return std::make_unique<OcctShape>(make_compound({}));
+        case BooleanPath::ToolInside:
+            if (operation == BooleanOperation::Fuse) return keep_shape(argument);
+            if (operation == BooleanOperation::Common) return keep_shape(tool);
+            break;
+        case BooleanPath::ArgumentInside:
+            if (operation == BooleanOperation::Fuse) return keep_shape(tool);
+            if (operation == BooleanOperation::Cut) {
+                return std::make_unique<OcctShape>(make_compound({}));
+            }
+            if (operation == BooleanOperation::Common) return keep_shape(argument);
+            break;
+        case BooleanPath::Full:
+            break;
+    }
+
+    // Cut or common of a compound: settle each body on its own and only
+    // send the undecided ones through the boolean
+    std::vector<TopoDS_Shape> kept, pending;
+    const TopoDS_Shape& argument_shape = get_shape(argument);
+    if (operation != BooleanOperation::Fuse && out.path == BooleanPath::Full &&
+        argument_shape.ShapeType() == TopAbs_COMPOUND) {
+        for (TopoDS_Iterator it(argument_shape); it.More(); it.Next()) {
+            const BooleanPath body_path = classify_shapes(it.Value(), get_shape(tool), tolerance);
+            const bool cut = operation == BooleanOperation::Cut;
+            if (body_path == (cut ? BooleanPath::Disjoint : BooleanPath::ArgumentInside)) {
+                kept.push_back(it.Value());
+            } else if (body_path != (cut ? BooleanPath::ArgumentInside : BooleanPath::Disjoint)) {
+                pending.push_back(it.Value());
+                continue;
+            }
+            ++out.passthrough;
+        }
+        if (pending.empty()) {
+            auto shape = std::make_unique<OcctShape>(make_compound(kept));
+            shape->mesh_cache().inherit(argument.get(), argument.mesh_cache(), Handle(BRepTools_History)());
+            return shape;
+        }
+    } else {
+        pending.push_back(argument_shape);
+    }
+
+    TopTools_ListOfShape arguments, tools;
+    arguments.Append(pending.size() == 1 ? pending[0] : make_compound(pending));
+    tools.Append(get_shape(tool));
+
+    BRepAlgoAPI_BooleanOperation op;
+    switch (operation) {
+        case BooleanOperation::Fuse: op.SetOperation(BOPAlgo_FUSE); break;
+        case BooleanOperation::Cut: op.SetOperation(BOPAlgo_CUT); break;
+        case BooleanOperation::Common: op.SetOperation(BOPAlgo_COMMON); break;
+    }
+    op.SetArguments(arguments);
+    op.SetTools(tools);
+    apply_options(op, options);
+    op.Build(range);
+
+    if (failed(op, options)) {
+        return nullptr;
+    }
+
+    history = new BRepTools_History;
+    if (!op.History().IsNull()) {
+        history->Merge(op.History());
+    }
+    return finalize_shape(op.Shape(), history, {&argument, &tool}, false, kept);
+}
+
+/// Where the sub-shapes of `source` went in `result`
+SubShapeMap map_sub_shapes(
+    const TopoDS_Shape& source,
+    TopAbs_ShapeEnum type,
+    const TopTools_IndexedMapOfShape& result_map,
+    const Handle(BRepTools_History)& history
+) {
+    TopTools_IndexedMapOfShape source_map;
+    TopExp::MapShapes(source, type, source_map);
+
+    SubShapeMap map;
+    const int count = source_map.Extent();
+    map.fates.reserve(count);
+    map.offsets.reserve(count + 1);
+    map.offsets.push_back(0);
+
+    for (int i = 1; i <= count; ++i) {
+        const TopoDS_Shape& shape = source_map(i);
+        ShapeFate fate = ShapeFate::Removed;
+        if (const int index = result_map.FindIndex(shape)) {
+            fate = ShapeFate::Unchanged;
+            map.targets.push_back(static_cast<uint32_t>(index - 1));
+        } else if (!history.IsNull()) {
+            for (const TopoDS_Shape& image : history->Modified(shape)) {
+                if (const int image_index = result_map.FindIndex(image)) {
+                    fate = ShapeFate::Modified;
+                    map.targets.push_back(static_cast<uint32_t>(image_index - 1));
+                }
+            }
+        }
+        map.fates.push_back(fate);
+        map.offsets.push_back(static_cast<uint32_t>(map.targets.size()));
+    }
+    return map;
+}
+
+} // anonymous namespace
+
+std::unique_ptr<OcctShape> boolean_with_preflight(
+    const OcctShape& argument,
+    const OcctShape& tool,
+    BooleanOperation operation,
+    const BooleanOptions& options,
+    BooleanPreflight* report,
+    BooleanProvenance* provenance,
+    const Message_ProgressRange& range
+) {
+    if (argument.is_null() || tool.is_null()) return nullptr;
+
+    BooleanPreflight local_report;
+    BooleanPreflight& out = report ? *report : local_report;
+    out = BooleanPreflight{};
+
+    Handle(BRepTools_History) history;
+    std::unique_ptr<OcctShape> result =
+        run_with_preflight(argument, tool, operation, options, out, history, range);
+    if (!result || !provenance) return result;
+
+    // Shortcuts reuse input sub-shapes as they are, so presence in the
+    // result is the whole story; after a boolean the composed history
+    // (boolean, then unify) maps the rest
+    TopTools_IndexedMapOfShape result_faces, result_edges;
+    TopExp::MapShapes(result->get(), TopAbs_FACE, result_faces);
+    TopExp::MapShapes(result->get(), TopAbs_EDGE, result_edges);
+    provenance->result_faces = static_cast<size_t>(result_faces.Extent());
+    provenance->result_edges = static_cast<size_t>(result_edges.Extent());
+    provenance->argument_faces = map_sub_shapes(get_shape(argument), TopAbs_FACE, result_faces, history);
+    provenance->argument_edges = map_sub_shapes(get_shape(argument), TopAbs_EDGE, result_edges, history);
+    provenance->tool_faces = map_sub_shapes(get_shape(tool), TopAbs_FACE, result_faces, history);
+    provenance->tool_edges = map_sub_shapes(get_shape(tool), TopAbs_EDGE, result_edges, history);
+    return result;
+}
+
 //------------------------------------------------------------------------------
 // Section Operations
 //------------------------------------------------------------------------------
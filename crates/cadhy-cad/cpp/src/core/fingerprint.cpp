@@ -0,0 +1,140 @@
+/**
+ * @file fingerprint.cpp
+ * @brief Implementation of the content-based shape fingerprint
+ */
+
+#include <cadhy/core/fingerprint.hpp>
+
+#include <BRep_Tool.hxx>
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepAdaptor_Surface.hxx>
+#include <BRepTools.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS.hxx>
+#include <gp_Pnt.hxx>
+
+#include <cmath>
+
+namespace cadhy {
+
+//------------------------------------------------------------------------------
+// Internal Helpers
+//------------------------------------------------------------------------------
+
+namespace {
+
+/// Interior samples per edge, at equal steps of its parameter range
+constexpr int EDGE_SAMPLES = 3;
+
+/// Interior samples per direction of a face's UV bounds
+constexpr int FACE_SAMPLES = 3;
+
+/// Incremental 64-bit hash (splitmix64 finaliser over a running state)
+class Hasher {
+public:
+    void add(uint64_t value) {
+        uint64_t z = state_ + value + 0x9e3779b97f4a7c15ull;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        state_ = z ^ (z >> 31);
+    }
+
+    void add_real(double value) {
+        if (!std::isfinite(value)) {
+            add(0x7ff0000000000000ull);
+            return;
+        }
+        add(static_cast<uint64_t>(std::llround(value / FINGERPRINT_QUANTUM)));
+    }
+
+    void add_point(const gp_Pnt& p) {
+        add_real(p.X());
+        add_real(p.Y());
+        add_real(p.Z());
+    }
+
+    uint64_t value() const { return state_; }
+
+private:
+    uint64_t state_ = 0;
+};
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+// Shape Fingerprint
+//------------------------------------------------------------------------------
+
+uint64_t shape_fingerprint(const TopoDS_Shape& shape) {
+    if (shape.IsNull()) return 0;
+
+    TopTools_IndexedMapOfShape vertices, edges, faces;
+    TopExp::MapShapes(shape, TopAbs_VERTEX, vertices);
+    TopExp::MapShapes(shape, TopAbs_EDGE, edges);
+    TopExp::MapShapes(shape, TopAbs_FACE, faces);
+
+    Hasher hash;
+    hash.add(static_cast<uint64_t>(shape.ShapeType()));
+    hash.add(static_cast<uint64_t>(vertices.Extent()));
+    hash.add(static_cast<uint64_t>(edges.Extent()));
+    hash.add(static_cast<uint64_t>(faces.Extent()));
+
+    // Vertex positions (locations applied)
+    for (int i = 1; i <= vertices.Extent(); ++i) {
+        hash.add_point(BRep_Tool::Pnt(TopoDS::Vertex(vertices(i))));
+    }
+
+    // Edges: curve type, parameter range and end vertices
+    for (int i = 1; i <= edges.Extent(); ++i) {
+        const TopoDS_Edge& edge = TopoDS::Edge(edges(i));
+        if (BRep_Tool::Degenerated(edge)) {
+            hash.add(0xdeadull);
+        } else {
+            BRepAdaptor_Curve curve(edge);
+            hash.add(static_cast<uint64_t>(curve.GetType()));
+            const double first = curve.FirstParameter();
+            const double last = curve.LastParameter();
+            hash.add_real(first);
+            hash.add_real(last);
+
+            // Interior points tell apart curves through the same end vertices
+            for (int k = 1; k <= EDGE_SAMPLES; ++k) {
+                hash.add_point(curve.Value(first + (last - first) * k / (EDGE_SAMPLES + 1)));
+            }
+        }
+
+        for (TopExp_Explorer exp(edge, TopAbs_VERTEX); exp.More(); exp.Next()) {
+            hash.add(static_cast<uint64_t>(vertices.FindIndex(exp.Current())));
+            hash.add(static_cast<uint64_t>(exp.Current().Orientation()));
+        }
+    }
+
+    // Faces: surface type, orientation, a grid of samples and bounding edges
+    for (int i = 1; i <= faces.Extent(); ++i) {
+        const TopoDS_Face& face = TopoDS::Face(faces(i));
+        hash.add(static_cast<uint64_t>(face.Orientation()));
+
+        BRepAdaptor_Surface surface(face, false);
+        hash.add(static_cast<uint64_t>(surface.GetType()));
+
+        double u_min, u_max, v_min, v_max;
+        BRepTools::UVBounds(face, u_min, u_max, v_min, v_max);
+        for (int i_u = 1; i_u <= FACE_SAMPLES; ++i_u) {
+            const double u = u_min + (u_max - u_min) * i_u / (FACE_SAMPLES + 1);
+            for (int i_v = 1; i_v <= FACE_SAMPLES; ++i_v) {
+                hash.add_point(surface.Value(u, v_min + (v_max - v_min) * i_v / (FACE_SAMPLES + 1)));
+            }
+        }
+
+        for (TopExp_Explorer exp(face, TopAbs_EDGE); exp.More(); exp.Next()) {
+            hash.add(static_cast<uint64_t>(edges.FindIndex(exp.Current())));
+            hash.add(static_cast<uint64_t>(exp.Current().Orientation()));
+        }
+    }
+
+    return hash.value();
+}
+
+} // namespace cadhy
@@ -0,0 +1,238 @@
+/**
+ * @file mesh_cache.cpp
+ * @brief Implementation of the per-shape triangulation cache
+ */
+
+#include <cadhy/core/mesh_cache.hpp>
+
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace cadhy {
+
+//------------------------------------------------------------------------------
+// Internal Helpers
+//------------------------------------------------------------------------------
+
+namespace {
+
+std::atomic<uint64_t> g_cache_hits{0};
+std::atomic<uint64_t> g_cache_misses{0};
+std::atomic<uint64_t> g_reused_faces{0};
+std::atomic<uint64_t> g_meshed_faces{0};
+
+/// Record the active triangulation of every face
+void snapshot_triangulations(
+    const TopoDS_Shape& shape,
+    std::vector<Handle(Poly_Triangulation)>& faces
+) {
+    faces.clear();
+    for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next()) {
+        TopLoc_Location loc;
+        faces.push_back(BRep_Tool::Triangulation(TopoDS::Face(exp.Current()), loc));
+    }
+}
+
+/// Re-activate recorded triangulations; false if the topology no longer matches
+bool restore_triangulations(
+    const TopoDS_Shape& shape,
+    const std::vector<Handle(Poly_Triangulation)>& faces
+) {
+    size_t count = 0;
+    for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next()) {
+        ++count;
+    }
+    if (count != faces.size()) return false;
+
+    BRep_Builder builder;
+    size_t i = 0;
+    for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next(), ++i) {
+        const TopoDS_Face& face = TopoDS::Face(exp.Current());
+        TopLoc_Location loc;
+        if (BRep_Tool::Triangulation(face, loc) != faces[i]) {
+            builder.UpdateFace(face, faces[i]);
+        }
+    }
+    return true;
+}
+
+/// Re-attach inherited triangulations to the faces still present in `shape`
+void attach_inherited(
+    const TopoDS_Shape& shape,
+    const std::vector<std::pair<TopoDS_Face, Handle(Poly_Triangulation)>>& faces
+) {
+    TopTools_IndexedMapOfShape face_map;
+    TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+
+    BRep_Builder builder;
+    for (const auto& [face, triangulation] : faces) {
+        int index = face_map.FindIndex(face);
+        if (index == 0) continue;
+
+        const TopoDS_Face& target = TopoDS::Face(face_map(index));
+        TopLoc_Location loc;
+        if (BRep_Tool::Triangulation(target, loc) != triangulation) {
+            builder.UpdateFace(target, triangulation);
+        }
+    }
+}
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+// TriangulationCache
+//------------------------------------------------------------------------------
+
+bool TriangulationCache::ensure(
+    const TopoDS_Shape& shape,
+    const MeshCacheKey& key,
+    bool parallel
+) {
+    if (shape.IsNull()) return false;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (!(it->key == key)) continue;
+
+        if (restore_triangulations(shape, it->faces)) {
+            Entry entry = std::move(*it);
+            entries_.erase(it);
+            entries_.push_back(std::move(entry));
+            g_cache_hits.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        // Stale entry (shape topology changed without invalidation)
+        entries_.erase(it);
+        break;
+    }
+
+    g_cache_misses.fetch_add(1, std::memory_order_relaxed);
+
+    // Faces an edit left untouched get their source triangulation back.
+    // BRepMesh keeps consistent triangulations (and their edge
+    // discretisation), so only new or modified faces are meshed.
+    auto inherited = std::find_if(inherited_.begin(), inherited_.end(),
+                                  [&](const InheritedEntry& e) { return e.key == key; });
+    if (inherited != inherited_.end()) {
+        attach_inherited(shape, inherited->faces);
+    }
+
+    BRepMesh_IncrementalMesh mesher(
+        shape,
+        key.linear_deflection,
+        key.relative,
+        key.angular_deflection,
+        parallel
+    );
+    if (!mesher.IsDone()) return false;
+
+    Entry entry;
+    entry.key = key;
+    snapshot_triangulations(shape, entry.faces);
+
+    size_t reused = 0;
+    if (inherited != inherited_.end()) {
+        std::unordered_set<const Poly_Triangulation*> kept;
+        for (const auto& face : inherited->faces) kept.insert(face.second.get());
+        for (const auto& triangulation : entry.faces) {
+            if (kept.count(triangulation.get())) ++reused;
+        }
+        inherited_.erase(inherited);
+    }
+    g_reused_faces.fetch_add(reused, std::memory_order_relaxed);
+    g_meshed_faces.fetch_add(entry.faces.size() - reused, std::memory_order_relaxed);
+
+    if (entries_.size() >= MAX_ENTRIES) {
+        entries_.erase(entries_.begin());
+    }
+    entries_.push_back(std::move(entry));
+    return true;
+}
+
+void TriangulationCache::inherit(
+    const TopoDS_Shape& source,
+    const TriangulationCache& source_cache,
+    const Handle(BRepTools_History)& history
+) {
+    if (source.IsNull() || &source_cache == this) return;
+
+    // Source faces the edit kept as they were
+    std::vector<TopoDS_Face> faces;
+    std::vector<bool> untouched;
+    for (TopExp_Explorer exp(source, TopAbs_FACE); exp.More(); exp.Next()) {
+        const TopoDS_Face& face = TopoDS::Face(exp.Current());
+        faces.push_back(face);
+        untouched.push_back(history.IsNull() ||
+                            (!history->IsRemoved(face) && history->Modified(face).IsEmpty()));
+    }
+
+    std::vector<InheritedEntry> adopted;
+    {
+        std::lock_guard<std::mutex> lock(source_cache.mutex_);
+        for (const Entry& entry : source_cache.entries_) {
+            if (entry.faces.size() != faces.size()) continue;
+
+            InheritedEntry inherited;
+            inherited.key = entry.key;
+            for (size_t i = 0; i < faces.size(); ++i) {
+                if (untouched[i] && !entry.faces[i].IsNull()) {
+                    inherited.faces.emplace_back(faces[i], entry.faces[i]);
+                }
+            }
+            if (!inherited.faces.empty()) adopted.push_back(std::move(inherited));
+        }
+    }
+
+    // Several sources (boolean arguments) may contribute to the same key
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (InheritedEntry& inherited : adopted) {
+        auto it = std::find_if(inherited_.begin(), inherited_.end(),
+                               [&](const InheritedEntry& e) { return e.key == inherited.key; });
+        if (it == inherited_.end()) {
+            inherited_.push_back(std::move(inherited));
+        } else {
+            it->faces.insert(it->faces.end(), inherited.faces.begin(), inherited.faces.end());
+        }
+    }
+}
+
+void TriangulationCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    inherited_.clear();
+}
+
+size_t TriangulationCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+MeshCacheStats TriangulationCache::stats() {
+    MeshCacheStats result;
+    result.hits = g_cache_hits.load(std::memory_order_relaxed);
+    result.misses = g_cache_misses.load(std::memory_order_relaxed);
+    result.reused_faces = g_reused_faces.load(std::memory_order_relaxed);
+    result.meshed_faces = g_meshed_faces.load(std::memory_order_relaxed);
+    return result;
+}
+
+void TriangulationCache::reset_stats() {
+    g_cache_hits.store(0, std::memory_order_relaxed);
+    g_cache_misses.store(0, std::memory_order_relaxed);
+    g_reused_faces.store(0, std::memory_order_relaxed);
+    g_meshed_faces.store(0, std::memory_order_relaxed);
+}
+
+} // namespace cadhy
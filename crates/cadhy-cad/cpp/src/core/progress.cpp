@@ -0,0 +1,108 @@
+/**
+ * @file progress.cpp
+ * @brief Implementation of the operation progress handle
+ */
+
+#include <cadhy/core/progress.hpp>
+
+#include <Message_ProgressIndicator.hxx>
+#include <Message_ProgressScope.hxx>
+
+#include <algorithm>
+#include <chrono>
+
+namespace cadhy {
+
+//------------------------------------------------------------------------------
+// Internal Helpers
+//------------------------------------------------------------------------------
+
+namespace {
+
+int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // anonymous namespace
+
+/// OCCT indicator forwarding position, stage and user breaks to its owner.
+/// Show() is called under the indicator's own lock; UserBreak() may be
+/// called from any worker thread of a parallel algorithm.
+class ProgressIndicator : public Message_ProgressIndicator {
+public:
+    explicit ProgressIndicator(const OperationProgress& owner) : owner_(owner) {}
+
+    Standard_Boolean UserBreak() override { return owner_.should_stop(); }
+
+    void Show(const Message_ProgressScope& scope, const Standard_Boolean) override {
+        const char* stage = nullptr;
+        for (const Message_ProgressScope* s = &scope; s && !stage; s = s->Parent()) {
+            stage = s->Name();
+        }
+        owner_.report(GetPosition(), stage);
+    }
+
+    DEFINE_STANDARD_RTTI_INLINE(ProgressIndicator, Message_ProgressIndicator)
+
+private:
+    const OperationProgress& owner_;
+};
+
+//------------------------------------------------------------------------------
+// Operation Progress
+//------------------------------------------------------------------------------
+
+OperationProgress::OperationProgress()
+    : indicator_(new ProgressIndicator(*this)) {}
+
+OperationProgress::~OperationProgress() = default;
+
+Message_ProgressRange OperationProgress::start(const char* stage) const {
+    {
+        std::lock_guard<std::mutex> lock(stage_mutex_);
+        stage_ = stage ? stage : "";
+    }
+    fraction_.store(0.0, std::memory_order_relaxed);
+    return indicator_->Start();
+}
+
+void OperationProgress::cancel() const {
+    cancelled_.store(true, std::memory_order_relaxed);
+    stopped_.store(true, std::memory_order_relaxed);
+}
+
+void OperationProgress::set_timeout(double seconds) const {
+    if (seconds <= 0.0) {
+        deadline_ns_.store(0, std::memory_order_relaxed);
+        return;
+    }
+    deadline_ns_.store(now_ns() + static_cast<int64_t>(seconds * 1e9), std::memory_order_relaxed);
+}
+
+bool OperationProgress::should_stop() const {
+    if (stopped_.load(std::memory_order_relaxed)) return true;
+
+    const int64_t deadline = deadline_ns_.load(std::memory_order_relaxed);
+    if (deadline != 0 && now_ns() >= deadline) {
+        timed_out_.store(true, std::memory_order_relaxed);
+        stopped_.store(true, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+std::string OperationProgress::stage() const {
+    std::lock_guard<std::mutex> lock(stage_mutex_);
+    return stage_;
+}
+
+void OperationProgress::report(double fraction, const char* stage) const {
+    fraction_.store(std::clamp(fraction, 0.0, 1.0), std::memory_order_relaxed);
+    if (stage) {
+        std::lock_guard<std::mutex> lock(stage_mutex_);
+        stage_ = stage;
+    }
+}
+
+} // namespace cadhy
@@ -27,6 +27,7 @@
 #include <BRepBuilderAPI_Sewing.hxx>
 #include <BRepCheck_Analyzer.hxx>
 #include <BRepTools.hxx>
+#include <BRepTools_History.hxx>
 #include <BRepGProp.hxx>
 #include <GProp_GProps.hxx>
 #include <ShapeUpgrade_UnifySameDomain.hxx>
@@ -126,20 +127,53 @@ std::unique_ptr<OcctShape> validate_and_fix(const TopoDS_Shape& shape) {
 
 /**
  * @brief Unify same domain faces/edges for cleaner result
+ *
+ * The unifier's history is merged into `history` when one is given.
  */
-TopoDS_Shape unify_shape(const TopoDS_Shape& shape) {
+TopoDS_Shape unify_shape(
+    const TopoDS_Shape& shape,
+    const Handle(BRepTools_History)& history = Handle(BRepTools_History)()
+) {
     try {
         ShapeUpgrade_UnifySameDomain unifier(shape);
         unifier.Build();
         if (unifier.Shape().IsNull()) {
             return shape;
         }
+        if (!history.IsNull()) {
+            history->Merge(unifier.History());
+        }
         return unifier.Shape();
     } catch (...) {
         return shape;
     }
 }
 
+/**
+ * @brief Start an edit history from a boolean operation
+ */
+Handle(BRepTools_History) boolean_history(BRepAlgoAPI_BooleanOperation& op) {
+    Handle(BRepTools_History) history = new BRepTools_History;
+    if (!op.History().IsNull()) {
+        history->Merge(op.History());
+    }
+    return history;
+}
+
+/**
+ * @brief Let faces the edit left untouched keep the source's triangulations
+ */
+std::unique_ptr<OcctShape> inherit_triangulations(
+    std::unique_ptr<OcctShape> result,
+    const OcctShape& source,
+    const Handle(BRepTools_History)& history
+) {
+    if (result) {
+        result->mesh_cache().inherit(source.get(), source.mesh_cache(), history);
+    }
+    return result;
+}
+
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -185,6 +219,7 @@ std::unique_ptr<OcctShape> push_pull_face(
 
         // Boolean merge with original
         TopoDS_Shape result;
+        Handle(BRepTools_History) history;
         if (distance > 0) {
             // Positive distance = fuse (add material)
             BRepAlgoAPI_Fuse fuse(solid.get(), prism_shape);
@@ -194,6 +229,7 @@ std::unique_ptr<OcctShape> push_pull_face(
                 return nullptr;
             }
             result = fuse.Shape();
+            history = boolean_history(fuse);
         } else {
             // Negative distance = cut (remove material)
             BRepAlgoAPI_Cut cut(solid.get(), prism_shape);
@@ -203,11 +239,12 @@ std::unique_ptr<OcctShape> push_pull_face(
                 return nullptr;
             }
             result = cut.Shape();
+            history = boolean_history(cut);
         }
 
         // Unify and validate
-        result = unify_shape(result);
-        return validate_and_fix(result);
+        result = unify_shape(result, history);
+        return inherit_triangulations(validate_and_fix(result), solid, history);
 
     } catch (const Standard_Failure& e) {
         std::cerr << "push_pull_face exception: " << e.GetMessageString() << std::endl;
@@ -290,20 +327,23 @@ std::unique_ptr<OcctShape> extrude_face(
         double dot = normal.Dot(direction);
 
         TopoDS_Shape result;
+        Handle(BRepTools_History) history;
         if (dot > 0) {
             BRepAlgoAPI_Fuse fuse(solid.get(), prism_shape);
             fuse.Build();
             if (!fuse.IsDone()) return nullptr;
             result = fuse.Shape();
+            history = boolean_history(fuse);
         } else {
             BRepAlgoAPI_Cut cut(solid.get(), prism_shape);
             cut.Build();
             if (!cut.IsDone()) return nullptr;
             result = cut.Shape();
+            history = boolean_history(cut);
         }
 
-        result = unify_shape(result);
-        return validate_and_fix(result);
+        result = unify_shape(result, history);
+        return inherit_triangulations(validate_and_fix(result), solid, history);
 
     } catch (const Standard_Failure& e) {
         std::cerr << "extrude_face exception: " << e.GetMessageString() << std::endl;
@@ -444,8 +484,9 @@ std::unique_ptr<OcctShape> inset_face(
                 BRepAlgoAPI_Cut cut(solid.get(), inner_prism.Shape());
                 cut.Build();
                 if (cut.IsDone()) {
-                    TopoDS_Shape result = unify_shape(cut.Shape());
-                    return validate_and_fix(result);
+                    Handle(BRepTools_History) history = boolean_history(cut);
+                    TopoDS_Shape result = unify_shape(cut.Shape(), history);
+                    return inherit_triangulations(validate_and_fix(result), solid, history);
                 }
             }
         }
@@ -0,0 +1,444 @@
+/**
+ * @file adaptive.cpp
+ * @brief Implementation of curvature-driven per-face tessellation
+ */
+
+#include <cadhy/mesh/adaptive.hpp>
+
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepAdaptor_Surface.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepMesh_Context.hxx>
+#include <BRepMesh_Deflection.hxx>
+#include <BRepMesh_EdgeDiscret.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepTools.hxx>
+#include <Bnd_Box.hxx>
+#include <GCPnts_AbscissaPoint.hxx>
+#include <GeomLProp_SLProps.hxx>
+#include <Geom_Surface.hxx>
+#include <IMeshData_Edge.hxx>
+#include <IMeshData_Face.hxx>
+#include <IMeshData_Model.hxx>
+#include <IMeshData_PCurve.hxx>
+#include <IMeshTools_CurveTessellator.hxx>
+#include <IMeshTools_ModelAlgo.hxx>
+#include <IMeshTools_Parameters.hxx>
+#include <OSD_Parallel.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Precision.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_Failure.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace cadhy::mesh {
+
+//------------------------------------------------------------------------------
+// Helper Functions
+//------------------------------------------------------------------------------
+
+namespace {
+
+/// Deflection as a fraction of the radius of curvature (~16 deg segments)
+constexpr double RADIUS_FRACTION = 0.01;
+
+/// Samples per parametric direction for curvature bounds of free-form faces
+constexpr int CURVATURE_SAMPLES = 7;
+
+/// Bisection passes when enforcing the maximum edge length
+constexpr int MAX_REFINE_PASSES = 16;
+
+/// Largest principal curvature magnitude over the face (0 for planes)
+double max_curvature(const TopoDS_Face& face) {
+    BRepAdaptor_Surface adaptor(face, Standard_False);
+    switch (adaptor.GetType()) {
+        case GeomAbs_Plane:    return 0.0;
+        case GeomAbs_Cylinder: return 1.0 / adaptor.Cylinder().Radius();
+        case GeomAbs_Sphere:   return 1.0 / adaptor.Sphere().Radius();
+        case GeomAbs_Torus:    return 1.0 / adaptor.Torus().MinorRadius();
+        default:               break;
+    }
+
+    TopLoc_Location loc;
+    Handle(Geom_Surface) surface = BRep_Tool::Surface(face, loc);
+    if (surface.IsNull()) return 0.0;
+
+    double u_min, u_max, v_min, v_max;
+    BRepTools::UVBounds(face, u_min, u_max, v_min, v_max);
+
+    // Sample principal curvatures on a grid over the face's UV bounds
+    GeomLProp_SLProps props(surface, 2, Precision::Confusion());
+    double curvature = 0.0;
+    for (int i = 0; i < CURVATURE_SAMPLES; ++i) {
+        double u = u_min + (u_max - u_min) * i / (CURVATURE_SAMPLES - 1);
+        for (int j = 0; j < CURVATURE_SAMPLES; ++j) {
+            double v = v_min + (v_max - v_min) * j / (CURVATURE_SAMPLES - 1);
+            props.SetParameters(u, v);
+            if (!props.IsCurvatureDefined()) continue;
+            curvature = std::max({curvature, std::abs(props.MaxCurvature()), std::abs(props.MinCurvature())});
+        }
+    }
+    return curvature;
+}
+
+/// Per-face deflection, looked up by TopoDS face
+class FaceDeflections {
+public:
+    FaceDeflections(const TopoDS_Shape& shape, const AdaptiveMeshOptions& options) {
+        TopExp::MapShapes(shape, TopAbs_FACE, faces_);
+        values_.resize(faces_.Extent(), options.min_deflection);
+
+        OSD_Parallel::For(0, faces_.Extent(), [&](int i) {
+            values_[i] = adaptive_face_deflection(TopoDS::Face(faces_(i + 1)), options);
+        }, !options.parallel);
+
+        finest_ = values_.empty() ? options.min_deflection : *std::min_element(values_.begin(), values_.end());
+    }
+
+    double get(const TopoDS_Face& face) const {
+        int index = faces_.FindIndex(face);
+        return index > 0 ? values_[index - 1] : finest_;
+    }
+
+    double finest() const { return finest_; }
+    const TopTools_IndexedMapOfShape& faces() const { return faces_; }
+
+private:
+    TopTools_IndexedMapOfShape faces_;
+    std::vector<double> values_;
+    double finest_ = 0.0;
+};
+
+/// Edge discretisation with the finest deflection of the faces sharing each
+/// edge (so both sides conform) and at least enough points for the maximum
+/// edge length
+class AdaptiveEdgeDiscret : public IMeshTools_ModelAlgo {
+public:
+    AdaptiveEdgeDiscret(const FaceDeflections& deflections, double max_edge_length)
+        : deflections_(deflections), max_edge_length_(max_edge_length) {}
+
+    DEFINE_STANDARD_RTTI_INLINE(AdaptiveEdgeDiscret, IMeshTools_ModelAlgo)
+
+protected:
+    Standard_Boolean performInternal(
+        const Handle(IMeshData_Model)& model,
+        const IMeshTools_Parameters& parameters,
+        const Message_ProgressRange& /*range*/
+    ) override {
+        OSD_Parallel::For(0, model->EdgesNb(), [&](int i) {
+            process(model->GetEdge(i), model->GetMaxSize(), parameters);
+        }, !parameters.InParallel);
+        return Standard_True;
+    }
+
+private:
+    void process(
+        const IMeshData::IEdgeHandle& edge,
+        double max_size,
+        const IMeshTools_Parameters& parameters
+    ) const {
+        try {
+            OCC_CATCH_SIGNALS
+
+            IMeshTools_Parameters edge_parameters = parameters;
+            for (int i = 0; i < edge->PCurvesNb(); ++i) {
+                const TopoDS_Face& face = edge->GetPCurve(i)->GetFace()->GetFace();
+                double deflection = deflections_.get(face);
+                if (i == 0 || deflection < edge_parameters.Deflection) {
+                    edge_parameters.Deflection = deflection;
+                }
+            }
+            BRepMesh_Deflection::ComputeDeflection(edge, max_size, edge_parameters);
+
+            int min_points = 2;
+            if (max_edge_length_ > 0.0 && !BRep_Tool::Degenerated(edge->GetEdge())) {
+                BRepAdaptor_Curve curve(edge->GetEdge());
+                double length = GCPnts_AbscissaPoint::Length(curve);
+                min_points = std::max(2, static_cast<int>(std::ceil(length / max_edge_length_)) + 1);
+            }
+
+            Handle(IMeshTools_CurveTessellator) tessellator =
+                BRepMesh_EdgeDiscret::CreateEdgeTessellator(edge, edge_parameters, min_points);
+            BRepMesh_EdgeDiscret::Tessellate3d(edge, tessellator, Standard_True);
+            if (!edge->IsFree()) {
+                BRepMesh_EdgeDiscret::Tessellate2d(edge, Standard_True);
+            }
+        } catch (const Standard_Failure&) {
+            edge->SetStatus(IMeshData_Failure);
+        }
+    }
+
+    const FaceDeflections& deflections_;
+    double max_edge_length_;
+};
+
+/// Face discretisation with each face's own interior deflection
+class AdaptiveFaceDiscret : public IMeshTools_ModelAlgo {
+public:
+    AdaptiveFaceDiscret(const Handle(IMeshTools_ModelAlgo)& base, const FaceDeflections& deflections)
+        : base_(base), deflections_(deflections) {}
+
+    DEFINE_STANDARD_RTTI_INLINE(AdaptiveFaceDiscret, IMeshTools_ModelAlgo)
+
+protected:
+    Standard_Boolean performInternal(
+        const Handle(IMeshData_Model)& model,
+        const IMeshTools_Parameters& parameters,
+        const Message_ProgressRange& range
+    ) override {
+        for (int i = 0; i < model->FacesNb(); ++i) {
+            const IMeshData::IFaceHandle& face = model->GetFace(i);
+            // Never finer than the boundary BRepMesh derived from the edges
+            face->SetDeflection(std::max(deflections_.get(face->GetFace()), face->GetDeflection()));
+        }
+        return base_->Perform(model, parameters, range);
+    }
+
+private:
+    Handle(IMeshTools_ModelAlgo) base_;
+    const FaceDeflections& deflections_;
+};
+
+/// Split one triangle along edge (a, b) at node m, keeping its orientation
+void split_triangle(std::vector<std::array<int, 3>>& triangles, size_t t, int a, int b, int m) {
+    std::array<int, 3> tri = triangles[t];
+    for (int k = 0; k < 3; ++k) {
+        int x = tri[k], y = tri[(k + 1) % 3], z = tri[(k + 2) % 3];
+        if ((x == a && y == b) || (x == b && y == a)) {
+            triangles[t] = {x, m, z};
+            triangles.push_back({m, y, z});
+            return;
+        }
+    }
+}
+
+/// Split interior edges longer than `max_length`, longest first. Boundary
+/// edges follow the (already capped) edge discretisation and are kept, so
+/// neighbouring faces stay conforming. Returns `triangulation` if nothing
+/// needed splitting.
+Handle(Poly_Triangulation) refine_triangulation(
+    const TopoDS_Face& face,
+    const Handle(Poly_Triangulation)& triangulation,
+    double max_length
+) {
+    if (triangulation.IsNull() || !triangulation->HasUVNodes()) return triangulation;
+
+    TopLoc_Location loc;
+    Handle(Geom_Surface) surface = BRep_Tool::Surface(face, loc);
+    if (surface.IsNull()) return triangulation;
+
+    std::vector<gp_Pnt> nodes;
+    std::vector<gp_Pnt2d> uvs;
+    for (int i = 1; i <= triangulation->NbNodes(); ++i) {
+        nodes.push_back(triangulation->Node(i));
+        uvs.push_back(triangulation->UVNode(i));
+    }
+    std::vector<std::array<int, 3>> triangles;
+    for (int i = 1; i <= triangulation->NbTriangles(); ++i) {
+        int n1, n2, n3;
+        triangulation->Triangle(i).Get(n1, n2, n3);
+        triangles.push_back({n1 - 1, n2 - 1, n3 - 1});
+    }
+    const size_t original_nodes = nodes.size();
+    const double max_sq = max_length * max_length;
+
+    struct Candidate {
+        double length_sq;
+        int a, b;
+        int t0, t1;
+    };
+
+    for (int pass = 0; pass < MAX_REFINE_PASSES; ++pass) {
+        // Edge -> adjacent triangles (-2 marks non-manifold edges)
+        std::unordered_map<uint64_t, std::array<int, 2>> edges;
+        edges.reserve(triangles.size() * 2);
+        for (size_t t = 0; t < triangles.size(); ++t) {
+            for (int k = 0; k < 3; ++k) {
+                int a = triangles[t][k], b = triangles[t][(k + 1) % 3];
+                uint64_t key = (static_cast<uint64_t>(std::min(a, b)) << 32) | static_cast<uint32_t>(std::max(a, b));
+                auto& slot = edges.try_emplace(key, std::array<int, 2>{-1, -1}).first->second;
+                if (slot[0] < 0) slot[0] = static_cast<int>(t);
+                else if (slot[1] == -1) slot[1] = static_cast<int>(t);
+                else slot[1] = -2;
+            }
+        }
+
+        std::vector<Candidate> candidates;
+        for (const auto& [key, slot] : edges) {
+            if (slot[0] < 0 || slot[1] < 0) continue;
+            int a = static_cast<int>(key >> 32), b = static_cast<int>(key & 0xffffffffu);
+            double length_sq = nodes[a].SquareDistance(nodes[b]);
+            if (length_sq > max_sq) candidates.push_back({length_sq, a, b, slot[0], slot[1]});
+        }
+        if (candidates.empty()) break;
+
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const Candidate& x, const Candidate& y) { return x.length_sq > y.length_sq; });
+
+        // Each triangle is split at most once per pass
+        std::vector<char> split(triangles.size(), 0);
+        for (const Candidate& c : candidates) {
+            if (split[c.t0] || split[c.t1]) continue;
+
+            gp_Pnt2d uv((uvs[c.a].XY() + uvs[c.b].XY()) * 0.5);
+            int m = static_cast<int>(nodes.size());
+            nodes.push_back(surface->Value(uv.X(), uv.Y()));
+            uvs.push_back(uv);
+
+            split_triangle(triangles, c.t0, c.a, c.b, m);
+            split_triangle(triangles, c.t1, c.a, c.b, m);
+            split[c.t0] = split[c.t1] = 1;
+            split.resize(triangles.size(), 1);
+        }
+    }
+
+    if (nodes.size() == original_nodes) return triangulation;
+
+    const bool has_normals = triangulation->HasNormals();
+    Handle(Poly_Triangulation) refined = new Poly_Triangulation(
+        static_cast<int>(nodes.size()), static_cast<int>(triangles.size()), Standard_True, has_normals);
+
+    GeomLProp_SLProps props(surface, 1, Precision::Confusion());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        int index = static_cast<int>(i) + 1;
+        refined->SetNode(index, nodes[i]);
+        refined->SetUVNode(index, uvs[i]);
+        if (!has_normals) continue;
+
+        if (i < original_nodes) {
+            refined->SetNormal(index, triangulation->Normal(index));
+        } else {
+            props.SetParameters(uvs[i].X(), uvs[i].Y());
+            refined->SetNormal(index, props.IsNormalDefined() ? props.Normal() : gp_Dir(0, 0, 1));
+        }
+    }
+    for (size_t t = 0; t < triangles.size(); ++t) {
+        refined->SetTriangle(static_cast<int>(t) + 1,
+                             Poly_Triangle(triangles[t][0] + 1, triangles[t][1] + 1, triangles[t][2] + 1));
+    }
+    refined->Deflection(triangulation->Deflection());
+    return refined;
+}
+
+/// Install a refined triangulation, carrying over the edge polygons (the
+/// original nodes keep their indices)
+void replace_triangulation(
+    const TopoDS_Face& face,
+    const Handle(Poly_Triangulation)& previous,
+    const Handle(Poly_Triangulation)& refined
+) {
+    BRep_Builder builder;
+    // Edge polygons are stored relative to the face's location
+    const TopLoc_Location loc = face.Location();
+
+    for (TopExp_Explorer exp(face, TopAbs_EDGE); exp.More(); exp.Next()) {
+        const TopoDS_Edge& edge = TopoDS::Edge(exp.Current());
+
+        if (BRep_Tool::IsClosed(edge, face)) {
+            // Seam: one polygon per orientation
+            TopoDS_Edge forward = TopoDS::Edge(edge.Oriented(TopAbs_FORWARD));
+            TopoDS_Edge reversed = TopoDS::Edge(edge.Oriented(TopAbs_REVERSED));
+            Handle(Poly_PolygonOnTriangulation) first = BRep_Tool::PolygonOnTriangulation(forward, previous, loc);
+            Handle(Poly_PolygonOnTriangulation) second = BRep_Tool::PolygonOnTriangulation(reversed, previous, loc);
+            if (!first.IsNull() && !second.IsNull()) {
+                builder.UpdateEdge(edge, first, second, refined, loc);
+            }
+        } else {
+            Handle(Poly_PolygonOnTriangulation) polygon = BRep_Tool::PolygonOnTriangulation(edge, previous, loc);
+            if (!polygon.IsNull()) {
+                builder.UpdateEdge(edge, polygon, refined, loc);
+            }
+        }
+    }
+
+    builder.UpdateFace(face, refined);
+}
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+// Adaptive Tessellation
+//------------------------------------------------------------------------------
+
+double adaptive_face_deflection(
+    const TopoDS_Face& face,
+    const AdaptiveMeshOptions& options
+) {
+    Bnd_Box box;
+    BRepBndLib::Add(face, box, Standard_False);
+    double size = box.IsVoid() ? 0.0 : std::sqrt(box.SquareExtent());
+
+    double curvature = max_curvature(face);
+    double radius = curvature > 0.0 ? 1.0 / curvature : std::numeric_limits<double>::infinity();
+
+    double deflection = RADIUS_FRACTION * options.curvature_factor * std::min(radius, size);
+    return std::clamp(deflection, options.min_deflection, std::max(options.min_deflection, options.max_deflection));
+}
+
+bool mesh_adaptive(
+    const TopoDS_Shape& shape,
+    const AdaptiveMeshOptions& options
+) {
+    if (shape.IsNull()) return false;
+
+    FaceDeflections deflections(shape, options);
+
+    BRepMesh_IncrementalMesh mesher;
+    mesher.SetShape(shape);
+    IMeshTools_Parameters& parameters = mesher.ChangeParameters();
+    parameters.Deflection = deflections.finest();
+    parameters.DeflectionInterior = deflections.finest();
+    parameters.Angle = options.angular_deflection;
+    parameters.AngleInterior = options.angular_deflection;
+    parameters.Relative = Standard_False;
+    parameters.InParallel = options.parallel;
+    parameters.ControlSurfaceDeflection = Standard_True;
+    if (options.min_edge_length > 0.0) {
+        parameters.MinSize = options.min_edge_length;
+    }
+
+    // Stock pipeline with per-face edge and interior deflection
+    Handle(BRepMesh_Context) context = new BRepMesh_Context;
+    context->SetEdgeDiscret(new AdaptiveEdgeDiscret(deflections, options.max_edge_length));
+    context->SetFaceDiscret(new AdaptiveFaceDiscret(context->GetFaceDiscret(), deflections));
+    mesher.Perform(context);
+    if (!mesher.IsDone()) return false;
+
+    if (options.max_edge_length > 0.0) {
+        const TopTools_IndexedMapOfShape& faces = deflections.faces();
+        std::vector<Handle(Poly_Triangulation)> previous(faces.Extent());
+        std::vector<Handle(Poly_Triangulation)> refined(faces.Extent());
+
+        OSD_Parallel::For(0, faces.Extent(), [&](int i) {
+            const TopoDS_Face& face = TopoDS::Face(faces(i + 1));
+            TopLoc_Location loc;
+            previous[i] = BRep_Tool::Triangulation(face, loc);
+            refined[i] = refine_triangulation(face, previous[i], options.max_edge_length);
+        }, !options.parallel);
+
+        // Edges are shared between faces, so attach serially
+        for (int i = 0; i < faces.Extent(); ++i) {
+            if (refined[i] != previous[i]) {
+                replace_triangulation(TopoDS::Face(faces(i + 1)), previous[i], refined[i]);
+            }
+        }
+    }
+
+    return true;
+}
+
+} // namespace cadhy::mesh
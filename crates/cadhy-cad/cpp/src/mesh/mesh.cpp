@@ -6,9 +6,11 @@
  */
 
 #include <cadhy/mesh/mesh.hpp>
+#include <cadhy/mesh/vertex_weld.hpp>
 
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
 #include <BRep_Tool.hxx>
 #include <Poly_Triangulation.hxx>
 #include <Poly_Connect.hxx>
@@ -32,6 +34,7 @@
 #include <Geom_Surface.hxx>
 #include <GeomLProp_SLProps.hxx>
 #include <Standard_Mutex.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
 
 #include <algorithm>
 #include <unordered_map>
@@ -73,35 +76,19 @@ void ensure_triangulation(const OcctShape& shape, double deflection) {
     }
 }
 
-} // anonymous namespace
-
-//------------------------------------------------------------------------------
-// Basic Tessellation
-//------------------------------------------------------------------------------
-
-MeshData tessellate(const OcctShape& shape) {
-    return tessellate_deflection(shape, 0.1);
-}
-
-MeshData tessellate_deflection(
-    const OcctShape& shape,
-    double deflection
-) {
+/// Collect the triangulations stored on the faces of `shape`
+MeshData extract_triangulations(const TopoDS_Shape& shape) {
     MeshData result;
 
-    // Perform tessellation
-    BRepMesh_IncrementalMesh mesher(shape.get(), deflection, false, 0.5, true);
-    mesher.Perform();
-
     // Build face map for face IDs
     TopTools_IndexedMapOfShape face_map;
-    TopExp::MapShapes(shape.get(), TopAbs_FACE, face_map);
+    TopExp::MapShapes(shape, TopAbs_FACE, face_map);
 
     // Vertex index offset per face
     uint32_t vertex_offset = 0;
 
     // Process each face
-    for (TopExp_Explorer exp(shape.get(), TopAbs_FACE); exp.More(); exp.Next()) {
+    for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next()) {
         TopoDS_Face face = TopoDS::Face(exp.Current());
         int face_id = face_map.FindIndex(face);
 
@@ -172,6 +159,31 @@ MeshData tessellate_deflection(
     return result;
 }
 
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+// Basic Tessellation
+//------------------------------------------------------------------------------
+
+MeshData tessellate(const OcctShape& shape) {
+    return tessellate_deflection(shape, 0.1);
+}
+
+MeshData tessellate_deflection(
+    const OcctShape& shape,
+    double deflection
+) {
+    // Perform tessellation (skipped when the shape already carries a
+    // triangulation for these parameters)
+    MeshCacheKey key;
+    key.linear_deflection = deflection;
+    key.angular_deflection = 0.5;
+    key.relative = false;
+    shape.mesh_cache().ensure(shape.get(), key, true);
+
+    return extract_triangulations(shape.get());
+}
+
 MeshData tessellate_quality(
     const OcctShape& shape,
     const MeshQuality& quality
@@ -271,35 +283,297 @@ FaceMesh tessellate_face(
     return result;
 }
 
+//------------------------------------------------------------------------------
+// Welded Tessellation
+//------------------------------------------------------------------------------
+
+namespace {
+
+/// Union-find root with path halving
+uint32_t weld_find(std::vector<uint32_t>& parent, uint32_t i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+void weld_union(std::vector<uint32_t>& parent, uint32_t a, uint32_t b) {
+    a = weld_find(parent, a);
+    b = weld_find(parent, b);
+    if (a == b) return;
+    // Keep the smaller index as root so output order is deterministic
+    if (a < b) parent[b] = a; else parent[a] = b;
+}
+
+/// Topological key for a boundary node: a TopoDS vertex or an edge interior node
+uint64_t vertex_key(int vertex_index) {
+    return static_cast<uint64_t>(vertex_index);
+}
+
+uint64_t edge_node_key(int edge_index, int node) {
+    return (uint64_t(1) << 63) | (static_cast<uint64_t>(edge_index) << 32) | static_cast<uint64_t>(node);
+}
+
+} // anonymous namespace
+
+WeldedMesh weld_triangulation(const TopoDS_Shape& shape, double crease_angle) {
+    WeldedMesh result;
+
+    TopTools_IndexedMapOfShape edge_map;
+    TopTools_IndexedMapOfShape vertex_map;
+    TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+    TopExp::MapShapes(shape, TopAbs_VERTEX, vertex_map);
+
+    struct FaceEntry {
+        TopoDS_Face face;
+        Handle(Poly_Triangulation) tri;
+        TopLoc_Location loc;
+        int32_t face_index;
+        uint32_t node_offset;
+    };
+
+    // One "corner" per face node; corners are later grouped by topology
+    std::vector<FaceEntry> faces;
+    std::vector<gp_Pnt> corner_points;
+    std::vector<gp_Vec> corner_normals;
+
+    int32_t face_index = 0;
+    for (TopExp_Explorer exp(shape, TopAbs_FACE); exp.More(); exp.Next(), ++face_index) {
+        TopoDS_Face face = TopoDS::Face(exp.Current());
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) tri = BRep_Tool::Triangulation(face, loc);
+        if (tri.IsNull()) continue;
+
+        bool reversed = (face.Orientation() == TopAbs_REVERSED);
+        gp_Trsf trsf = loc.Transformation();
+        uint32_t offset = static_cast<uint32_t>(corner_points.size());
+        int num_nodes = tri->NbNodes();
+
+        for (int i = 1; i <= num_nodes; ++i) {
+            corner_points.push_back(tri->Node(i).Transformed(trsf));
+        }
+
+        // Oriented corner normals: surface normals when the triangulation has
+        // them, otherwise area-weighted triangle normals within the face
+        if (tri->HasNormals()) {
+            for (int i = 1; i <= num_nodes; ++i) {
+                gp_Vec n = gp_Vec(tri->Normal(i)).Transformed(trsf);
+                if (reversed) n.Reverse();
+                corner_normals.push_back(n);
+            }
+        } else {
+            corner_normals.resize(corner_points.size(), gp_Vec(0, 0, 0));
+            for (int i = 1; i <= tri->NbTriangles(); ++i) {
+                int n1, n2, n3;
+                tri->Triangle(i).Get(n1, n2, n3);
+                if (reversed) std::swap(n2, n3);
+                const gp_Pnt& p1 = corner_points[offset + n1 - 1];
+                const gp_Pnt& p2 = corner_points[offset + n2 - 1];
+                const gp_Pnt& p3 = corner_points[offset + n3 - 1];
+                gp_Vec n = gp_Vec(p1, p2).Crossed(gp_Vec(p1, p3));
+                corner_normals[offset + n1 - 1] += n;
+                corner_normals[offset + n2 - 1] += n;
+                corner_normals[offset + n3 - 1] += n;
+            }
+        }
+
+        faces.push_back({face, tri, loc, face_index, offset});
+    }
+
+    // Group corners that are the same topological point
+    std::vector<uint32_t> parent(corner_points.size());
+    for (uint32_t i = 0; i < parent.size(); ++i) parent[i] = i;
+    std::unordered_map<uint64_t, uint32_t> key_owner;
+
+    auto bind = [&](uint64_t key, uint32_t corner) {
+        auto inserted = key_owner.emplace(key, corner);
+        if (!inserted.second) weld_union(parent, inserted.first->second, corner);
+    };
+
+    for (const FaceEntry& entry : faces) {
+        for (TopExp_Explorer exp(entry.face, TopAbs_EDGE); exp.More(); exp.Next()) {
+            TopoDS_Edge edge = TopoDS::Edge(exp.Current());
+            Handle(Poly_PolygonOnTriangulation) poly =
+                BRep_Tool::PolygonOnTriangulation(edge, entry.tri, entry.loc);
+            if (poly.IsNull()) continue;
+
+            int edge_index = edge_map.FindIndex(edge);
+            TopoDS_Vertex first, last;
+            TopExp::Vertices(edge, first, last);
+            int first_index = first.IsNull() ? 0 : vertex_map.FindIndex(first);
+            int last_index = last.IsNull() ? 0 : vertex_map.FindIndex(last);
+            bool degenerated = BRep_Tool::Degenerated(edge);
+
+            int num_poly = poly->NbNodes();
+            for (int k = 1; k <= num_poly; ++k) {
+                uint32_t corner = entry.node_offset + poly->Node(k) - 1;
+                if (degenerated && first_index > 0) {
+                    bind(vertex_key(first_index), corner);
+                } else if (k == 1 && first_index > 0) {
+                    bind(vertex_key(first_index), corner);
+                } else if (k == num_poly && last_index > 0) {
+                    bind(vertex_key(last_index), corner);
+                } else {
+                    bind(edge_node_key(edge_index, k), corner);
+                }
+            }
+        }
+    }
+
+    // Split each group into crease clusters and emit one vertex per cluster
+    const double cos_crease = std::cos(crease_angle);
+    std::vector<uint32_t> corner_vertex(corner_points.size());
+    std::vector<int64_t> group_head(corner_points.size(), -1);  // First vertex of group
+    std::vector<int64_t> next_in_group;                         // Chain of vertices
+    std::vector<gp_Vec> representative;                         // First corner normal
+    std::vector<gp_Vec> normal_sum;
+
+    for (uint32_t c = 0; c < corner_points.size(); ++c) {
+        uint32_t root = weld_find(parent, c);
+        gp_Vec n = corner_normals[c];
+        double mag = n.Magnitude();
+        if (mag > 1e-12) n /= mag;
+
+        int64_t match = -1;
+        for (int64_t v = group_head[root]; v >= 0; v = next_in_group[v]) {
+            const gp_Vec& rep = representative[v];
+            if (mag <= 1e-12 || rep.Magnitude() <= 1e-12 || rep.Dot(n) >= cos_crease) {
+                match = v;
+                break;
+            }
+        }
+
+        if (match < 0) {
+            match = static_cast<int64_t>(result.positions.size());
+            result.positions.push_back(from_gp_pnt(corner_points[c]));
+            representative.push_back(n);
+            normal_sum.push_back(gp_Vec(0, 0, 0));
+            next_in_group.push_back(-1);
+            if (group_head[root] < 0) {
+                group_head[root] = match;
+            } else {
+                int64_t tail = group_head[root];
+                while (next_in_group[tail] >= 0) tail = next_in_group[tail];
+                next_in_group[tail] = match;
+            }
+        }
+
+        normal_sum[match] += n;
+        corner_vertex[c] = static_cast<uint32_t>(match);
+    }
+
+    result.normals.reserve(normal_sum.size());
+    for (size_t v = 0; v < normal_sum.size(); ++v) {
+        gp_Vec n = normal_sum[v];
+        double mag = n.Magnitude();
+        if (mag > 1e-12) {
+            n /= mag;
+            result.normals.push_back(Vector3D{n.X(), n.Y(), n.Z()});
+        } else {
+            result.normals.push_back(Vector3D{0.0, 0.0, 1.0});
+        }
+    }
+
+    // Triangles (dropping those collapsed by welding, e.g. at sphere poles)
+    for (const FaceEntry& entry : faces) {
+        bool reversed = (entry.face.Orientation() == TopAbs_REVERSED);
+        for (int i = 1; i <= entry.tri->NbTriangles(); ++i) {
+            int n1, n2, n3;
+            entry.tri->Triangle(i).Get(n1, n2, n3);
+            if (reversed) std::swap(n2, n3);
+
+            Triangle t;
+            t.v0 = corner_vertex[entry.node_offset + n1 - 1];
+            t.v1 = corner_vertex[entry.node_offset + n2 - 1];
+            t.v2 = corner_vertex[entry.node_offset + n3 - 1];
+            if (t.v0 == t.v1 || t.v1 == t.v2 || t.v0 == t.v2) continue;
+
+            result.triangles.push_back(t);
+            result.face_ids.push_back(entry.face_index);
+        }
+    }
+
+    return result;
+}
+
+MeshData tessellate_welded(
+    const OcctShape& shape,
+    double deflection,
+    double crease_angle
+) {
+    MeshData result;
+
+    MeshCacheKey key;
+    key.linear_deflection = deflection;
+    key.angular_deflection = 0.5;
+    key.relative = false;
+    if (!shape.mesh_cache().ensure(shape.get(), key, true)) return result;
+
+    WeldedMesh welded = weld_triangulation(shape.get(), crease_angle);
+
+    // Face IDs follow tessellate_deflection (TopExp::MapShapes index)
+    TopTools_IndexedMapOfShape face_map;
+    TopExp::MapShapes(shape.get(), TopAbs_FACE, face_map);
+    std::vector<int32_t> map_index;
+    for (TopExp_Explorer exp(shape.get(), TopAbs_FACE); exp.More(); exp.Next()) {
+        map_index.push_back(face_map.FindIndex(exp.Current()));
+    }
+
+    result.positions.reserve(welded.positions.size() * 3);
+    result.normals.reserve(welded.normals.size() * 3);
+    for (size_t i = 0; i < welded.positions.size(); ++i) {
+        result.positions.push_back(static_cast<float>(welded.positions[i].x));
+        result.positions.push_back(static_cast<float>(welded.positions[i].y));
+        result.positions.push_back(static_cast<float>(welded.positions[i].z));
+        result.normals.push_back(static_cast<float>(welded.normals[i].x));
+        result.normals.push_back(static_cast<float>(welded.normals[i].y));
+        result.normals.push_back(static_cast<float>(welded.normals[i].z));
+    }
+
+    result.indices.reserve(welded.triangles.size() * 3);
+    result.face_ids.reserve(welded.triangles.size());
+    for (size_t i = 0; i < welded.triangles.size(); ++i) {
+        const Triangle& t = welded.triangles[i];
+        result.indices.push_back(t.v0);
+        result.indices.push_back(t.v1);
+        result.indices.push_back(t.v2);
+        result.face_ids.push_back(map_index[welded.face_ids[i]]);
+    }
+
+    return result;
+}
+
 //------------------------------------------------------------------------------
 // Adaptive Tessellation
 //------------------------------------------------------------------------------
 
 MeshData tessellate_adaptive(
     const OcctShape& shape,
-    double min_deflection,
-    double max_deflection,
-    double curvature_factor
+    const AdaptiveMeshOptions& options
 ) {
-    // Use bounding box to determine appropriate deflection
-    Bnd_Box bbox;
-    BRepBndLib::Add(shape.get(), bbox);
-    double xmin, ymin, zmin, xmax, ymax, zmax;
-    bbox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+    if (shape.is_null()) return MeshData{};
 
-    double diagonal = std::sqrt(
-        (xmax - xmin) * (xmax - xmin) +
-        (ymax - ymin) * (ymax - ymin) +
-        (zmax - zmin) * (zmax - zmin)
-    );
+    // Mesh a copy so the shape's (cached) triangulations stay as they are;
+    // the copy keeps the face order, so face ids still match
+    BRepBuilderAPI_Copy copier(shape.get(), Standard_False, Standard_False);
+    const TopoDS_Shape& copy = copier.Shape();
+    if (!mesh_adaptive(copy, options)) return MeshData{};
 
-    double deflection = std::clamp(
-        diagonal * 0.001 * curvature_factor,
-        min_deflection,
-        max_deflection
-    );
+    return extract_triangulations(copy);
+}
 
-    return tessellate_deflection(shape, deflection);
+MeshData tessellate_adaptive(
+    const OcctShape& shape,
+    double min_deflection,
+    double max_deflection,
+    double curvature_factor
+) {
+    AdaptiveMeshOptions options;
+    options.min_deflection = min_deflection;
+    options.max_deflection = max_deflection;
+    options.curvature_factor = curvature_factor;
+    return tessellate_adaptive(shape, options);
 }
 
 MeshData tessellate_edge_length(
@@ -307,15 +581,69 @@ MeshData tessellate_edge_length(
     double min_edge_length,
     double max_edge_length
 ) {
-    // Approximate deflection from edge length
-    double deflection = min_edge_length / 2;
-    return tessellate_deflection(shape, deflection);
+    // Deflection follows curvature, bounded relative to the element sizes
+    AdaptiveMeshOptions options;
+    options.min_edge_length = min_edge_length;
+    options.max_edge_length = max_edge_length;
+    if (min_edge_length > 0.0) {
+        options.min_deflection = 0.1 * min_edge_length;
+    }
+    if (max_edge_length > 0.0) {
+        options.max_deflection = std::max(options.min_deflection, 0.1 * max_edge_length);
+    }
+    return tessellate_adaptive(shape, options);
 }
 
 //------------------------------------------------------------------------------
 // LOD Generation
 //------------------------------------------------------------------------------
 
+std::vector<LODLevel> generate_lod_levels(
+    const OcctShape& shape,
+    const std::vector<double>& deflections
+) {
+    std::vector<double> sorted;
+    for (double deflection : deflections) {
+        if (deflection > 0.0) sorted.push_back(deflection);
+    }
+    std::sort(sorted.begin(), sorted.end());
+
+    std::vector<LODLevel> levels;
+    if (sorted.empty()) return levels;
+    levels.reserve(sorted.size());
+
+    // BRepMesh runs once; the finest triangulation stays on the shape
+    LODLevel finest;
+    finest.mesh = tessellate_deflection(shape, sorted.front());
+    finest.deflection = sorted.front();
+    finest.error = sorted.front();
+    levels.push_back(std::move(finest));
+
+    for (size_t i = 1; i < sorted.size(); ++i) {
+        const LODLevel& previous = levels.back();
+
+        LODLevel level;
+        level.deflection = sorted[i];
+
+        // Remaining error budget for this level, spent collapsing the previous one
+        double budget = sorted[i] - previous.error;
+        if (budget <= 0.0) {
+            level.mesh = previous.mesh;
+            level.error = previous.error;
+        } else {
+            SimplifyOptions options;
+            options.max_error = budget;
+
+            double collapse_error = 0.0;
+            level.mesh = simplify(previous.mesh, options, &collapse_error);
+            level.error = previous.error + collapse_error;
+        }
+        levels.push_back(std::move(level));
+    }
+
+    return levels;
+}
+
 LODMesh generate_lods(
     const OcctShape& shape,
     double high_deflection,
@@ -323,11 +651,21 @@ LODMesh generate_lods(
     double low_deflection,
     double preview_deflection
 ) {
+    std::vector<double> deflections = {high_deflection, medium_deflection, low_deflection, preview_deflection};
+    std::vector<LODLevel> levels = generate_lod_levels(shape, deflections);
+
     LODMesh result;
-    result.high = tessellate_deflection(shape, high_deflection);
-    result.medium = tessellate_deflection(shape, medium_deflection);
-    result.low = tessellate_deflection(shape, low_deflection);
-    result.preview = tessellate_deflection(shape, preview_deflection);
+    if (levels.size() != deflections.size()) return result;
+
+    // Levels come back finest first; the defaults are already in that order
+    result.high = std::move(levels[0].mesh);
+    result.high_error = levels[0].error;
+    result.medium = std::move(levels[1].mesh);
+    result.medium_error = levels[1].error;
+    result.low = std::move(levels[2].mesh);
+    result.low_error = levels[2].error;
+    result.preview = std::move(levels[3].mesh);
+    result.preview_error = levels[3].error;
     return result;
 }
 
@@ -502,71 +840,207 @@ WireframeMesh extract_sharp_edges(
 }
 
 //------------------------------------------------------------------------------
-// Mesh Optimization
+// Mesh Simplification
 //------------------------------------------------------------------------------
 
-MeshData optimize_for_rendering(const MeshData& mesh) {
-    // Simple vertex cache optimization using a linear reordering
-    // A full implementation would use a proper vertex cache optimizer
+MeshData decimate(
+    const MeshData& mesh,
+    uint32_t target_triangles
+) {
+    SimplifyOptions options;
+    options.target_triangles = std::max<uint32_t>(target_triangles, 1);
+    return simplify(mesh, options);
+}
 
-    MeshData result = mesh;
+MeshData decimate_vertices(
+    const MeshData& mesh,
+    uint32_t target_vertices
+) {
+    SimplifyOptions options;
+    options.target_vertices = std::max<uint32_t>(target_vertices, 3);
+    return simplify(mesh, options);
+}
 
-    // For now, just return the mesh as-is
-    // A proper implementation would reorder triangles for better cache utilization
+MeshData simplify_preserve_features(
+    const MeshData& mesh,
+    double feature_angle,
+    float reduction_ratio
+) {
+    double keep = 1.0 - std::clamp(static_cast<double>(reduction_ratio), 0.0, 1.0);
 
-    return result;
+    SimplifyOptions options;
+    options.target_triangles = std::max<size_t>(1, static_cast<size_t>(mesh.triangle_count() * keep));
+    options.feature_angle = feature_angle;
+    return simplify(mesh, options);
 }
 
-MeshData merge_vertices(
+MeshData simplify(
     const MeshData& mesh,
-    double tolerance
+    const SimplifyOptions& options,
+    double* error
 ) {
+    const size_t vertex_count = mesh.vertex_count();
+    const size_t triangle_count = mesh.triangle_count();
+    if (error) *error = 0.0;
+    if (triangle_count == 0) return mesh;
+
+    // Per-face tessellations only share positions: weld them for connectivity,
+    // within a millionth of the model size
+    const double weld_tolerance = 1e-6 * mesh_bounding_box(mesh).diagonal();
+    WeldMap weld = weld_positions(mesh.positions.data(), vertex_count, weld_tolerance);
+    std::vector<float> welded_positions;
+    welded_positions.reserve(weld.unique.size() * 3);
+    for (uint32_t src : weld.unique) {
+        welded_positions.insert(welded_positions.end(),
+                                mesh.positions.begin() + src * 3, mesh.positions.begin() + src * 3 + 3);
+    }
+    std::vector<uint32_t> welded_indices(mesh.indices.size());
+    for (size_t i = 0; i < mesh.indices.size(); ++i) {
+        welded_indices[i] = weld.remap[mesh.indices[i]];
+    }
+
+    const bool has_face_ids = mesh.face_ids.size() == triangle_count;
+    const bool has_normals = mesh.normals.size() == mesh.positions.size();
+    std::vector<uint32_t> groups;
+    if (has_face_ids) groups.assign(mesh.face_ids.begin(), mesh.face_ids.end());
+
+    SimplifyResult simplified = simplify_mesh(
+        welded_positions.data(), weld.unique.size(),
+        welded_indices.data(), triangle_count,
+        has_face_ids ? groups.data() : nullptr, options);
+    if (error) *error = simplified.error;
+
+    // Input vertices per welded vertex, so each remaining triangle can use
+    // the copy that belongs to its own face (keeps normals sharp at creases)
+    std::vector<uint32_t> vertex_face(vertex_count, 0);
+    if (has_face_ids) {
+        for (size_t i = 0; i < mesh.indices.size(); ++i) vertex_face[mesh.indices[i]] = groups[i / 3];
+    }
+    std::vector<uint32_t> copies_start(weld.unique.size() + 1, 0);
+    for (size_t v = 0; v < vertex_count; ++v) ++copies_start[weld.remap[v] + 1];
+    for (size_t w = 0; w < weld.unique.size(); ++w) copies_start[w + 1] += copies_start[w];
+    std::vector<uint32_t> copies(vertex_count);
+    {
+        std::vector<uint32_t> cursor(copies_start.begin(), copies_start.end() - 1);
+        for (size_t v = 0; v < vertex_count; ++v) copies[cursor[weld.remap[v]]++] = static_cast<uint32_t>(v);
+    }
+
     MeshData result;
+    std::vector<uint32_t> output_index(vertex_count, UINT32_MAX);
+    result.indices.reserve(simplified.indices.size());
+
+    for (size_t t = 0; t < simplified.triangles.size(); ++t) {
+        const uint32_t source_triangle = simplified.triangles[t];
+        const uint32_t face = has_face_ids ? groups[source_triangle] : 0;
+
+        for (int k = 0; k < 3; ++k) {
+            const uint32_t welded = simplified.indices[t * 3 + k];
+            uint32_t src = weld.unique[welded];
+            for (uint32_t c = copies_start[welded]; c < copies_start[welded + 1]; ++c) {
+                if (vertex_face[copies[c]] == face) {
+                    src = copies[c];
+                    break;
+                }
+            }
 
-    // Build a map of unique vertices
-    std::vector<uint32_t> index_remap(mesh.vertex_count());
-    std::unordered_map<std::string, uint32_t> vertex_map;
+            if (output_index[src] == UINT32_MAX) {
+                output_index[src] = result.vertex_count();
+                result.positions.insert(result.positions.end(),
+                                        mesh.positions.begin() + src * 3, mesh.positions.begin() + src * 3 + 3);
+                if (has_normals) {
+                    result.normals.insert(result.normals.end(),
+                                          mesh.normals.begin() + src * 3, mesh.normals.begin() + src * 3 + 3);
+                }
+            }
+            result.indices.push_back(output_index[src]);
+        }
 
-    auto vertex_key = [tolerance](float x, float y, float z) {
-        int ix = static_cast<int>(x / tolerance);
-        int iy = static_cast<int>(y / tolerance);
-        int iz = static_cast<int>(z / tolerance);
-        return std::to_string(ix) + "_" + std::to_string(iy) + "_" + std::to_string(iz);
-    };
+        if (has_face_ids) result.face_ids.push_back(mesh.face_ids[source_triangle]);
+    }
 
-    uint32_t new_index = 0;
-    for (uint32_t i = 0; i < mesh.vertex_count(); ++i) {
-        float x = mesh.positions[i * 3];
-        float y = mesh.positions[i * 3 + 1];
-        float z = mesh.positions[i * 3 + 2];
+    return result;
+}
 
-        std::string key = vertex_key(x, y, z);
-        auto it = vertex_map.find(key);
+//------------------------------------------------------------------------------
+// Mesh Optimization
+//------------------------------------------------------------------------------
 
-        if (it == vertex_map.end()) {
-            vertex_map[key] = new_index;
-            index_remap[i] = new_index;
+MeshData optimize_for_rendering(
+    const MeshData& mesh,
+    const RenderOptimizeOptions& options
+) {
+    MeshData result = mesh;
 
-            result.positions.push_back(x);
-            result.positions.push_back(y);
-            result.positions.push_back(z);
+    const size_t vertex_count = mesh.vertex_count();
+    const bool has_normals = mesh.normals.size() == mesh.positions.size();
+    const size_t stride = has_normals ? 6 : 3;
 
-            if (!mesh.normals.empty()) {
-                result.normals.push_back(mesh.normals[i * 3]);
-                result.normals.push_back(mesh.normals[i * 3 + 1]);
-                result.normals.push_back(mesh.normals[i * 3 + 2]);
-            }
+    // Interleave so positions and normals are permuted together
+    std::vector<float> vertex_data(vertex_count * stride);
+    for (size_t i = 0; i < vertex_count; ++i) {
+        std::copy_n(mesh.positions.begin() + i * 3, 3, vertex_data.begin() + i * stride);
+        if (has_normals) {
+            std::copy_n(mesh.normals.begin() + i * 3, 3, vertex_data.begin() + i * stride + 3);
+        }
+    }
 
-            ++new_index;
-        } else {
-            index_remap[i] = it->second;
+    const size_t triangle_count = mesh.triangle_count();
+    const bool has_face_ids = mesh.face_ids.size() == triangle_count;
+    std::vector<uint32_t> groups;
+    if (has_face_ids) groups.assign(mesh.face_ids.begin(), mesh.face_ids.end());
+
+    optimize_mesh_buffers(vertex_data.data(), stride, vertex_count,
+                          result.indices.data(), triangle_count,
+                          has_face_ids ? groups.data() : nullptr, options);
+
+    for (size_t i = 0; i < vertex_count; ++i) {
+        std::copy_n(vertex_data.begin() + i * stride, 3, result.positions.begin() + i * 3);
+        if (has_normals) {
+            std::copy_n(vertex_data.begin() + i * stride + 3, 3, result.normals.begin() + i * 3);
+        }
+    }
+    if (has_face_ids) result.face_ids.assign(groups.begin(), groups.end());
+
+    return result;
+}
+
+VertexCacheStats analyze_vertex_cache(
+    const MeshData& mesh,
+    uint32_t cache_size
+) {
+    return analyze_vertex_cache(mesh.indices.data(), mesh.indices.size(),
+                                mesh.vertex_count(), cache_size);
+}
+
+MeshData merge_vertices(
+    const MeshData& mesh,
+    double tolerance
+) {
+    MeshData result;
+
+    WeldMap weld = weld_positions(mesh.positions.data(), mesh.vertex_count(), tolerance);
+
+    // Unique vertices keep the attributes of their first occurrence
+    result.positions.reserve(weld.unique.size() * 3);
+    for (uint32_t src : weld.unique) {
+        result.positions.push_back(mesh.positions[src * 3]);
+        result.positions.push_back(mesh.positions[src * 3 + 1]);
+        result.positions.push_back(mesh.positions[src * 3 + 2]);
+    }
+
+    if (!mesh.normals.empty()) {
+        result.normals.reserve(weld.unique.size() * 3);
+        for (uint32_t src : weld.unique) {
+            result.normals.push_back(mesh.normals[src * 3]);
+            result.normals.push_back(mesh.normals[src * 3 + 1]);
+            result.normals.push_back(mesh.normals[src * 3 + 2]);
         }
     }
 
     // Remap indices
     result.indices.reserve(mesh.indices.size());
     for (uint32_t idx : mesh.indices) {
-        result.indices.push_back(index_remap[idx]);
+        result.indices.push_back(weld.remap[idx]);
     }
 
     result.face_ids = mesh.face_ids;
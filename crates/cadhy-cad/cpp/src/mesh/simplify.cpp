@@ -0,0 +1,500 @@
+/**
+ * @file simplify.cpp
+ * @brief Implementation of quadric-error edge-collapse simplification
+ */
+
+#include <cadhy/mesh/simplify.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+
+namespace cadhy::mesh {
+
+//------------------------------------------------------------------------------
+// Helper Functions
+//------------------------------------------------------------------------------
+
+namespace {
+
+constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+/// Weight of feature-edge constraint planes relative to triangle area
+constexpr double FEATURE_WEIGHT = 10.0;
+
+struct Vec3 {
+    double x, y, z;
+};
+
+inline Vec3 sub(const Vec3& a, const Vec3& b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+inline double dot(const Vec3& a, const Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+inline Vec3 cross(const Vec3& a, const Vec3& b) {
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+/// Symmetric 4x4 error quadric; `weight` is the accumulated triangle area
+struct Quadric {
+    double a2 = 0, ab = 0, ac = 0, ad = 0;
+    double b2 = 0, bc = 0, bd = 0;
+    double c2 = 0, cd = 0;
+    double d2 = 0;
+    double weight = 0;
+
+    /// Add plane ax + by + cz + d = 0 (unit normal) scaled by w
+    void add_plane(const Vec3& n, double d, double w) {
+        a2 += w * n.x * n.x; ab += w * n.x * n.y; ac += w * n.x * n.z; ad += w * n.x * d;
+        b2 += w * n.y * n.y; bc += w * n.y * n.z; bd += w * n.y * d;
+        c2 += w * n.z * n.z; cd += w * n.z * d;
+        d2 += w * d * d;
+    }
+
+    void add(const Quadric& q) {
+        a2 += q.a2; ab += q.ab; ac += q.ac; ad += q.ad;
+        b2 += q.b2; bc += q.bc; bd += q.bd;
+        c2 += q.c2; cd += q.cd;
+        d2 += q.d2;
+        weight += q.weight;
+    }
+
+    /// Sum of weighted squared plane distances of p
+    double eval(const Vec3& p) const {
+        double x = p.x, y = p.y, z = p.z;
+        return a2 * x * x + 2 * ab * x * y + 2 * ac * x * z + 2 * ad * x
+             + b2 * y * y + 2 * bc * y * z + 2 * bd * y
+             + c2 * z * z + 2 * cd * z
+             + d2;
+    }
+};
+
+enum class VertexKind : uint8_t {
+    Interior,  // Collapses onto any neighbour
+    Feature,   // On a border/crease curve: slides along it only
+    Locked     // Curve end, junction or non-manifold vertex: never moves
+};
+
+/// Queued collapse; stale once the vertex's cost has changed
+struct HeapEntry {
+    float cost;
+    uint32_t vertex;
+
+    bool operator>(const HeapEntry& other) const { return cost > other.cost; }
+};
+
+/// Edge-collapse simplifier. Triangles around each vertex are kept in
+/// singly linked corner lists (corner = triangle * 3 + k); corners of
+/// collapsed triangles are unlinked lazily.
+class Simplifier {
+public:
+    Simplifier(
+        const float* positions,
+        size_t vertex_count,
+        const uint32_t* indices,
+        size_t triangle_count,
+        const uint32_t* groups,
+        const SimplifyOptions& options
+    )
+        : positions_(positions)
+        , groups_(groups)
+        , options_(options)
+        , indices_(indices, indices + triangle_count * 3)
+        , head_(vertex_count, NONE)
+        , next_(triangle_count * 3, NONE)
+        , quadrics_(vertex_count)
+        , kind_(vertex_count, VertexKind::Interior)
+        , vertex_alive_(vertex_count, 0)
+        , target_(vertex_count, NONE)
+        , cost_(vertex_count, 0.0f)
+        , mark_(vertex_count, 0)
+        , cos_feature_(std::cos(options.feature_angle)) {}
+
+    SimplifyResult run() {
+        build_topology();
+        classify_vertices();
+
+        HeapEntry best;
+        for (uint32_t v = 0; v < vertex_alive_.size(); ++v) {
+            if (!vertex_alive_[v] || kind_[v] == VertexKind::Locked) continue;
+            gather_neighbours(v, scratch_);
+            if (cheapest_collapse(v, scratch_, false, best)) queue(v, best.vertex, best.cost);
+        }
+
+        const double max_cost = options_.max_error * options_.max_error;
+        double worst = 0.0;
+
+        while (!heap_.empty()) {
+            if (options_.target_triangles > 0 && live_triangles_ <= options_.target_triangles) break;
+            if (options_.target_vertices > 0 && live_vertices_ <= options_.target_vertices) break;
+
+            HeapEntry entry = heap_.top();
+            heap_.pop();
+            if (!vertex_alive_[entry.vertex] || target_[entry.vertex] == NONE || entry.cost != cost_[entry.vertex]) continue;
+            if (entry.cost > max_cost) break;
+
+            // Costs are refreshed lazily: when the queued target is gone or
+            // got more expensive, re-queue the cheapest collapse instead
+            const uint32_t u = entry.vertex;
+            const uint32_t v = target_[u];
+            gather_neighbours(u, scratch_);
+            bool target_ok = vertex_alive_[v] && mark_[v] == stamp_;
+            if (!target_ok || static_cast<float>(collapse_cost(u, v)) > entry.cost) {
+                if (cheapest_collapse(u, scratch_, false, best)) queue(u, best.vertex, best.cost);
+                else target_[u] = NONE;
+                continue;
+            }
+
+            // Legality is only checked here; fall back to the cheapest
+            // legal target
+            if (!can_collapse(u, v)) {
+                if (cheapest_collapse(u, scratch_, true, best)) queue(u, best.vertex, best.cost);
+                else target_[u] = NONE;
+                continue;
+            }
+
+            collapse(u, v);
+            worst = std::max(worst, double(entry.cost));
+        }
+
+        SimplifyResult result;
+        result.error = std::sqrt(worst);
+        for (size_t t = 0; t * 3 < indices_.size(); ++t) {
+            if (!alive(t)) continue;
+            result.indices.insert(result.indices.end(), indices_.begin() + t * 3, indices_.begin() + t * 3 + 3);
+            result.triangles.push_back(static_cast<uint32_t>(t));
+        }
+        return result;
+    }
+
+private:
+    Vec3 position(uint32_t v) const {
+        const float* p = positions_ + size_t(v) * 3;
+        return {p[0], p[1], p[2]};
+    }
+
+    /// Unnormalised normal of triangle t, optionally with vertex `from`
+    /// moved onto `to`
+    Vec3 triangle_normal(size_t t, uint32_t from = NONE, uint32_t to = NONE) const {
+        Vec3 p[3];
+        for (int k = 0; k < 3; ++k) {
+            uint32_t v = indices_[t * 3 + k];
+            p[k] = position(v == from ? to : v);
+        }
+        return cross(sub(p[1], p[0]), sub(p[2], p[0]));
+    }
+
+    /// Collapsed triangles have their first index cleared
+    bool alive(size_t t) const { return indices_[t * 3] != NONE; }
+
+    bool has_vertex(size_t t, uint32_t v) const {
+        return indices_[t * 3] == v || indices_[t * 3 + 1] == v || indices_[t * 3 + 2] == v;
+    }
+
+    /// Border, group border or crease between the triangles of an edge
+    /// (t1 == NONE for an open boundary)
+    bool is_feature_edge(size_t t0, size_t t1) const {
+        if (t1 == NONE) return true;
+        if (options_.preserve_group_borders && groups_ && groups_[t0] != groups_[t1]) return true;
+        if (options_.feature_angle > 0.0) {
+            Vec3 n0 = triangle_normal(t0);
+            Vec3 n1 = triangle_normal(t1);
+            double len = std::sqrt(dot(n0, n0) * dot(n1, n1));
+            if (len > 0.0 && dot(n0, n1) < cos_feature_ * len) return true;
+        }
+        return false;
+    }
+
+    void build_topology() {
+        const size_t vertex_count = head_.size();
+        for (size_t t = 0; t * 3 < indices_.size(); ++t) {
+            uint32_t a = indices_[t * 3], b = indices_[t * 3 + 1], c = indices_[t * 3 + 2];
+            if (a >= vertex_count || b >= vertex_count || c >= vertex_count || a == b || b == c || a == c) {
+                indices_[t * 3] = NONE;
+                continue;
+            }
+            ++live_triangles_;
+
+            for (int k = 0; k < 3; ++k) {
+                uint32_t corner = static_cast<uint32_t>(t * 3 + k);
+                uint32_t v = indices_[corner];
+                next_[corner] = head_[v];
+                head_[v] = corner;
+                if (!vertex_alive_[v]) {
+                    vertex_alive_[v] = 1;
+                    ++live_vertices_;
+                }
+            }
+
+            // Area-weighted triangle plane
+            Vec3 n = triangle_normal(t);
+            double len = std::sqrt(dot(n, n));
+            if (len <= 0.0) continue;
+            n = {n.x / len, n.y / len, n.z / len};
+            double d = -dot(n, position(a));
+            double area = 0.5 * len;
+            for (uint32_t v : {a, b, c}) {
+                quadrics_[v].add_plane(n, d, area);
+                quadrics_[v].weight += area;
+            }
+        }
+    }
+
+    /// Count feature edges per vertex, add their constraint planes and
+    /// assign vertex kinds
+    void classify_vertices() {
+        const size_t vertex_count = head_.size();
+        std::vector<uint32_t> edge_count(vertex_count, 0);
+        std::vector<uint32_t> edge_triangle0(vertex_count, NONE);
+        std::vector<uint32_t> edge_triangle1(vertex_count, NONE);
+        std::vector<uint32_t> neighbours;
+
+        for (uint32_t a = 0; a < vertex_count; ++a) {
+            if (!vertex_alive_[a]) continue;
+
+            neighbours.clear();
+            for (uint32_t c = head_[a]; c != NONE; c = next_[c]) {
+                uint32_t t = c / 3;
+                for (int k = 0; k < 3; ++k) {
+                    uint32_t b = indices_[t * 3 + k];
+                    if (b == a) continue;
+                    if (edge_count[b] == 0) {
+                        neighbours.push_back(b);
+                        edge_triangle0[b] = t;
+                    } else {
+                        edge_triangle1[b] = t;
+                    }
+                    ++edge_count[b];
+                }
+            }
+
+            int feature_edges = 0;
+            bool manifold = true;
+            for (uint32_t b : neighbours) {
+                uint32_t count = edge_count[b];
+                if (count > 2) manifold = false;
+                if (count <= 2 && is_feature_edge(edge_triangle0[b], count == 2 ? edge_triangle1[b] : NONE)) {
+                    ++feature_edges;
+                    if (b > a) {
+                        add_edge_constraint(a, b, edge_triangle0[b]);
+                        if (count == 2) add_edge_constraint(a, b, edge_triangle1[b]);
+                    }
+                }
+                edge_count[b] = 0;
+            }
+
+            if (!manifold || (feature_edges != 0 && feature_edges != 2)) {
+                kind_[a] = VertexKind::Locked;
+            } else if (feature_edges == 2) {
+                kind_[a] = VertexKind::Feature;
+            }
+        }
+    }
+
+    /// Plane through edge (a, b) perpendicular to triangle t keeps the edge
+    /// from drifting sideways
+    void add_edge_constraint(uint32_t a, uint32_t b, size_t t) {
+        Vec3 n = triangle_normal(t);
+        Vec3 edge = sub(position(b), position(a));
+        Vec3 m = cross(edge, n);
+        double len = std::sqrt(dot(m, m));
+        if (len <= 0.0) return;
+        m = {m.x / len, m.y / len, m.z / len};
+        double d = -dot(m, position(a));
+        double w = FEATURE_WEIGHT * dot(edge, edge);
+        quadrics_[a].add_plane(m, d, w);
+        quadrics_[b].add_plane(m, d, w);
+    }
+
+    /// One-ring of v (deduplicated, marked with a fresh stamp); unlinks the
+    /// corners of dead triangles on the way
+    void gather_neighbours(uint32_t v, std::vector<uint32_t>& out) {
+        out.clear();
+        ++stamp_;
+        uint32_t prev = NONE;
+        for (uint32_t c = head_[v]; c != NONE;) {
+            uint32_t next = next_[c];
+            uint32_t t = c / 3;
+            if (!alive(t)) {
+                if (prev == NONE) head_[v] = next; else next_[prev] = next;
+            } else {
+                for (int k = 0; k < 3; ++k) {
+                    uint32_t n = indices_[t * 3 + k];
+                    if (n != v && mark_[n] != stamp_) {
+                        mark_[n] = stamp_;
+                        out.push_back(n);
+                    }
+                }
+                prev = c;
+            }
+            c = next;
+        }
+    }
+
+    /// Whether u can collapse onto v. Expects u's one-ring to carry the
+    /// current stamp (gather_neighbours(u) just ran).
+    bool can_collapse(uint32_t u, uint32_t v) {
+        if (v == NONE || !vertex_alive_[v]) return false;
+        if (kind_[u] == VertexKind::Locked) return false;
+        if (kind_[u] == VertexKind::Feature && kind_[v] == VertexKind::Interior) return false;
+
+        // Triangles on edge (u, v) collapse; the others must not flip
+        uint32_t shared[2];
+        int shared_count = 0;
+        for (uint32_t c = head_[u]; c != NONE; c = next_[c]) {
+            uint32_t t = c / 3;
+            if (!alive(t)) continue;
+            if (has_vertex(t, v)) {
+                if (shared_count == 2) return false;
+                shared[shared_count++] = t;
+                continue;
+            }
+            Vec3 before = triangle_normal(t);
+            Vec3 after = triangle_normal(t, u, v);
+            double before2 = dot(before, before);
+            double after2 = dot(after, after);
+            if (dot(before, after) <= 0.0 || after2 <= 1e-12 * before2) return false;
+        }
+        if (shared_count == 0) return false;
+
+        // Curve vertices may only slide along their curve
+        if (kind_[u] == VertexKind::Feature &&
+            !is_feature_edge(shared[0], shared_count == 2 ? shared[1] : NONE)) {
+            return false;
+        }
+
+        // Link condition: the only common neighbours are the vertices
+        // opposite the collapsing edge
+        int common = 0;
+        uint32_t seen[2] = {NONE, NONE};
+        for (uint32_t c = head_[v]; c != NONE; c = next_[c]) {
+            uint32_t t = c / 3;
+            if (!alive(t)) continue;
+            for (int k = 0; k < 3; ++k) {
+                uint32_t n = indices_[t * 3 + k];
+                if (n == u || n == v || mark_[n] != stamp_ || n == seen[0] || n == seen[1]) continue;
+                if (common == 2) return false;
+                seen[common++] = n;
+            }
+        }
+        return common == shared_count;
+    }
+
+    /// Mean squared deviation of collapsing u onto v
+    double collapse_cost(uint32_t u, uint32_t v) const {
+        const Quadric& qu = quadrics_[u];
+        const Quadric& qv = quadrics_[v];
+        Vec3 p = position(v);
+        double error = qu.eval(p) + qv.eval(p);  // Quadrics are linear in their coefficients
+        return std::max(0.0, error) / std::max(qu.weight + qv.weight, 1e-30);
+    }
+
+    bool allowed_target(uint32_t u, uint32_t v) const {
+        return kind_[u] != VertexKind::Feature || kind_[v] != VertexKind::Interior;
+    }
+
+    void queue(uint32_t v, uint32_t target, float cost) {
+        target_[v] = target;
+        cost_[v] = cost;
+        heap_.push({cost, v});
+    }
+
+    /// Cheapest collapse of v onto one of `neighbours` (its current
+    /// one-ring); with `validate`, the cheapest legal one, which requires
+    /// the one-ring to carry the current stamp
+    bool cheapest_collapse(uint32_t v, const std::vector<uint32_t>& neighbours, bool validate, HeapEntry& best) {
+        candidates_.clear();
+        for (uint32_t n : neighbours) {
+            if (allowed_target(v, n)) candidates_.push_back({static_cast<float>(collapse_cost(v, n)), n});
+        }
+        auto by_cost = [](const HeapEntry& a, const HeapEntry& b) { return a.cost < b.cost; };
+
+        if (!validate) {
+            if (candidates_.empty()) return false;
+            best = *std::min_element(candidates_.begin(), candidates_.end(), by_cost);
+            return true;
+        }
+
+        std::sort(candidates_.begin(), candidates_.end(), by_cost);
+        for (const HeapEntry& candidate : candidates_) {
+            if (can_collapse(v, candidate.vertex)) {
+                best = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void collapse(uint32_t u, uint32_t v) {
+        for (uint32_t c = head_[u]; c != NONE;) {
+            uint32_t next = next_[c];
+            uint32_t t = c / 3;
+            if (alive(t)) {
+                if (has_vertex(t, v)) {
+                    indices_[t * 3] = NONE;
+                    --live_triangles_;
+                } else {
+                    indices_[c] = v;
+                    next_[c] = head_[v];
+                    head_[v] = c;
+                }
+            }
+            c = next;
+        }
+        head_[u] = NONE;
+
+        quadrics_[v].add(quadrics_[u]);
+        vertex_alive_[u] = 0;
+        --live_vertices_;
+
+        // Entries of v and of neighbours that targeted u or v are refreshed
+        // when popped; neighbours only need to consider v as a new target
+        gather_neighbours(v, ring_);
+        for (uint32_t n : ring_) {
+            if (kind_[n] == VertexKind::Locked || !allowed_target(n, v)) continue;
+            float cost = static_cast<float>(collapse_cost(n, v));
+            if (target_[n] == NONE || cost < cost_[n]) queue(n, v, cost);
+        }
+    }
+
+    const float* positions_;
+    const uint32_t* groups_;
+    SimplifyOptions options_;
+
+    std::vector<uint32_t> indices_;  // NONE as first index marks a collapsed triangle
+    std::vector<uint32_t> head_;   // First corner of each vertex
+    std::vector<uint32_t> next_;   // Next corner of the same vertex
+    std::vector<Quadric> quadrics_;
+    std::vector<VertexKind> kind_;
+    std::vector<char> vertex_alive_;
+    std::vector<uint32_t> target_;
+    std::vector<float> cost_;
+    std::vector<uint32_t> mark_;
+    uint32_t stamp_ = 0;
+    double cos_feature_;
+
+    size_t live_triangles_ = 0;
+    size_t live_vertices_ = 0;
+
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heap_;
+    std::vector<uint32_t> scratch_;
+    std::vector<uint32_t> ring_;
+    std::vector<HeapEntry> candidates_;
+};
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+// Mesh Simplification
+//------------------------------------------------------------------------------
+
+SimplifyResult simplify_mesh(
+    const float* positions,
+    size_t vertex_count,
+    const uint32_t* indices,
+    size_t triangle_count,
+    const uint32_t* triangle_groups,
+    const SimplifyOptions& options
+) {
+    Simplifier simplifier(positions, vertex_count, indices, triangle_count, triangle_groups, options);
+    return simplifier.run();
+}
+
+} // namespace cadhy::mesh
@@ -0,0 +1,201 @@
+/**
+ * @file slice.cpp
+ * @brief Implementation of fast plane sections of welded triangle meshes
+ */
+
+#include <cadhy/mesh/slice.hpp>
+
+#include <algorithm>
+
+namespace cadhy::mesh {
+
+//------------------------------------------------------------------------------
+// Helper Functions
+//------------------------------------------------------------------------------
+
+namespace {
+
+constexpr uint64_t EMPTY_KEY = ~uint64_t(0);
+constexpr uint32_t NO_SEGMENT = ~uint32_t(0);
+
+/// Undirected mesh edge key (smaller vertex index in the high half)
+inline uint64_t edge_key(uint32_t a, uint32_t b) {
+    return a < b ? (uint64_t(a) << 32) | b : (uint64_t(b) << 32) | a;
+}
+
+/// Open-addressing map from a segment's start edge to the segment
+class SegmentTable {
+public:
+    explicit SegmentTable(size_t count) {
+        size_t capacity = 16;
+        while (capacity < count * 2) capacity <<= 1;
+        mask_ = capacity - 1;
+        keys_.assign(capacity, EMPTY_KEY);
+        values_.assign(capacity, NO_SEGMENT);
+    }
+
+    /// Insert unless the key is present (non-manifold input); false then
+    bool insert(uint64_t key, uint32_t segment) {
+        for (size_t slot = hash(key);; slot = (slot + 1) & mask_) {
+            if (keys_[slot] == key) return false;
+            if (keys_[slot] == EMPTY_KEY) {
+                keys_[slot] = key;
+                values_[slot] = segment;
+                return true;
+            }
+        }
+    }
+
+    uint32_t find(uint64_t key) const {
+        for (size_t slot = hash(key);; slot = (slot + 1) & mask_) {
+            if (keys_[slot] == key) return values_[slot];
+            if (keys_[slot] == EMPTY_KEY) return NO_SEGMENT;
+        }
+    }
+
+private:
+    size_t hash(uint64_t key) const {
+        return static_cast<size_t>((key * 0x9e3779b97f4a7c15ull) >> 17) & mask_;
+    }
+
+    size_t mask_ = 0;
+    std::vector<uint64_t> keys_;
+    std::vector<uint32_t> values_;
+};
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+// Mesh Slicing
+//------------------------------------------------------------------------------
+
+MeshSlicer::MeshSlicer(const float* positions, size_t vertex_count,
+                       const uint32_t* indices, size_t triangle_count)
+    : indices_(indices, indices + triangle_count * 3) {
+    xs_.resize(vertex_count);
+    ys_.resize(vertex_count);
+    zs_.resize(vertex_count);
+    for (size_t i = 0; i < vertex_count; ++i) {
+        xs_[i] = positions[3 * i];
+        ys_[i] = positions[3 * i + 1];
+        zs_[i] = positions[3 * i + 2];
+    }
+}
+
+std::vector<SliceLoop> MeshSlicer::slice(const SlicePlane& plane) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const size_t n = xs_.size();
+    distances_.resize(n);
+    above_.resize(n);
+
+    // Signed distances; vertices on the plane count as above so every
+    // straddling triangle has exactly two crossing edges
+    {
+        const float nx = static_cast<float>(plane.normal[0]);
+        const float ny = static_cast<float>(plane.normal[1]);
+        const float nz = static_cast<float>(plane.normal[2]);
+        const float w = static_cast<float>(plane.origin[0] * plane.normal[0] +
+                                           plane.origin[1] * plane.normal[1] +
+                                           plane.origin[2] * plane.normal[2]);
+        const float* xs = xs_.data();
+        const float* ys = ys_.data();
+        const float* zs = zs_.data();
+        float* d = distances_.data();
+        uint8_t* above = above_.data();
+        for (size_t i = 0; i < n; ++i) {
+            float di = xs[i] * nx + ys[i] * ny + zs[i] * nz - w;
+            d[i] = di;
+            above[i] = di >= 0.0f;
+        }
+    }
+
+    // One directed segment per straddling triangle, from the edge crossed
+    // going above -> below to the edge crossed going below -> above (walking
+    // the triangle's own winding). For outward-oriented triangles this runs
+    // outer boundaries counter-clockwise when seen from +normal.
+    std::vector<uint64_t> from, to;
+    const uint32_t* idx = indices_.data();
+    const size_t triangles = indices_.size() / 3;
+    for (size_t t = 0; t < triangles; ++t) {
+        const uint32_t v[3] = {idx[3 * t], idx[3 * t + 1], idx[3 * t + 2]};
+        const unsigned mask = above_[v[0]] | (above_[v[1]] << 1) | (above_[v[2]] << 2);
+        if (mask == 0 || mask == 7) continue;
+
+        uint64_t down = EMPTY_KEY, up = EMPTY_KEY;
+        for (int e = 0; e < 3; ++e) {
+            uint32_t a = v[e], b = v[(e + 1) % 3];
+            if (above_[a] && !above_[b]) down = edge_key(a, b);
+            else if (!above_[a] && above_[b]) up = edge_key(a, b);
+        }
+        from.push_back(down);
+        to.push_back(up);
+    }
+
+    std::vector<SliceLoop> loops;
+    const size_t segments = from.size();
+    if (segments == 0) return loops;
+
+    // Chain: a segment continues with the one starting at its end edge
+    SegmentTable table(segments);
+    for (size_t s = 0; s < segments; ++s) {
+        table.insert(from[s], static_cast<uint32_t>(s));
+    }
+    std::vector<uint32_t> next(segments);
+    std::vector<uint8_t> has_previous(segments, 0);
+    for (size_t s = 0; s < segments; ++s) {
+        next[s] = table.find(to[s]);
+        if (next[s] != NO_SEGMENT && next[s] != s) has_previous[next[s]] = 1;
+    }
+
+    // Crossing point of a mesh edge, in plane coordinates
+    const double* o = plane.origin;
+    auto append_point = [&](SliceLoop& loop, uint64_t key) {
+        const uint32_t a = static_cast<uint32_t>(key >> 32);
+        const uint32_t b = static_cast<uint32_t>(key & 0xffffffffu);
+        const double da = distances_[a];
+        const double db = distances_[b];
+        const double t = da / (da - db);
+        const double p[3] = {
+            xs_[a] + t * (double(xs_[b]) - xs_[a]) - o[0],
+            ys_[a] + t * (double(ys_[b]) - ys_[a]) - o[1],
+            zs_[a] + t * (double(zs_[b]) - zs_[a]) - o[2]
+        };
+        loop.points.push_back(p[0] * plane.x_axis[0] + p[1] * plane.x_axis[1] + p[2] * plane.x_axis[2]);
+        loop.points.push_back(p[0] * plane.y_axis[0] + p[1] * plane.y_axis[1] + p[2] * plane.y_axis[2]);
+    };
+
+    std::vector<uint8_t> visited(segments, 0);
+    auto walk = [&](size_t start) {
+        SliceLoop loop;
+        size_t s = start;
+        while (true) {
+            visited[s] = 1;
+            append_point(loop, from[s]);
+
+            const uint32_t following = next[s];
+            if (following == start) {
+                loop.closed = true;
+                break;
+            }
+            if (following == NO_SEGMENT || visited[following]) {
+                append_point(loop, to[s]);  // Open end (boundary or non-manifold)
+                break;
+            }
+            s = following;
+        }
+        loops.push_back(std::move(loop));
+    };
+
+    // Open chains first (from their free start), then the remaining cycles
+    for (size_t s = 0; s < segments; ++s) {
+        if (!visited[s] && !has_previous[s]) walk(s);
+    }
+    for (size_t s = 0; s < segments; ++s) {
+        if (!visited[s]) walk(s);
+    }
+
+    return loops;
+}
+
+} // namespace cadhy::mesh
@@ -0,0 +1,404 @@
+/**
+ * @file vertex_cache.cpp
+ * @brief Implementation of triangle and vertex reordering for rendering
+ */
+
+#include <cadhy/mesh/vertex_cache.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+namespace cadhy::mesh {
+
+//------------------------------------------------------------------------------
+// Helper Functions
+//------------------------------------------------------------------------------
+
+namespace {
+
+constexpr uint32_t NO_VERTEX = std::numeric_limits<uint32_t>::max();
+
+/// Tipsify over one triangle set with local (dense) vertex indices.
+/// Appends local triangle indices to `order`; `cluster_starts` receives the
+/// positions in `order` where the cache had to restart cold.
+void tipsify(
+    const std::vector<uint32_t>& indices,
+    size_t vertex_count,
+    uint32_t cache_size,
+    std::vector<uint32_t>& order,
+    std::vector<size_t>& cluster_starts
+) {
+    const size_t triangle_count = indices.size() / 3;
+    const size_t order_base = order.size();
+
+    // Vertex -> triangle adjacency (CSR)
+    std::vector<uint32_t> live(vertex_count, 0);
+    for (uint32_t v : indices) ++live[v];
+
+    std::vector<uint32_t> adjacency_start(vertex_count + 1, 0);
+    for (size_t v = 0; v < vertex_count; ++v) {
+        adjacency_start[v + 1] = adjacency_start[v] + live[v];
+    }
+    std::vector<uint32_t> adjacency(indices.size());
+    {
+        std::vector<uint32_t> cursor(adjacency_start.begin(), adjacency_start.end() - 1);
+        for (size_t i = 0; i < indices.size(); ++i) {
+            adjacency[cursor[indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+    }
+
+    // A vertex is in the FIFO cache while time - cache_time[v] <= cache_size
+    std::vector<uint32_t> cache_time(vertex_count, 0);
+    std::vector<char> emitted(triangle_count, 0);
+    std::vector<uint32_t> dead_end;
+    std::vector<uint32_t> candidates;
+    dead_end.reserve(indices.size());
+
+    uint32_t time = cache_size + 1;
+    size_t scan = 0;
+    uint32_t fan = vertex_count > 0 ? indices[0] : NO_VERTEX;
+    cluster_starts.push_back(order_base);
+
+    while (fan != NO_VERTEX) {
+        // Emit every remaining triangle around the fanning vertex
+        candidates.clear();
+        for (uint32_t k = adjacency_start[fan]; k < adjacency_start[fan + 1]; ++k) {
+            uint32_t t = adjacency[k];
+            if (emitted[t]) continue;
+            emitted[t] = 1;
+            order.push_back(t);
+
+            for (int c = 0; c < 3; ++c) {
+                uint32_t v = indices[t * 3 + c];
+                dead_end.push_back(v);
+                candidates.push_back(v);
+                --live[v];
+                if (time - cache_time[v] > cache_size) cache_time[v] = time++;
+            }
+        }
+
+        // Next fan: the oldest cached neighbour that stays cached while its
+        // remaining triangles are emitted
+        uint32_t next = NO_VERTEX;
+        int64_t best_priority = -1;
+        for (uint32_t v : candidates) {
+            if (live[v] == 0) continue;
+            int64_t age = int64_t(time) - int64_t(cache_time[v]);
+            int64_t priority = (age + 2 * int64_t(live[v]) <= int64_t(cache_size)) ? age : 0;
+            if (priority > best_priority) {
+                best_priority = priority;
+                next = v;
+            }
+        }
+
+        if (next == NO_VERTEX) {
+            // Dead end: most recently referenced live vertex, else the next
+            // live vertex in input order
+            while (!dead_end.empty() && next == NO_VERTEX) {
+                uint32_t v = dead_end.back();
+                dead_end.pop_back();
+                if (live[v] > 0) next = v;
+            }
+            while (next == NO_VERTEX && scan < vertex_count) {
+                if (live[scan] > 0) next = static_cast<uint32_t>(scan);
+                ++scan;
+            }
+            if (next != NO_VERTEX && time - cache_time[next] > cache_size) {
+                cluster_starts.push_back(order.size());
+            }
+        }
+
+        fan = next;
+    }
+}
+
+/// Area-weighted centroid and normal of a run of triangles
+void accumulate_triangles(
+    const uint32_t* indices,
+    const uint32_t* order,
+    size_t count,
+    const float* positions,
+    size_t stride,
+    double centroid[3],
+    double normal[3],
+    double& area
+) {
+    for (size_t n = 0; n < count; ++n) {
+        const uint32_t* tri = indices + size_t(order[n]) * 3;
+        const float* a = positions + size_t(tri[0]) * stride;
+        const float* b = positions + size_t(tri[1]) * stride;
+        const float* c = positions + size_t(tri[2]) * stride;
+
+        double e1[3] = {double(b[0]) - a[0], double(b[1]) - a[1], double(b[2]) - a[2]};
+        double e2[3] = {double(c[0]) - a[0], double(c[1]) - a[1], double(c[2]) - a[2]};
+        double cross[3] = {
+            e1[1] * e2[2] - e1[2] * e2[1],
+            e1[2] * e2[0] - e1[0] * e2[2],
+            e1[0] * e2[1] - e1[1] * e2[0]
+        };
+        double weight = 0.5 * std::sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]);
+
+        for (int k = 0; k < 3; ++k) {
+            centroid[k] += weight * (double(a[k]) + b[k] + c[k]) / 3.0;
+            normal[k] += cross[k];
+        }
+        area += weight;
+    }
+}
+
+/// Sort clusters so that those facing away from the mesh centre come first
+/// (view-independent overdraw metric from Sander et al.)
+void sort_clusters_for_overdraw(
+    const uint32_t* indices,
+    const float* positions,
+    size_t stride,
+    std::vector<uint32_t>& order,
+    const std::vector<size_t>& cluster_starts
+) {
+    const size_t cluster_count = cluster_starts.size();
+    if (cluster_count < 2) return;
+
+    struct Cluster {
+        size_t begin, end;
+        double centroid[3];
+        double normal[3];
+        double area;
+        double metric;
+    };
+
+    std::vector<Cluster> clusters(cluster_count);
+    double mesh_centroid[3] = {0.0, 0.0, 0.0};
+    double mesh_area = 0.0;
+
+    for (size_t c = 0; c < cluster_count; ++c) {
+        Cluster& cluster = clusters[c];
+        cluster.begin = cluster_starts[c];
+        cluster.end = (c + 1 < cluster_count) ? cluster_starts[c + 1] : order.size();
+        cluster.centroid[0] = cluster.centroid[1] = cluster.centroid[2] = 0.0;
+        cluster.normal[0] = cluster.normal[1] = cluster.normal[2] = 0.0;
+        cluster.area = 0.0;
+        accumulate_triangles(indices, order.data() + cluster.begin, cluster.end - cluster.begin,
+                             positions, stride, cluster.centroid, cluster.normal, cluster.area);
+
+        for (int k = 0; k < 3; ++k) mesh_centroid[k] += cluster.centroid[k];
+        mesh_area += cluster.area;
+    }
+    if (mesh_area <= 0.0) return;
+    for (int k = 0; k < 3; ++k) mesh_centroid[k] /= mesh_area;
+
+    for (Cluster& cluster : clusters) {
+        cluster.metric = 0.0;
+        double length = std::sqrt(cluster.normal[0] * cluster.normal[0] +
+                                  cluster.normal[1] * cluster.normal[1] +
+                                  cluster.normal[2] * cluster.normal[2]);
+        if (cluster.area <= 0.0 || length <= 0.0) continue;
+        for (int k = 0; k < 3; ++k) {
+            cluster.metric += (cluster.centroid[k] / cluster.area - mesh_centroid[k]) * cluster.normal[k] / length;
+        }
+    }
+
+    std::stable_sort(clusters.begin(), clusters.end(), [](const Cluster& a, const Cluster& b) {
+        return a.metric > b.metric;
+    });
+
+    std::vector<uint32_t> sorted;
+    sorted.reserve(order.size());
+    for (const Cluster& cluster : clusters) {
+        sorted.insert(sorted.end(), order.begin() + cluster.begin, order.begin() + cluster.end);
+    }
+    order.swap(sorted);
+}
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+// Vertex Cache Optimization
+//------------------------------------------------------------------------------
+
+VertexCacheStats analyze_vertex_cache(
+    const uint32_t* indices,
+    size_t index_count,
+    size_t vertex_count,
+    uint32_t cache_size
+) {
+    VertexCacheStats stats;
+    if (index_count < 3 || vertex_count == 0) return stats;
+
+    std::vector<uint32_t> cache_time(vertex_count, 0);
+    std::vector<char> referenced(vertex_count, 0);
+    uint32_t time = cache_size + 1;
+    size_t misses = 0;
+    size_t unique = 0;
+
+    for (size_t i = 0; i < index_count; ++i) {
+        uint32_t v = indices[i];
+        if (v >= vertex_count) continue;
+        if (time - cache_time[v] > cache_size) {
+            cache_time[v] = time++;
+            ++misses;
+        }
+        if (!referenced[v]) {
+            referenced[v] = 1;
+            ++unique;
+        }
+    }
+
+    stats.acmr = double(misses) / double(index_count / 3);
+    stats.atvr = unique > 0 ? double(misses) / double(unique) : 0.0;
+    return stats;
+}
+
+std::vector<uint32_t> optimize_triangle_order(
+    const uint32_t* indices,
+    size_t triangle_count,
+    size_t vertex_count,
+    const uint32_t* triangle_groups,
+    const float* positions,
+    size_t position_stride,
+    const RenderOptimizeOptions& options
+) {
+    const uint32_t cache_size = std::max<uint32_t>(options.cache_size, 3);
+
+    // Triangle groups in order of first appearance (a single group if none)
+    std::vector<uint32_t> group_of(triangle_count, 0);
+    size_t group_count = triangle_count > 0 ? 1 : 0;
+    if (triangle_groups && options.group_by_face) {
+        std::unordered_map<uint32_t, uint32_t> group_index;
+        for (size_t t = 0; t < triangle_count; ++t) {
+            auto inserted = group_index.emplace(triangle_groups[t], static_cast<uint32_t>(group_index.size()));
+            group_of[t] = inserted.first->second;
+        }
+        group_count = group_index.size();
+    }
+
+    std::vector<uint32_t> group_start(group_count + 1, 0);
+    for (uint32_t g : group_of) ++group_start[g + 1];
+    for (size_t g = 0; g < group_count; ++g) group_start[g + 1] += group_start[g];
+    std::vector<uint32_t> grouped(triangle_count);
+    {
+        std::vector<uint32_t> cursor(group_start.begin(), group_start.end() - 1);
+        for (size_t t = 0; t < triangle_count; ++t) {
+            grouped[cursor[group_of[t]]++] = static_cast<uint32_t>(t);
+        }
+    }
+
+    // Tipsify each group on dense local vertex ids
+    std::vector<uint32_t> order;
+    order.reserve(triangle_count);
+    std::vector<size_t> cluster_starts;
+    std::vector<size_t> group_starts;
+    std::vector<uint32_t> local_of(vertex_count, NO_VERTEX);
+    std::vector<uint32_t> local_to_global;
+    std::vector<uint32_t> local_indices;
+    std::vector<uint32_t> local_order;
+    std::vector<size_t> local_clusters;
+
+    for (size_t g = 0; g < group_count; ++g) {
+        local_to_global.clear();
+        local_indices.clear();
+        for (uint32_t k = group_start[g]; k < group_start[g + 1]; ++k) {
+            const uint32_t* tri = indices + size_t(grouped[k]) * 3;
+            for (int c = 0; c < 3; ++c) {
+                uint32_t v = tri[c];
+                if (local_of[v] == NO_VERTEX) {
+                    local_of[v] = static_cast<uint32_t>(local_to_global.size());
+                    local_to_global.push_back(v);
+                }
+                local_indices.push_back(local_of[v]);
+            }
+        }
+
+        local_order.clear();
+        local_clusters.clear();
+        tipsify(local_indices, local_to_global.size(), cache_size, local_order, local_clusters);
+
+        group_starts.push_back(order.size());
+        for (size_t start : local_clusters) cluster_starts.push_back(order.size() + start);
+        for (uint32_t t : local_order) order.push_back(grouped[group_start[g] + t]);
+
+        for (uint32_t v : local_to_global) local_of[v] = NO_VERTEX;
+    }
+
+    // Faces stay contiguous when grouping; otherwise Tipsify's cold restarts
+    // delimit the clusters
+    if (options.reduce_overdraw && positions) {
+        const bool grouping = triangle_groups && options.group_by_face;
+        sort_clusters_for_overdraw(indices, positions, position_stride, order,
+                                   grouping ? group_starts : cluster_starts);
+    }
+
+    return order;
+}
+
+std::vector<uint32_t> optimize_vertex_fetch(
+    const uint32_t* indices,
+    size_t index_count,
+    size_t vertex_count
+) {
+    std::vector<uint32_t> remap(vertex_count, NO_VERTEX);
+    uint32_t next = 0;
+    for (size_t i = 0; i < index_count; ++i) {
+        uint32_t& target = remap[indices[i]];
+        if (target == NO_VERTEX) target = next++;
+    }
+    for (uint32_t& target : remap) {
+        if (target == NO_VERTEX) target = next++;
+    }
+    return remap;
+}
+
+RenderOptimizeReport optimize_mesh_buffers(
+    float* vertex_data,
+    size_t vertex_stride,
+    size_t vertex_count,
+    uint32_t* indices,
+    size_t triangle_count,
+    uint32_t* triangle_groups,
+    const RenderOptimizeOptions& options
+) {
+    RenderOptimizeReport report;
+    const size_t index_count = triangle_count * 3;
+    report.before = analyze_vertex_cache(indices, index_count, vertex_count, options.cache_size);
+    report.after = report.before;
+
+    for (size_t i = 0; i < index_count; ++i) {
+        if (indices[i] >= vertex_count) return report;
+    }
+    if (triangle_count == 0) return report;
+
+    // Triangles (and their group ids)
+    std::vector<uint32_t> order = optimize_triangle_order(
+        indices, triangle_count, vertex_count, triangle_groups,
+        vertex_stride >= 3 ? vertex_data : nullptr, vertex_stride, options);
+
+    std::vector<uint32_t> reordered(index_count);
+    for (size_t t = 0; t < triangle_count; ++t) {
+        std::copy_n(indices + size_t(order[t]) * 3, 3, reordered.begin() + t * 3);
+    }
+    std::copy(reordered.begin(), reordered.end(), indices);
+
+    if (triangle_groups) {
+        std::vector<uint32_t> groups(triangle_count);
+        for (size_t t = 0; t < triangle_count; ++t) groups[t] = triangle_groups[order[t]];
+        std::copy(groups.begin(), groups.end(), triangle_groups);
+    }
+
+    // Vertices
+    std::vector<uint32_t> remap = optimize_vertex_fetch(indices, index_count, vertex_count);
+    for (size_t i = 0; i < index_count; ++i) indices[i] = remap[indices[i]];
+
+    if (vertex_data && vertex_stride > 0) {
+        std::vector<float> source(vertex_data, vertex_data + vertex_count * vertex_stride);
+        for (size_t v = 0; v < vertex_count; ++v) {
+            std::copy_n(source.begin() + v * vertex_stride, vertex_stride,
+                        vertex_data + size_t(remap[v]) * vertex_stride);
+        }
+    }
+
+    report.after = analyze_vertex_cache(indices, index_count, vertex_count, options.cache_size);
+    return report;
+}
+
+} // namespace cadhy::mesh
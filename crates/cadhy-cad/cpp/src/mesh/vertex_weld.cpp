@@ -0,0 +1,412 @@
+/**
+ * @file vertex_weld.cpp
+ * @brief Implementation of the tolerance-based vertex welding engine
+ */
+
+#include <cadhy/mesh/vertex_weld.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+namespace cadhy::mesh {
+
+//------------------------------------------------------------------------------
+// Helper Functions
+//------------------------------------------------------------------------------
+
+namespace {
+
+constexpr uint32_t AXIS_BITS = 21;
+constexpr uint64_t AXIS_MASK = (uint64_t(1) << AXIS_BITS) - 1;
+constexpr uint32_t NO_VERTEX = std::numeric_limits<uint32_t>::max();
+
+/// Quantisation grid: cells are at least 4x the tolerance, and coarse enough
+/// that every axis index fits in 21 bits (3 axes packed into one 64-bit key)
+struct WeldGrid {
+    double origin[3] = {0.0, 0.0, 0.0};
+    double inv_cell = 1.0;
+    double boundary = 0.0;  // Tolerance in cell units (neighbour probe margin)
+    double tol2 = 0.0;
+};
+
+WeldGrid make_grid(const float* positions, size_t vertex_count, double tolerance) {
+    WeldGrid grid;
+    float lo[3] = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+    float hi[3] = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+    for (size_t i = 0; i < vertex_count; ++i) {
+        for (int a = 0; a < 3; ++a) {
+            float v = positions[i * 3 + a];
+            lo[a] = std::min(lo[a], v);
+            hi[a] = std::max(hi[a], v);
+        }
+    }
+
+    double extent = 0.0;
+    for (int a = 0; a < 3; ++a) {
+        grid.origin[a] = vertex_count > 0 ? lo[a] : 0.0;
+        extent = std::max(extent, vertex_count > 0 ? double(hi[a]) - double(lo[a]) : 0.0);
+    }
+
+    tolerance = std::max(tolerance, 0.0);
+    double cell = std::max(tolerance * 4.0, extent / double(AXIS_MASK - 1));
+    if (cell <= 0.0) cell = 1.0;
+
+    grid.inv_cell = 1.0 / cell;
+    grid.boundary = tolerance * grid.inv_cell + 1e-9;
+    grid.tol2 = tolerance * tolerance;
+    return grid;
+}
+
+/// Cell coordinates (as doubles, for the boundary test) of vertex i
+inline void cell_coords(const WeldGrid& grid, const float* positions, size_t i, double f[3]) {
+    f[0] = (double(positions[i * 3]) - grid.origin[0]) * grid.inv_cell;
+    f[1] = (double(positions[i * 3 + 1]) - grid.origin[1]) * grid.inv_cell;
+    f[2] = (double(positions[i * 3 + 2]) - grid.origin[2]) * grid.inv_cell;
+}
+
+inline uint64_t pack_key(uint64_t qx, uint64_t qy, uint64_t qz) {
+    return qx | (qy << AXIS_BITS) | (qz << (2 * AXIS_BITS));
+}
+
+/// Quantise all vertices into packed cell keys. Branch-free and contiguous so
+/// the compiler vectorises it.
+void quantise_range(const WeldGrid& grid, const float* positions, size_t begin, size_t end, uint64_t* keys) {
+    const double ox = grid.origin[0], oy = grid.origin[1], oz = grid.origin[2];
+    const double inv = grid.inv_cell;
+    for (size_t i = begin; i < end; ++i) {
+        uint64_t qx = static_cast<uint64_t>((double(positions[i * 3]) - ox) * inv);
+        uint64_t qy = static_cast<uint64_t>((double(positions[i * 3 + 1]) - oy) * inv);
+        uint64_t qz = static_cast<uint64_t>((double(positions[i * 3 + 2]) - oz) * inv);
+        keys[i] = qx | (qy << AXIS_BITS) | (qz << (2 * AXIS_BITS));
+    }
+}
+
+inline double distance2(const float* positions, size_t a, size_t b) {
+    double dx = double(positions[a * 3]) - double(positions[b * 3]);
+    double dy = double(positions[a * 3 + 1]) - double(positions[b * 3 + 1]);
+    double dz = double(positions[a * 3 + 2]) - double(positions[b * 3 + 2]);
+    return dx * dx + dy * dy + dz * dz;
+}
+
+/// Keys of the cells within tolerance of vertex i (own cell first)
+size_t neighbour_keys(const WeldGrid& grid, const float* positions, size_t i, uint64_t out[27]) {
+    double f[3];
+    cell_coords(grid, positions, i, f);
+
+    int64_t q[3];
+    int lo[3], hi[3];
+    for (int a = 0; a < 3; ++a) {
+        q[a] = static_cast<int64_t>(f[a]);
+        double frac = f[a] - double(q[a]);
+        lo[a] = (frac < grid.boundary && q[a] > 0) ? -1 : 0;
+        hi[a] = (frac > 1.0 - grid.boundary && uint64_t(q[a]) < AXIS_MASK) ? 1 : 0;
+    }
+
+    size_t count = 0;
+    out[count++] = pack_key(q[0], q[1], q[2]);
+    for (int dz = lo[2]; dz <= hi[2]; ++dz) {
+        for (int dy = lo[1]; dy <= hi[1]; ++dy) {
+            for (int dx = lo[0]; dx <= hi[0]; ++dx) {
+                if (dx == 0 && dy == 0 && dz == 0) continue;
+                out[count++] = pack_key(q[0] + dx, q[1] + dy, q[2] + dz);
+            }
+        }
+    }
+    return count;
+}
+
+inline uint64_t hash_key(uint64_t key) {
+    // splitmix64 finaliser
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return key;
+}
+
+/// Open-addressing (linear probing) map from cell key to the head of that
+/// cell's representative chain
+class CellTable {
+public:
+    explicit CellTable(size_t expected) {
+        size_t capacity = 16;
+        while (capacity < expected + expected / 3) capacity <<= 1;
+        mask_ = capacity - 1;
+        keys_.assign(capacity, EMPTY);
+        heads_.assign(capacity, NO_VERTEX);
+    }
+
+    uint32_t find(uint64_t key) const {
+        for (size_t slot = hash_key(key) & mask_;; slot = (slot + 1) & mask_) {
+            if (keys_[slot] == key) return heads_[slot];
+            if (keys_[slot] == EMPTY) return NO_VERTEX;
+        }
+    }
+
+    /// Slot for `key`, inserting it if missing
+    uint32_t& head(uint64_t key) {
+        size_t slot = hash_key(key) & mask_;
+        while (keys_[slot] != key && keys_[slot] != EMPTY) {
+            slot = (slot + 1) & mask_;
+        }
+        keys_[slot] = key;
+        return heads_[slot];
+    }
+
+private:
+    static constexpr uint64_t EMPTY = ~uint64_t(0);  // Packed keys use 63 bits
+
+    size_t mask_ = 0;
+    std::vector<uint64_t> keys_;
+    std::vector<uint32_t> heads_;
+};
+
+/// Split [0, count) into one contiguous chunk per worker thread
+template <typename Fn>
+void parallel_chunks(size_t count, size_t min_chunk, Fn&& fn) {
+    size_t workers = std::max<size_t>(1, std::thread::hardware_concurrency());
+    workers = std::min(workers, std::max<size_t>(1, count / std::max<size_t>(1, min_chunk)));
+
+    if (workers == 1) {
+        fn(size_t(0), count, size_t(0));
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    size_t chunk = (count + workers - 1) / workers;
+    for (size_t t = 1; t < workers; ++t) {
+        size_t begin = std::min(count, t * chunk);
+        size_t end = std::min(count, begin + chunk);
+        threads.emplace_back([&fn, begin, end, t]() { fn(begin, end, t); });
+    }
+    fn(0, std::min(count, chunk), 0);
+    for (auto& thread : threads) thread.join();
+}
+
+/// Stable parallel LSD radix sort of (key, index) pairs, 8 bits per pass.
+/// Passes whose digit is constant across all keys are skipped.
+void radix_sort_pairs(std::vector<uint64_t>& keys, std::vector<uint32_t>& index) {
+    const size_t count = keys.size();
+    std::vector<uint64_t> key_tmp(count);
+    std::vector<uint32_t> index_tmp(count);
+
+    size_t workers = std::max<size_t>(1, std::thread::hardware_concurrency());
+    workers = std::min(workers, std::max<size_t>(1, count / 65536));
+    const size_t chunk = (count + workers - 1) / workers;
+
+    for (uint32_t shift = 0; shift < 3 * AXIS_BITS; shift += 8) {
+        std::vector<std::array<size_t, 256>> histogram(workers);
+        parallel_chunks(workers, 1, [&](size_t wb, size_t we, size_t) {
+            for (size_t w = wb; w < we; ++w) {
+                histogram[w].fill(0);
+                size_t end = std::min(count, (w + 1) * chunk);
+                for (size_t i = w * chunk; i < end; ++i) {
+                    ++histogram[w][(keys[i] >> shift) & 0xFF];
+                }
+            }
+        });
+
+        // Skip passes where every key has the same digit
+        bool trivial = false;
+        for (size_t d = 0; d < 256 && !trivial; ++d) {
+            size_t total = 0;
+            for (size_t w = 0; w < workers; ++w) total += histogram[w][d];
+            trivial = (total == count);
+        }
+        if (trivial) continue;
+
+        // Digit-major, worker-minor offsets keep the sort stable
+        size_t running = 0;
+        for (size_t d = 0; d < 256; ++d) {
+            for (size_t w = 0; w < workers; ++w) {
+                size_t n = histogram[w][d];
+                histogram[w][d] = running;
+                running += n;
+            }
+        }
+
+        parallel_chunks(workers, 1, [&](size_t wb, size_t we, size_t) {
+            for (size_t w = wb; w < we; ++w) {
+                auto& offsets = histogram[w];
+                size_t end = std::min(count, (w + 1) * chunk);
+                for (size_t i = w * chunk; i < end; ++i) {
+                    size_t pos = offsets[(keys[i] >> shift) & 0xFF]++;
+                    key_tmp[pos] = keys[i];
+                    index_tmp[pos] = index[i];
+                }
+            }
+        });
+
+        keys.swap(key_tmp);
+        index.swap(index_tmp);
+    }
+}
+
+/// Assign output ids in representative order; rep[i] <= i for every vertex
+WeldMap finish_weld(const std::vector<uint32_t>& rep) {
+    WeldMap result;
+    result.remap.resize(rep.size());
+    for (size_t i = 0; i < rep.size(); ++i) {
+        if (rep[i] == i) {
+            result.remap[i] = static_cast<uint32_t>(result.unique.size());
+            result.unique.push_back(static_cast<uint32_t>(i));
+        } else {
+            result.remap[i] = result.remap[rep[i]];
+        }
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+// Vertex Welding
+//------------------------------------------------------------------------------
+
+WeldMap weld_positions(
+    const float* positions,
+    size_t vertex_count,
+    double tolerance
+) {
+    if (vertex_count >= WELD_SORT_THRESHOLD) {
+        return weld_positions_sorted(positions, vertex_count, tolerance);
+    }
+    return weld_positions_hashed(positions, vertex_count, tolerance);
+}
+
+WeldMap weld_positions_hashed(
+    const float* positions,
+    size_t vertex_count,
+    double tolerance
+) {
+    WeldGrid grid = make_grid(positions, vertex_count, tolerance);
+
+    CellTable table(vertex_count);
+    std::vector<uint32_t> rep(vertex_count);
+    std::vector<uint32_t> next_rep(vertex_count, NO_VERTEX);  // Chain within a cell
+
+    uint64_t cells[27];
+    for (size_t i = 0; i < vertex_count; ++i) {
+        size_t cell_count = neighbour_keys(grid, positions, i, cells);
+
+        uint32_t best = NO_VERTEX;
+        for (size_t c = 0; c < cell_count; ++c) {
+            for (uint32_t r = table.find(cells[c]); r != NO_VERTEX; r = next_rep[r]) {
+                if (r < best && distance2(positions, i, r) <= grid.tol2) best = r;
+            }
+        }
+
+        if (best == NO_VERTEX) {
+            uint32_t& head = table.head(cells[0]);
+            next_rep[i] = head;
+            head = static_cast<uint32_t>(i);
+            rep[i] = static_cast<uint32_t>(i);
+        } else {
+            rep[i] = best;
+        }
+    }
+
+    return finish_weld(rep);
+}
+
+WeldMap weld_positions_sorted(
+    const float* positions,
+    size_t vertex_count,
+    double tolerance
+) {
+    WeldGrid grid = make_grid(positions, vertex_count, tolerance);
+
+    // Quantise and sort vertex indices by cell
+    std::vector<uint64_t> keys(vertex_count);
+    parallel_chunks(vertex_count, 65536, [&](size_t begin, size_t end, size_t) {
+        quantise_range(grid, positions, begin, end, keys.data());
+    });
+
+    std::vector<uint64_t> sorted_keys = keys;
+    std::vector<uint32_t> order(vertex_count);
+    for (size_t i = 0; i < vertex_count; ++i) order[i] = static_cast<uint32_t>(i);
+    radix_sort_pairs(sorted_keys, order);
+
+    // Cell runs (indices within a run stay ascending: the sort is stable)
+    std::vector<uint64_t> cell_keys;
+    std::vector<size_t> cell_start;
+    for (size_t i = 0; i < vertex_count; ++i) {
+        if (i == 0 || sorted_keys[i] != sorted_keys[i - 1]) {
+            cell_keys.push_back(sorted_keys[i]);
+            cell_start.push_back(i);
+        }
+    }
+    cell_start.push_back(vertex_count);
+    sorted_keys.clear();
+    sorted_keys.shrink_to_fit();
+
+    // Candidate lists, in sorted order: for every vertex, the lower-index
+    // vertices within tolerance. The own cell is the current run; neighbour
+    // cells are looked up only for vertices near a cell boundary.
+    size_t workers = std::max<size_t>(1, std::thread::hardware_concurrency());
+    workers = std::min(workers, std::max<size_t>(1, cell_keys.size() / 4096));
+    std::vector<std::vector<uint32_t>> local_candidates(workers);
+    std::vector<uint32_t> candidate_end(vertex_count);    // Per sorted slot, within its worker's list
+    std::vector<uint32_t> slot_worker(vertex_count);
+
+    parallel_chunks(cell_keys.size(), 4096, [&](size_t cell_begin, size_t cell_end, size_t worker) {
+        std::vector<uint32_t>& out = local_candidates[worker];
+        uint64_t cells[27];
+        for (size_t cell = cell_begin; cell < cell_end; ++cell) {
+            for (size_t k = cell_start[cell]; k < cell_start[cell + 1]; ++k) {
+                const uint32_t i = order[k];
+
+                // Own cell: indices ascend within the run (the sort is stable)
+                for (size_t m = cell_start[cell]; m < k; ++m) {
+                    uint32_t j = order[m];
+                    if (distance2(positions, i, j) <= grid.tol2) out.push_back(j);
+                }
+
+                size_t cell_count = neighbour_keys(grid, positions, i, cells);
+                for (size_t c = 1; c < cell_count; ++c) {
+                    auto it = std::lower_bound(cell_keys.begin(), cell_keys.end(), cells[c]);
+                    if (it == cell_keys.end() || *it != cells[c]) continue;
+                    size_t other = static_cast<size_t>(it - cell_keys.begin());
+                    for (size_t m = cell_start[other]; m < cell_start[other + 1]; ++m) {
+                        uint32_t j = order[m];
+                        if (j >= i) break;
+                        if (distance2(positions, i, j) <= grid.tol2) out.push_back(j);
+                    }
+                }
+
+                candidate_end[k] = static_cast<uint32_t>(out.size());
+                slot_worker[k] = static_cast<uint32_t>(worker);
+            }
+        }
+    });
+
+    // Sorted slot of each vertex
+    std::vector<uint32_t> slot(vertex_count);
+    for (size_t k = 0; k < vertex_count; ++k) slot[order[k]] = static_cast<uint32_t>(k);
+
+    // Greedy pass in vertex order: join the lowest-index representative
+    // among the candidates (same rule as the hash path)
+    std::vector<uint32_t> rep(vertex_count);
+    for (size_t i = 0; i < vertex_count; ++i) {
+        const size_t k = slot[i];
+        const std::vector<uint32_t>& list = local_candidates[slot_worker[k]];
+        const bool run_start = (k == 0 || slot_worker[k - 1] != slot_worker[k]);
+        const size_t begin = run_start ? 0 : candidate_end[k - 1];
+
+        uint32_t best = NO_VERTEX;
+        for (size_t n = begin; n < candidate_end[k]; ++n) {
+            uint32_t j = list[n];
+            if (rep[j] == j && j < best) best = j;
+        }
+        rep[i] = (best == NO_VERTEX) ? static_cast<uint32_t>(i) : best;
+    }
+
+    return finish_weld(rep);
+}
+
+} // namespace cadhy::mesh
@@ -16,6 +16,7 @@
 #include <BRepPrimAPI_MakePrism.hxx>
 #include <BRepBuilderAPI_MakeSolid.hxx>
 #include <BRepBuilderAPI_Sewing.hxx>
+#include <BRepTools_History.hxx>
 #include <ShapeUpgrade_UnifySameDomain.hxx>
 #include <ShapeFix_Shape.hxx>
 #include <TopExp.hxx>
@@ -70,6 +71,19 @@ inline const TopoDS_Shape& get_shape(const OcctShape& s) {
     return s.get();
 }
 
+/// Wrap a maker's result; faces it left untouched keep the source's
+/// cached triangulations, so re-meshing only touches new or modified faces
+template<typename Maker>
+std::unique_ptr<OcctShape> make_result(const OcctShape& source, Maker& maker) {
+    TopTools_ListOfShape arguments;
+    arguments.Append(get_shape(source));
+    Handle(BRepTools_History) history = new BRepTools_History(arguments, maker);
+
+    auto result = std::make_unique<OcctShape>(maker.Shape());
+    result->mesh_cache().inherit(get_shape(source), source.mesh_cache(), history);
+    return result;
+}
+
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -92,7 +106,7 @@ std::unique_ptr<OcctShape> fillet_all_edges(
     try {
         maker.Build();
         if (maker.IsDone()) {
-            return std::make_unique<OcctShape>(maker.Shape());
+            return make_result(shape, maker);
         }
     } catch (...) {
     }
@@ -120,7 +134,7 @@ std::unique_ptr<OcctShape> fillet_edges(
     try {
         maker.Build();
         if (maker.IsDone()) {
-            return std::make_unique<OcctShape>(maker.Shape());
+            return make_result(shape, maker);
         }
     } catch (...) {
     }
@@ -151,7 +165,7 @@ std::unique_ptr<OcctShape> fillet_edges_varied(
     try {
         maker.Build();
         if (maker.IsDone()) {
-            return std::make_unique<OcctShape>(maker.Shape());
+            return make_result(shape, maker);
         }
     } catch (...) {
     }
@@ -184,7 +198,7 @@ std::unique_ptr<OcctShape> fillet_variable(
     try {
         maker.Build();
         if (maker.IsDone()) {
-            return std::make_unique<OcctShape>(maker.Shape());
+            return make_result(shape, maker);
         }
     } catch (...) {
     }
@@ -215,7 +229,7 @@ std::unique_ptr<OcctShape> fillet_advanced(
     try {
         maker.Build();
         if (maker.IsDone()) {
-            return std::make_unique<OcctShape>(maker.Shape());
+            return make_result(shape, maker);
         }
     } catch (...) {
     }
@@ -250,7 +264,7 @@ std::unique_ptr<OcctShape> chamfer_all_edges(
     try {
         maker.Build();
         if (maker.IsDone()) {
-            return std::make_unique<OcctShape>(maker.Shape());
+            return make_result(shape, maker);
         }
     } catch (...) {
     }
@@ -287,7 +301,7 @@ std::unique_ptr<OcctShape> chamfer_edges(
     try {
         maker.Build();
         if (maker.IsDone()) {
-            return std::make_unique<OcctShape>(maker.Shape());
+            return make_result(shape, maker);
         }
     } catch (...) {
     }
@@ -324,7 +338,7 @@ std::unique_ptr<OcctShape> chamfer_edges_asymmetric(
     try {
         maker.Build();
         if (maker.IsDone()) {
-            return std::make_unique<OcctShape>(maker.Shape());
+            return make_result(shape, maker);
         }
     } catch (...) {
     }
@@ -361,7 +375,7 @@ std::unique_ptr<OcctShape> chamfer_edges_angle(
     try {
         maker.Build();
         if (maker.IsDone()) {
-            return std::make_unique<OcctShape>(maker.Shape());
+            return make_result(shape, maker);
         }
     } catch (...) {
     }
@@ -533,7 +547,7 @@ std::unique_ptr<OcctShape> draft_faces(
     try {
         maker.Build();
         if (maker.IsDone()) {
-            return std::make_unique<OcctShape>(maker.Shape());
+            return make_result(shape, maker);
         }
     } catch (...) {
     }
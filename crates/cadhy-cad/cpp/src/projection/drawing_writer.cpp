@@ -0,0 +1,701 @@
+/**
+ * @file drawing_writer.cpp
+ * @brief Implementation of the streaming SVG/DXF writer
+ */
+
+#include <cadhy/projection/drawing_writer.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace cadhy::projection {
+
+//------------------------------------------------------------------------------
+// Helper Functions
+//------------------------------------------------------------------------------
+
+namespace {
+
+constexpr double TWO_PI = 2.0 * M_PI;
+constexpr double RAD_TO_DEG = 180.0 / M_PI;
+
+// Fixed DXF R2000 handles of the document structure; records and entities
+// are numbered from 0x100 upwards
+constexpr uint64_t VPORT_TABLE = 0x1;
+constexpr uint64_t LTYPE_TABLE = 0x2;
+constexpr uint64_t LAYER_TABLE = 0x3;
+constexpr uint64_t STYLE_TABLE = 0x4;
+constexpr uint64_t VIEW_TABLE = 0x5;
+constexpr uint64_t UCS_TABLE = 0x6;
+constexpr uint64_t APPID_TABLE = 0x7;
+constexpr uint64_t DIMSTYLE_TABLE = 0x8;
+constexpr uint64_t BLOCK_RECORD_TABLE = 0x9;
+constexpr uint64_t ROOT_DICTIONARY = 0xC;
+constexpr uint64_t GROUP_DICTIONARY = 0xD;
+constexpr uint64_t MODEL_SPACE_RECORD = 0x10;
+constexpr uint64_t PAPER_SPACE_RECORD = 0x11;
+constexpr uint64_t MODEL_SPACE_BLOCK = 0x12;
+constexpr uint64_t MODEL_SPACE_ENDBLK = 0x13;
+constexpr uint64_t PAPER_SPACE_BLOCK = 0x14;
+constexpr uint64_t PAPER_SPACE_ENDBLK = 0x15;
+
+// Entities are streamed after the header, so the next free handle is not
+// known when $HANDSEED is written; any seed above the last handle is valid
+constexpr uint64_t HANDLE_SEED = 0x7FFFFFFF;
+
+/// Swept angle from `start` to `end` in the given direction, in (0, 2*pi];
+/// coincident ends mean a full turn
+double sweep_angle(double start, double end, bool ccw) {
+    double span = std::fmod(ccw ? end - start : start - end, TWO_PI);
+    if (span < 0.0) span += TWO_PI;
+    return span < 1e-12 ? TWO_PI : span;
+}
+
+/// Angle in degrees, normalised to [0, 360)
+double degrees(double radians) {
+    double deg = std::fmod(radians * RAD_TO_DEG, 360.0);
+    return deg < 0.0 ? deg + 360.0 : deg;
+}
+
+const char* layer_name(DrawingLayer layer) {
+    switch (layer) {
+        case DrawingLayer::Hidden: return "HIDDEN";
+        case DrawingLayer::Center: return "CENTER";
+        default: return "VISIBLE";
+    }
+}
+
+const char* svg_class(DrawingLayer layer) {
+    switch (layer) {
+        case DrawingLayer::Hidden: return "hidden";
+        case DrawingLayer::Center: return "center";
+        default: return "visible";
+    }
+}
+
+/// Point on an ellipse at parameter t
+void ellipse_point(double cx, double cy, double a, double b, double rotation, double t,
+                   double& x, double& y) {
+    const double c = std::cos(rotation), s = std::sin(rotation);
+    const double u = a * std::cos(t), v = b * std::sin(t);
+    x = cx + u * c - v * s;
+    y = cy + u * s + v * c;
+}
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+// Sinks
+//------------------------------------------------------------------------------
+
+DrawingSink fd_sink(int fd) {
+    return [fd](const char* data, size_t size) {
+        while (size > 0) {
+#ifdef _WIN32
+            const int chunk = static_cast<int>(std::min<size_t>(size, 1u << 30));
+            const int written = ::_write(fd, data, chunk);
+#else
+            const ssize_t written = ::write(fd, data, size);
+#endif
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            data += written;
+            size -= static_cast<size_t>(written);
+        }
+        return true;
+    };
+}
+
+//------------------------------------------------------------------------------
+// Output Primitives
+//------------------------------------------------------------------------------
+
+DrawingWriter::DrawingWriter(DrawingSink sink, const DrawingWriterOptions& options)
+    : sink_(std::move(sink)), options_(options) {
+    options_.buffer_size = std::max<size_t>(options_.buffer_size, 256);
+    options_.precision = std::clamp(options_.precision, 0, 17);
+    buffer_.reserve(options_.buffer_size + 128);
+}
+
+void DrawingWriter::flush() {
+    if (buffer_.empty()) return;
+    if (ok_) {
+        ok_ = sink_(buffer_.data(), buffer_.size());
+        if (ok_) bytes_written_ += buffer_.size();
+    }
+    buffer_.clear();
+}
+
+void DrawingWriter::put(const char* text, size_t size) {
+    buffer_.append(text, size);
+    if (buffer_.size() >= options_.buffer_size) flush();
+}
+
+void DrawingWriter::put(const char* text) {
+    put(text, std::strlen(text));
+}
+
+void DrawingWriter::put_number(double value, bool coordinate) {
+    if (!std::isfinite(value)) value = 0.0;
+
+    char text[64];
+    if (!coordinate) {
+        // Angles and ratios: shortest exact form, never quantised
+        auto end = std::to_chars(text, text + sizeof(text), value).ptr;
+        put(text, static_cast<size_t>(end - text));
+        return;
+    }
+    if (options_.quantum > 0.0) {
+        value = std::round(value / options_.quantum) * options_.quantum;
+    }
+
+    auto [end, error] = std::to_chars(text, text + sizeof(text), value,
+                                      std::chars_format::fixed, options_.precision);
+    if (error != std::errc()) {
+        // Too long for fixed notation; fall back to the shortest form
+        end = std::to_chars(text, text + sizeof(text), value).ptr;
+    } else if (options_.precision > 0) {
+        while (end[-1] == '0') --end;
+        if (end[-1] == '.') --end;
+    }
+    if (end - text == 2 && text[0] == '-' && text[1] == '0') {
+        text[0] = '0';
+        end = text + 1;
+    }
+    put(text, static_cast<size_t>(end - text));
+}
+
+void DrawingWriter::put_integer(int64_t value) {
+    char text[24];
+    auto end = std::to_chars(text, text + sizeof(text), value).ptr;
+    put(text, static_cast<size_t>(end - text));
+}
+
+void DrawingWriter::put_handle() {
+    dxf_handle(5, next_handle_++);
+}
+
+void DrawingWriter::dxf_handle(int code, uint64_t handle) {
+    char text[24];
+    auto end = std::to_chars(text, text + sizeof(text), handle, 16).ptr;
+    std::transform(text, end, text, [](char c) { return c >= 'a' ? char(c - 'a' + 'A') : c; });
+    dxf_code(code);
+    put(text, static_cast<size_t>(end - text));
+    put("\n");
+}
+
+void DrawingWriter::dxf_code(int code) {
+    put_integer(code);
+    put("\n");
+}
+
+void DrawingWriter::dxf_number(int code, double value, bool coordinate) {
+    dxf_code(code);
+    put_number(value, coordinate);
+    put("\n");
+}
+
+void DrawingWriter::dxf_layer(DrawingLayer layer) {
+    put("8\n");
+    put(layer_name(layer));
+    put("\n");
+}
+
+void DrawingWriter::dxf_entity(const char* type, DrawingLayer layer, const char* subclass) {
+    const bool r2000 = options_.format == DrawingFormat::DxfR2000;
+    put("0\n");
+    put(type);
+    put("\n");
+    if (r2000) {
+        put_handle();
+        dxf_handle(330, MODEL_SPACE_RECORD);
+        put("100\nAcDbEntity\n");
+    }
+    dxf_layer(layer);
+    if (r2000 && subclass) {
+        put("100\n");
+        put(subclass);
+        put("\n");
+    }
+}
+
+void DrawingWriter::svg_open_path(DrawingLayer layer) {
+    put("<path class=\"");
+    put(svg_class(layer));
+    put("\" d=\"");
+}
+
+void DrawingWriter::svg_point(char command, double x, double y) {
+    if (command) {
+        const char text[2] = {command, ' '};
+        put(text, 2);
+    }
+    put_number(x);
+    put(" ");
+    put_number(-y);  // SVG y points down
+    put(" ");
+}
+
+//------------------------------------------------------------------------------
+// Document
+//------------------------------------------------------------------------------
+
+void DrawingWriter::begin(double min_x, double min_y, double max_x, double max_y) {
+    if (options_.format == DrawingFormat::Svg) {
+        put("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+            "<svg xmlns=\"http://www.w3.org/2000/svg\" viewBox=\"");
+        put_number(min_x);
+        put(" ");
+        put_number(-max_y);
+        put(" ");
+        put_number(max_x - min_x);
+        put(" ");
+        put_number(max_y - min_y);
+        put("\">\n<style>path,circle{fill:none;stroke:#000;stroke-linecap:round}"
+            ".visible{stroke-width:0.5}"
+            ".hidden{stroke-width:0.25;stroke-dasharray:4,2}"
+            ".center{stroke-width:0.18;stroke-dasharray:6,2,1,2}</style>\n");
+        return;
+    }
+
+    const bool r2000 = options_.format == DrawingFormat::DxfR2000;
+
+    put("0\nSECTION\n2\nHEADER\n9\n$ACADVER\n1\n");
+    put(r2000 ? "AC1015\n" : "AC1009\n");
+    if (r2000) {
+        put("9\n$HANDSEED\n");
+        dxf_handle(5, HANDLE_SEED);
+    }
+    put("9\n$EXTMIN\n");
+    dxf_number(10, min_x);
+    dxf_number(20, min_y);
+    dxf_number(30, 0.0);
+    put("9\n$EXTMAX\n");
+    dxf_number(10, max_x);
+    dxf_number(20, max_y);
+    dxf_number(30, 0.0);
+    put("0\nENDSEC\n");
+    if (r2000) put("0\nSECTION\n2\nCLASSES\n0\nENDSEC\n");
+
+    // Line types and layers; R2000 also needs the ByBlock/ByLayer line
+    // types and layer 0
+    struct LineTypeDef {
+        const char* name;
+        const char* description;
+        int dash_count;
+        double pattern[4];
+    };
+    static const LineTypeDef LINE_TYPES[] = {
+        {"ByBlock", "", 0, {0, 0, 0, 0}},
+        {"ByLayer", "", 0, {0, 0, 0, 0}},
+        {"CONTINUOUS", "Solid line", 0, {0, 0, 0, 0}},
+        {"HIDDEN", "Hidden __ __ __", 2, {4.0, -2.0, 0, 0}},
+        {"CENTER", "Center ____ _ ____", 4, {6.0, -2.0, 1.0, -2.0}},
+    };
+    struct LayerDef {
+        const char* name;
+        int color;
+        const char* line_type;
+    };
+    static const LayerDef LAYERS[] = {
+        {"0", 7, "CONTINUOUS"},
+        {layer_name(DrawingLayer::Visible), 7, "CONTINUOUS"},
+        {layer_name(DrawingLayer::Hidden), 8, "HIDDEN"},
+        {layer_name(DrawingLayer::Center), 1, "CENTER"},
+    };
+    const size_t skipped_line_types = r2000 ? 0 : 2;
+    const size_t skipped_layers = r2000 ? 0 : 1;
+
+    auto open_table = [&](const char* name, uint64_t handle, size_t count) {
+        put("0\nTABLE\n2\n");
+        put(name);
+        put("\n");
+        if (r2000) {
+            dxf_handle(5, handle);
+            put("330\n0\n100\nAcDbSymbolTable\n");
+        }
+        dxf_code(70);
+        put_integer(static_cast<int64_t>(count));
+        put("\n");
+    };
+    auto open_record = [&](const char* type, uint64_t owner, const char* subclass,
+                           const char* name, uint64_t handle = 0) {
+        put("0\n");
+        put(type);
+        put("\n");
+        if (r2000) {
+            if (handle) {
+                dxf_handle(5, handle);
+            } else {
+                put_handle();
+            }
+            dxf_handle(330, owner);
+            put("100\nAcDbSymbolTableRecord\n100\n");
+            put(subclass);
+            put("\n");
+        }
+        put("2\n");
+        put(name);
+        put("\n70\n0\n");
+    };
+
+    put("0\nSECTION\n2\nTABLES\n");
+    if (r2000) {
+        // Active viewport zoomed to the drawing extents
+        const double width = std::max(max_x - min_x, 1e-9);
+        const double height = std::max(max_y - min_y, 1e-9);
+        open_table("VPORT", VPORT_TABLE, 1);
+        open_record("VPORT", VPORT_TABLE, "AcDbViewportTableRecord", "*ACTIVE");
+        dxf_number(10, 0.0);
+        dxf_number(20, 0.0);
+        dxf_number(11, 1.0);
+        dxf_number(21, 1.0);
+        dxf_number(12, 0.5 * (min_x + max_x));
+        dxf_number(22, 0.5 * (min_y + max_y));
+        dxf_number(16, 0.0);
+        dxf_number(26, 0.0);
+        dxf_number(36, 1.0);
+        dxf_number(40, height);
+        dxf_number(41, width / height, false);
+        put("0\nENDTAB\n");
+    }
+    open_table("LTYPE", LTYPE_TABLE, std::size(LINE_TYPES) - skipped_line_types);
+    for (size_t t = skipped_line_types; t < std::size(LINE_TYPES); ++t) {
+        const auto& def = LINE_TYPES[t];
+        double length = 0.0;
+        for (int i = 0; i < def.dash_count; ++i) length += std::abs(def.pattern[i]);
+        open_record("LTYPE", LTYPE_TABLE, "AcDbLinetypeTableRecord", def.name);
+        put("3\n");
+        put(def.description);
+        put("\n72\n65\n73\n");
+        put_integer(def.dash_count);
+        put("\n");
+        dxf_number(40, length, false);
+        for (int i = 0; i < def.dash_count; ++i) {
+            dxf_number(49, def.pattern[i], false);
+            if (r2000) put("74\n0\n");
+        }
+    }
+    put("0\nENDTAB\n");
+    open_table("LAYER", LAYER_TABLE, std::size(LAYERS) - skipped_layers);
+    for (size_t l = skipped_layers; l < std::size(LAYERS); ++l) {
+        const auto& def = LAYERS[l];
+        open_record("LAYER", LAYER_TABLE, "AcDbLayerTableRecord", def.name);
+        dxf_code(62);
+        put_integer(def.color);
+        put("\n6\n");
+        put(def.line_type);
+        put("\n");
+    }
+    put("0\nENDTAB\n");
+
+    if (r2000) {
+        open_table("STYLE", STYLE_TABLE, 1);
+        open_record("STYLE", STYLE_TABLE, "AcDbTextStyleTableRecord", "Standard");
+        put("40\n0\n41\n1\n50\n0\n71\n0\n42\n2.5\n3\ntxt\n4\n\n0\nENDTAB\n");
+
+        open_table("VIEW", VIEW_TABLE, 0);
+        put("0\nENDTAB\n");
+        open_table("UCS", UCS_TABLE, 0);
+        put("0\nENDTAB\n");
+
+        open_table("APPID", APPID_TABLE, 1);
+        open_record("APPID", APPID_TABLE, "AcDbRegAppTableRecord", "ACAD");
+        put("0\nENDTAB\n");
+
+        // DIMSTYLE carries its own subclass and handle group code
+        open_table("DIMSTYLE", DIMSTYLE_TABLE, 1);
+        put("100\nAcDbDimStyleTable\n71\n0\n0\nDIMSTYLE\n");
+        dxf_handle(105, next_handle_++);
+        dxf_handle(330, DIMSTYLE_TABLE);
+        put("100\nAcDbSymbolTableRecord\n100\nAcDbDimStyleTableRecord\n"
+            "2\nStandard\n70\n0\n0\nENDTAB\n");
+
+        open_table("BLOCK_RECORD", BLOCK_RECORD_TABLE, 2);
+        open_record("BLOCK_RECORD", BLOCK_RECORD_TABLE, "AcDbBlockTableRecord",
+                    "*Model_Space", MODEL_SPACE_RECORD);
+        open_record("BLOCK_RECORD", BLOCK_RECORD_TABLE, "AcDbBlockTableRecord",
+                    "*Paper_Space", PAPER_SPACE_RECORD);
+        put("0\nENDTAB\n");
+    }
+    put("0\nENDSEC\n");
+
+    if (r2000) {
+        // Empty model and paper space block definitions
+        struct BlockDef {
+            const char* name;
+            uint64_t record;
+            uint64_t begin;
+            uint64_t end;
+            bool paper;
+        };
+        static const BlockDef BLOCKS[] = {
+            {"*Model_Space", MODEL_SPACE_RECORD, MODEL_SPACE_BLOCK, MODEL_SPACE_ENDBLK, false},
+            {"*Paper_Space", PAPER_SPACE_RECORD, PAPER_SPACE_BLOCK, PAPER_SPACE_ENDBLK, true},
+        };
+        put("0\nSECTION\n2\nBLOCKS\n");
+        for (const auto& def : BLOCKS) {
+            put("0\nBLOCK\n");
+            dxf_handle(5, def.begin);
+            dxf_handle(330, def.record);
+            put("100\nAcDbEntity\n");
+            if (def.paper) put("67\n1\n");
+            put("8\n0\n100\nAcDbBlockBegin\n2\n");
+            put(def.name);
+            put("\n70\n0\n10\n0\n20\n0\n30\n0\n3\n");
+            put(def.name);
+            put("\n1\n\n0\nENDBLK\n");
+            dxf_handle(5, def.end);
+            dxf_handle(330, def.record);
+            put("100\nAcDbEntity\n");
+            if (def.paper) put("67\n1\n");
+            put("8\n0\n100\nAcDbBlockEnd\n");
+        }
+        put("0\nENDSEC\n");
+    }
+
+    put("0\nSECTION\n2\nENTITIES\n");
+}
+
+bool DrawingWriter::finish() {
+    if (options_.format == DrawingFormat::Svg) {
+        put("</svg>\n");
+    } else {
+        put("0\nENDSEC\n");
+        if (options_.format == DrawingFormat::DxfR2000) {
+            // Root dictionary with the (empty) group dictionary
+            put("0\nSECTION\n2\nOBJECTS\n0\nDICTIONARY\n");
+            dxf_handle(5, ROOT_DICTIONARY);
+            put("330\n0\n100\nAcDbDictionary\n281\n1\n3\nACAD_GROUP\n");
+            dxf_handle(350, GROUP_DICTIONARY);
+            put("0\nDICTIONARY\n");
+            dxf_handle(5, GROUP_DICTIONARY);
+            dxf_handle(330, ROOT_DICTIONARY);
+            put("100\nAcDbDictionary\n281\n1\n0\nENDSEC\n");
+        }
+        put("0\nEOF\n");
+    }
+    flush();
+    return ok_;
+}
+
+//------------------------------------------------------------------------------
+// Entities
+//------------------------------------------------------------------------------
+
+void DrawingWriter::line(DrawingLayer layer, double x0, double y0, double x1, double y1) {
+    if (options_.format == DrawingFormat::Svg) {
+        svg_open_path(layer);
+        svg_point('M', x0, y0);
+        svg_point('L', x1, y1);
+        put("\"/>\n");
+        return;
+    }
+
+    dxf_entity("LINE", layer, "AcDbLine");
+    dxf_number(10, x0);
+    dxf_number(20, y0);
+    dxf_number(30, 0.0);
+    dxf_number(11, x1);
+    dxf_number(21, y1);
+    dxf_number(31, 0.0);
+}
+
+void DrawingWriter::circle(DrawingLayer layer, double cx, double cy, double radius) {
+    if (options_.format == DrawingFormat::Svg) {
+        put("<circle class=\"");
+        put(svg_class(layer));
+        put("\" cx=\"");
+        put_number(cx);
+        put("\" cy=\"");
+        put_number(-cy);
+        put("\" r=\"");
+        put_number(radius);
+        put("\"/>\n");
+        return;
+    }
+
+    dxf_entity("CIRCLE", layer, "AcDbCircle");
+    dxf_number(10, cx);
+    dxf_number(20, cy);
+    dxf_number(30, 0.0);
+    dxf_number(40, radius);
+}
+
+void DrawingWriter::arc(DrawingLayer layer, double cx, double cy, double radius,
+                        double start_angle, double end_angle, bool ccw) {
+    const double span = sweep_angle(start_angle, end_angle, ccw);
+    if (span >= TWO_PI) {
+        circle(layer, cx, cy, radius);
+        return;
+    }
+
+    if (options_.format == DrawingFormat::Svg) {
+        svg_open_path(layer);
+        svg_point('M', cx + radius * std::cos(start_angle), cy + radius * std::sin(start_angle));
+        put("A ");
+        put_number(radius);
+        put(" ");
+        put_number(radius);
+        // Flipping y mirrors the turning direction
+        put(span > M_PI ? " 0 1 " : " 0 0 ");
+        put(ccw ? "0 " : "1 ");
+        svg_point(0, cx + radius * std::cos(end_angle), cy + radius * std::sin(end_angle));
+        put("\"/>\n");
+        return;
+    }
+
+    // DXF arcs always run counter-clockwise from 50 to 51
+    dxf_entity("ARC", layer, "AcDbCircle");
+    dxf_number(10, cx);
+    dxf_number(20, cy);
+    dxf_number(30, 0.0);
+    dxf_number(40, radius);
+    if (options_.format == DrawingFormat::DxfR2000) put("100\nAcDbArc\n");
+    dxf_number(50, degrees(ccw ? start_angle : end_angle), false);
+    dxf_number(51, degrees(ccw ? end_angle : start_angle), false);
+}
+
+void DrawingWriter::ellipse(DrawingLayer layer, double cx, double cy,
+                            double major_radius, double minor_radius, double rotation,
+                            double start_param, double end_param, bool ccw) {
+    const double span = sweep_angle(start_param, end_param, ccw);
+    const bool full = span >= TWO_PI;
+
+    if (options_.format == DrawingFormat::Svg) {
+        double x, y;
+        svg_open_path(layer);
+        ellipse_point(cx, cy, major_radius, minor_radius, rotation, start_param, x, y);
+        svg_point('M', x, y);
+
+        // A full ellipse is two half arcs (SVG cannot draw a closed arc)
+        const int pieces = full ? 2 : 1;
+        const double step = (ccw ? span : -span) / pieces;
+        for (int i = 1; i <= pieces; ++i) {
+            put("A ");
+            put_number(major_radius);
+            put(" ");
+            put_number(minor_radius);
+            put(" ");
+            put_number(-rotation * RAD_TO_DEG, false);
+            put(span / pieces > M_PI ? " 1 " : " 0 ");
+            put(ccw ? "0 " : "1 ");
+            ellipse_point(cx, cy, major_radius, minor_radius, rotation, start_param + i * step, x, y);
+            svg_point(0, x, y);
+        }
+        put("\"/>\n");
+        return;
+    }
+
+    if (options_.format == DrawingFormat::DxfR12) {
+        // No ELLIPSE entity in R12: flatten within the chord tolerance
+        const double a = std::max(major_radius, minor_radius);
+        const double tolerance = std::clamp(options_.chord_tolerance, 1e-9, a);
+        const double max_step = 2.0 * std::acos(1.0 - tolerance / std::max(a, 1e-12));
+        const size_t segments = static_cast<size_t>(
+            std::clamp(std::ceil(span / std::max(max_step, 1e-6)), 4.0, 65536.0));
+
+        dxf_entity("POLYLINE", layer, nullptr);
+        put("66\n1\n");
+        dxf_number(10, 0.0);
+        dxf_number(20, 0.0);
+        dxf_number(30, 0.0);
+        dxf_code(70);
+        put(full ? "1\n" : "0\n");
+        const size_t count = full ? segments : segments + 1;
+        const double step = (ccw ? span : -span) / segments;
+        for (size_t i = 0; i < count; ++i) {
+            double x, y;
+            ellipse_point(cx, cy, major_radius, minor_radius, rotation, start_param + i * step, x, y);
+            dxf_entity("VERTEX", layer, nullptr);
+            dxf_number(10, x);
+            dxf_number(20, y);
+            dxf_number(30, 0.0);
+        }
+        dxf_entity("SEQEND", layer, nullptr);
+        return;
+    }
+
+    // DXF ELLIPSE needs the major axis first and runs counter-clockwise
+    if (minor_radius > major_radius) {
+        std::swap(major_radius, minor_radius);
+        rotation += M_PI / 2.0;
+        start_param -= M_PI / 2.0;
+        end_param -= M_PI / 2.0;
+    }
+    double from = ccw ? start_param : end_param;
+    if (full) from = 0.0;
+    from = std::fmod(from, TWO_PI);
+    if (from < 0.0) from += TWO_PI;
+
+    dxf_entity("ELLIPSE", layer, "AcDbEllipse");
+    dxf_number(10, cx);
+    dxf_number(20, cy);
+    dxf_number(30, 0.0);
+    dxf_number(11, major_radius * std::cos(rotation));
+    dxf_number(21, major_radius * std::sin(rotation));
+    dxf_number(31, 0.0);
+    dxf_number(40, major_radius > 0.0 ? minor_radius / major_radius : 1.0, false);
+    double to = from + span;
+    if (!full && to >= TWO_PI) to -= TWO_PI;  // End below start wraps through 0
+    dxf_number(41, from, false);
+    dxf_number(42, to, false);
+}
+
+void DrawingWriter::polyline(DrawingLayer layer, const double* points, size_t count, bool closed) {
+    if (count < 2) return;
+
+    if (options_.format == DrawingFormat::Svg) {
+        svg_open_path(layer);
+        svg_point('M', points[0], points[1]);
+        put("L ");
+        for (size_t i = 1; i < count; ++i) {
+            svg_point(0, points[2 * i], points[2 * i + 1]);
+        }
+        if (closed) put("Z");
+        put("\"/>\n");
+        return;
+    }
+
+    if (options_.format == DrawingFormat::DxfR12) {
+        dxf_entity("POLYLINE", layer, nullptr);
+        put("66\n1\n");
+        dxf_number(10, 0.0);
+        dxf_number(20, 0.0);
+        dxf_number(30, 0.0);
+        dxf_code(70);
+        put(closed ? "1\n" : "0\n");
+        for (size_t i = 0; i < count; ++i) {
+            dxf_entity("VERTEX", layer, nullptr);
+            dxf_number(10, points[2 * i]);
+            dxf_number(20, points[2 * i + 1]);
+            dxf_number(30, 0.0);
+        }
+        dxf_entity("SEQEND", layer, nullptr);
+        return;
+    }
+
+    dxf_entity("LWPOLYLINE", layer, "AcDbPolyline");
+    dxf_code(90);
+    put_integer(static_cast<int64_t>(count));
+    put("\n70\n");
+    put(closed ? "1\n" : "0\n");
+    for (size_t i = 0; i < count; ++i) {
+        dxf_number(10, points[2 * i]);
+        dxf_number(20, points[2 * i + 1]);
+    }
+}
+
+} // namespace cadhy::projection
@@ -0,0 +1,165 @@
+/**
+ * @file hatch.cpp
+ * @brief Implementation of scanline hatch generation
+ */
+
+#include <cadhy/projection/hatch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace cadhy::projection {
+
+//------------------------------------------------------------------------------
+// Helper Functions
+//------------------------------------------------------------------------------
+
+namespace {
+
+/// Polygon edge in the hatch frame (u along the lines, v across them)
+struct ScanEdge {
+    double u_low, v_low;  // Lower end (smaller v)
+    double slope;         // du/dv
+    int64_t first, last;  // Scanlines crossed: first <= i <= last
+    int winding;          // +1 going up in v, -1 going down
+    double u;             // Crossing on the current scanline
+};
+
+/// Scanline sweep shared by both hatch_rings() overloads; `sink` is called
+/// with each segment
+template <typename Sink>
+size_t sweep_rings(const std::vector<HatchRing>& rings, const HatchOptions& options, Sink&& sink) {
+    const double spacing = options.spacing;
+    if (!(spacing > 0.0) || !std::isfinite(spacing)) return 0;
+
+    const double angle = options.angle_deg * M_PI / 180.0;
+    const double c = std::cos(angle);
+    const double s = std::sin(angle);
+    const double ax = options.anchor_x;
+    const double ay = options.anchor_y;
+
+    // Edges in the rotated frame; each covers the half-open range
+    // [v_low, v_high) so a scanline through a vertex counts it once
+    std::vector<ScanEdge> edges;
+    int64_t line_min = INT64_MAX, line_max = INT64_MIN;
+    for (const HatchRing& ring : rings) {
+        if (ring.count < 3) continue;
+        for (size_t j = 0; j < ring.count; ++j) {
+            const size_t k = (j + 1) % ring.count;
+            const double dx0 = ring.points[2 * j] - ax, dy0 = ring.points[2 * j + 1] - ay;
+            const double dx1 = ring.points[2 * k] - ax, dy1 = ring.points[2 * k + 1] - ay;
+            const double u0 = dx0 * c + dy0 * s, v0 = dx0 * s - dy0 * c;
+            const double u1 = dx1 * c + dy1 * s, v1 = dx1 * s - dy1 * c;
+            if (v0 == v1 || !std::isfinite(v0) || !std::isfinite(v1)) continue;
+
+            ScanEdge edge;
+            edge.winding = v1 > v0 ? 1 : -1;
+            const double v_high = std::max(v0, v1);
+            edge.v_low = std::min(v0, v1);
+            edge.u_low = v0 < v1 ? u0 : u1;
+            edge.slope = ((v0 < v1 ? u1 : u0) - edge.u_low) / (v_high - edge.v_low);
+            edge.first = static_cast<int64_t>(std::ceil(edge.v_low / spacing));
+            edge.last = static_cast<int64_t>(std::ceil(v_high / spacing)) - 1;
+            if (edge.first > edge.last) continue;  // Between two scanlines
+
+            line_min = std::min(line_min, edge.first);
+            line_max = std::max(line_max, edge.last);
+            edges.push_back(edge);
+        }
+    }
+    if (edges.empty()) return 0;
+
+    // Bucket edges by their first scanline (counting sort)
+    const size_t line_count = static_cast<size_t>(line_max - line_min + 1);
+    std::vector<uint32_t> bucket_start(line_count + 1, 0);
+    for (const ScanEdge& edge : edges) {
+        ++bucket_start[static_cast<size_t>(edge.first - line_min) + 1];
+    }
+    for (size_t i = 0; i < line_count; ++i) {
+        bucket_start[i + 1] += bucket_start[i];
+    }
+    std::vector<uint32_t> order(edges.size());
+    {
+        std::vector<uint32_t> fill(bucket_start.begin(), bucket_start.end() - 1);
+        for (size_t e = 0; e < edges.size(); ++e) {
+            order[fill[static_cast<size_t>(edges[e].first - line_min)]++] = static_cast<uint32_t>(e);
+        }
+    }
+
+    size_t emitted = 0;
+    std::vector<ScanEdge> active;
+    auto emit = [&](double u_from, double u_to, double v) {
+        if (u_to - u_from <= options.min_length) return;
+        sink(HatchSegment{
+            ax + u_from * c + v * s, ay + u_from * s - v * c,
+            ax + u_to * c + v * s, ay + u_to * s - v * c
+        });
+        ++emitted;
+    };
+
+    for (size_t line = 0; line < line_count; ++line) {
+        const int64_t index = line_min + static_cast<int64_t>(line);
+        const double v = static_cast<double>(index) * spacing;
+
+        // Enter new edges, drop finished ones, update crossings
+        for (uint32_t b = bucket_start[line]; b < bucket_start[line + 1]; ++b) {
+            active.push_back(edges[order[b]]);
+        }
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [index](const ScanEdge& e) { return e.last < index; }),
+                     active.end());
+        for (ScanEdge& edge : active) {
+            edge.u = edge.u_low + (v - edge.v_low) * edge.slope;
+        }
+
+        // Crossings move little between scanlines, so the table stays
+        // nearly sorted and insertion sort is close to linear
+        for (size_t i = 1; i < active.size(); ++i) {
+            ScanEdge edge = active[i];
+            size_t j = i;
+            while (j > 0 && active[j - 1].u > edge.u) {
+                active[j] = active[j - 1];
+                --j;
+            }
+            active[j] = edge;
+        }
+
+        if (options.rule == FillRule::EvenOdd) {
+            for (size_t i = 0; i + 1 < active.size(); i += 2) {
+                emit(active[i].u, active[i + 1].u, v);
+            }
+        } else {
+            int winding = 0;
+            double span_start = 0.0;
+            for (const ScanEdge& edge : active) {
+                const int previous = winding;
+                winding += edge.winding;
+                if (previous == 0 && winding != 0) span_start = edge.u;
+                else if (previous != 0 && winding == 0) emit(span_start, edge.u, v);
+            }
+        }
+    }
+
+    return emitted;
+}
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+// Scanline Hatching
+//------------------------------------------------------------------------------
+
+size_t hatch_rings(const std::vector<HatchRing>& rings,
+                   const HatchOptions& options,
+                   std::vector<HatchSegment>& out) {
+    return sweep_rings(rings, options, [&out](const HatchSegment& segment) { out.push_back(segment); });
+}
+
+size_t hatch_rings(const std::vector<HatchRing>& rings,
+                   const HatchOptions& options,
+                   const HatchSink& sink) {
+    return sweep_rings(rings, options, sink);
+}
+
+} // namespace cadhy::projection
@@ -0,0 +1,614 @@
+/**
+ * @file hlr_cleanup.cpp
+ * @brief Implementation of HLR line post-processing
+ */
+
+#include <cadhy/projection/hlr_cleanup.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <utility>
+
+namespace cadhy::projection {
+
+//------------------------------------------------------------------------------
+// Helper Functions
+//------------------------------------------------------------------------------
+
+namespace {
+
+constexpr uint32_t NONE = ~uint32_t(0);
+constexpr double TWO_PI = 2.0 * M_PI;
+
+// Share of the tolerance spent on welding ends and matching overlaps; the
+// rest goes to arc fitting and Douglas-Peucker
+constexpr double WELD_SHARE = 0.1;
+
+struct Segment {
+    double x0, y0, x1, y1;
+    int32_t line_type;
+    bool hidden;
+};
+
+inline uint64_t cell_key(int64_t ix, int64_t iy) {
+    return (uint64_t(uint32_t(ix)) << 32) | uint32_t(iy);
+}
+
+inline int64_t cell_index(double v, double cell) {
+    return static_cast<int64_t>(std::floor(v / cell));
+}
+
+/// Uniform grid registering each segment in the cells its line passes.
+/// Cell contents are linked lists in one entry pool.
+class SegmentGrid {
+public:
+    SegmentGrid(double cell, double reach, size_t expected) : cell_(cell), reach_(reach) {
+        entries_.reserve(2 * expected);
+        heads_.reserve(2 * expected);
+    }
+
+    void insert(uint32_t id, const Segment& s) {
+        visit(s, [&](int64_t ix, int64_t iy) {
+            auto [it, inserted] = heads_.emplace(cell_key(ix, iy), NONE);
+            entries_.push_back({id, it->second});
+            it->second = static_cast<uint32_t>(entries_.size() - 1);
+        });
+    }
+
+    /// Calls f(id) for every segment that may pass within `reach` of `s`;
+    /// an id may be reported more than once
+    template <typename F>
+    void query(const Segment& s, F&& f) const {
+        auto scan = [&](int64_t ix, int64_t iy) {
+            auto it = heads_.find(cell_key(ix, iy));
+            if (it == heads_.end()) return;
+            for (uint32_t e = it->second; e != NONE; e = entries_[e].next) f(entries_[e].id);
+        };
+
+        // Short segments: every cell of the box around s grown by `reach`
+        const int64_t x0 = cell_index(std::min(s.x0, s.x1) - reach_, cell_);
+        const int64_t x1 = cell_index(std::max(s.x0, s.x1) + reach_, cell_);
+        const int64_t y0 = cell_index(std::min(s.y0, s.y1) - reach_, cell_);
+        const int64_t y1 = cell_index(std::max(s.y0, s.y1) + reach_, cell_);
+        if ((x1 - x0 + 1) * (y1 - y0 + 1) <= 9) {
+            for (int64_t ix = x0; ix <= x1; ++ix) {
+                for (int64_t iy = y0; iy <= y1; ++iy) scan(ix, iy);
+            }
+            return;
+        }
+
+        // Long diagonal ones: the cells along s and their neighbours
+        visit(s, [&](int64_t ix, int64_t iy) {
+            for (int64_t dx = -1; dx <= 1; ++dx) {
+                for (int64_t dy = -1; dy <= 1; ++dy) scan(ix + dx, iy + dy);
+            }
+        });
+    }
+
+private:
+    struct Entry {
+        uint32_t id;
+        uint32_t next;
+    };
+
+    /// Grid traversal (Amanatides-Woo) from one end of `s` to the other
+    template <typename F>
+    void visit(const Segment& s, F&& f) const {
+        int64_t ix = cell_index(s.x0, cell_), iy = cell_index(s.y0, cell_);
+        const int64_t ex = cell_index(s.x1, cell_), ey = cell_index(s.y1, cell_);
+        const double dx = s.x1 - s.x0, dy = s.y1 - s.y0;
+        const int64_t step_x = dx > 0 ? 1 : -1, step_y = dy > 0 ? 1 : -1;
+        double t_max_x = dx != 0 ? ((ix + (dx > 0)) * cell_ - s.x0) / dx : HUGE_VAL;
+        double t_max_y = dy != 0 ? ((iy + (dy > 0)) * cell_ - s.y0) / dy : HUGE_VAL;
+        const double t_delta_x = dx != 0 ? cell_ / std::abs(dx) : HUGE_VAL;
+        const double t_delta_y = dy != 0 ? cell_ / std::abs(dy) : HUGE_VAL;
+
+        f(ix, iy);
+        const int64_t steps = std::abs(ex - ix) + std::abs(ey - iy);
+        for (int64_t k = 0; k < steps; ++k) {
+            if (t_max_x < t_max_y) {
+                ix += step_x;
+                t_max_x += t_delta_x;
+            } else {
+                iy += step_y;
+                t_max_y += t_delta_y;
+            }
+            f(ix, iy);
+        }
+    }
+
+    double cell_;
+    double reach_;
+    std::vector<Entry> entries_;
+    std::unordered_map<uint64_t, uint32_t> heads_;
+};
+
+/// Split strokes into segments, then drop the parts of each segment lying
+/// along an earlier accepted one (visible strokes are accepted first)
+std::vector<Segment> remove_overlaps(std::vector<Segment> segments, double eps) {
+    std::stable_partition(segments.begin(), segments.end(),
+                          [](const Segment& s) { return !s.hidden; });
+
+    double total_length = 0.0;
+    for (const auto& s : segments) total_length += std::hypot(s.x1 - s.x0, s.y1 - s.y0);
+    const double cell = std::max(total_length / std::max<size_t>(segments.size(), 1), 4.0 * eps);
+
+    SegmentGrid grid(cell, eps, segments.size());
+    std::vector<Segment> accepted;
+    std::vector<uint32_t> stamp;
+    accepted.reserve(segments.size());
+    stamp.reserve(segments.size());
+    uint32_t query = 0;
+    std::vector<std::pair<double, double>> covered;
+
+    auto accept = [&](const Segment& s) {
+        grid.insert(static_cast<uint32_t>(accepted.size()), s);
+        accepted.push_back(s);
+        stamp.push_back(0);
+    };
+
+    for (const Segment& q : segments) {
+        const double length = std::hypot(q.x1 - q.x0, q.y1 - q.y0);
+        if (length <= eps) {
+            accept(q);  // Welding decides what happens to it
+            continue;
+        }
+        const double ux = (q.x1 - q.x0) / length, uy = (q.y1 - q.y0) / length;
+
+        // Parameter ranges of q covered by accepted segments along it
+        ++query;
+        covered.clear();
+        grid.query(q, [&](uint32_t id) {
+            if (stamp[id] == query) return;
+            stamp[id] = query;
+            const Segment& s = accepted[id];
+            const double ax = s.x0 - q.x0, ay = s.y0 - q.y0;
+            const double bx = s.x1 - q.x0, by = s.y1 - q.y0;
+            if (std::abs(ux * ay - uy * ax) > eps || std::abs(ux * by - uy * bx) > eps) return;
+            const double ta = ux * ax + uy * ay, tb = ux * bx + uy * by;
+            const double lo = std::max(0.0, std::min(ta, tb));
+            const double hi = std::min(length, std::max(ta, tb));
+            if (hi - lo > eps) covered.push_back({lo, hi});
+        });
+
+        if (covered.empty()) {
+            accept(q);
+            continue;
+        }
+
+        // Keep the uncovered pieces
+        std::sort(covered.begin(), covered.end());
+        double from = 0.0;
+        auto keep = [&](double t0, double t1) {
+            if (t1 - t0 <= eps) return;
+            Segment piece = q;
+            piece.x0 = q.x0 + ux * t0;
+            piece.y0 = q.y0 + uy * t0;
+            piece.x1 = q.x0 + ux * t1;
+            piece.y1 = q.y0 + uy * t1;
+            accept(piece);
+        };
+        for (const auto& [lo, hi] : covered) {
+            if (lo > from) keep(from, lo);
+            from = std::max(from, hi);
+        }
+        if (from < length) keep(from, length);
+    }
+
+    return accepted;
+}
+
+/// Merges points closer than the weld radius (first point seen wins).
+/// Cells are twice the radius wide, so a point's neighbours lie in the 2x2
+/// block of cells nearest to it.
+class VertexWelder {
+public:
+    VertexWelder(double radius, size_t expected) : radius_(radius), cell_(2.0 * radius) {
+        xs_.reserve(expected);
+        ys_.reserve(expected);
+        next_.reserve(expected);
+    }
+
+    /// Indexed vertex within the radius of (x, y), or NONE
+    uint32_t find(double x, double y) const {
+        if (heads_.empty()) return NONE;
+        uint64_t keys[4];
+        neighbour_keys(x, y, keys);
+        for (uint64_t key : keys) {
+            auto it = heads_.find(key);
+            if (it == heads_.end()) continue;
+            for (uint32_t v = it->second; v != NONE; v = next_[v]) {
+                const double ex = xs_[v] - x, ey = ys_[v] - y;
+                if (ex * ex + ey * ey <= radius_ * radius_) return v;
+            }
+        }
+        return NONE;
+    }
+
+    /// Existing vertex within the radius, else a new indexed one
+    uint32_t weld(double x, double y) {
+        const uint32_t found = find(x, y);
+        if (found != NONE) return found;
+        uint64_t keys[4];
+        neighbour_keys(x, y, keys);
+        const uint32_t v = add(x, y);
+        auto [it, inserted] = heads_.emplace(keys[0], v);
+        next_[v] = inserted ? NONE : it->second;
+        it->second = v;
+        return v;
+    }
+
+    /// New vertex that later lookups will not find
+    uint32_t add(double x, double y) {
+        xs_.push_back(x);
+        ys_.push_back(y);
+        next_.push_back(NONE);
+        return static_cast<uint32_t>(xs_.size() - 1);
+    }
+
+    double x(uint32_t v) const { return xs_[v]; }
+    double y(uint32_t v) const { return ys_[v]; }
+    size_t size() const { return xs_.size(); }
+
+private:
+    double radius_;
+    double cell_;
+    std::vector<double> xs_, ys_;
+    std::vector<uint32_t> next_;  // Next vertex in the same cell
+    std::unordered_map<uint64_t, uint32_t> heads_;
+
+    void neighbour_keys(double x, double y, uint64_t keys[4]) const {
+        const double fx = x / cell_, fy = y / cell_;
+        const int64_t ix = static_cast<int64_t>(std::floor(fx));
+        const int64_t iy = static_cast<int64_t>(std::floor(fy));
+        const int64_t nx = fx - ix < 0.5 ? ix - 1 : ix + 1;
+        const int64_t ny = fy - iy < 0.5 ? iy - 1 : iy + 1;
+        keys[0] = cell_key(ix, iy);
+        keys[1] = cell_key(nx, iy);
+        keys[2] = cell_key(ix, ny);
+        keys[3] = cell_key(nx, ny);
+    }
+};
+
+/// Distance from p to segment ab
+double point_segment_distance(const double* p, const double* a, const double* b) {
+    const double abx = b[0] - a[0], aby = b[1] - a[1];
+    const double apx = p[0] - a[0], apy = p[1] - a[1];
+    const double len2 = abx * abx + aby * aby;
+    double t = len2 > 0.0 ? (apx * abx + apy * aby) / len2 : 0.0;
+    t = std::clamp(t, 0.0, 1.0);
+    return std::hypot(apx - t * abx, apy - t * aby);
+}
+
+/// Douglas-Peucker on points [first, last] of `pts`, appended to `out`
+void douglas_peucker(const std::vector<double>& pts, size_t first, size_t last,
+                     double tolerance, std::vector<double>& out) {
+    std::vector<uint8_t> keep(last - first + 1, 0);
+    keep.front() = keep.back() = 1;
+    std::vector<std::pair<size_t, size_t>> stack = {{first, last}};
+    while (!stack.empty()) {
+        auto [a, b] = stack.back();
+        stack.pop_back();
+        double worst = tolerance;
+        size_t split = 0;
+        for (size_t k = a + 1; k < b; ++k) {
+            double d = point_segment_distance(&pts[2 * k], &pts[2 * a], &pts[2 * b]);
+            if (d > worst) {
+                worst = d;
+                split = k;
+            }
+        }
+        if (split) {
+            keep[split - first] = 1;
+            stack.push_back({a, split});
+            stack.push_back({split, b});
+        }
+    }
+    for (size_t k = first; k <= last; ++k) {
+        if (keep[k - first]) {
+            out.push_back(pts[2 * k]);
+            out.push_back(pts[2 * k + 1]);
+        }
+    }
+}
+
+/// Circle through three points; false if (nearly) collinear
+bool circumcircle(const double* a, const double* b, const double* c,
+                  double& cx, double& cy, double& r) {
+    const double d = 2.0 * (a[0] * (b[1] - c[1]) + b[0] * (c[1] - a[1]) + c[0] * (a[1] - b[1]));
+    if (std::abs(d) < 1e-300) return false;
+    const double a2 = a[0] * a[0] + a[1] * a[1];
+    const double b2 = b[0] * b[0] + b[1] * b[1];
+    const double c2 = c[0] * c[0] + c[1] * c[1];
+    cx = (a2 * (b[1] - c[1]) + b2 * (c[1] - a[1]) + c2 * (a[1] - b[1])) / d;
+    cy = (a2 * (c[0] - b[0]) + b2 * (a[0] - c[0]) + c2 * (b[0] - a[0])) / d;
+    r = std::hypot(a[0] - cx, a[1] - cy);
+    return std::isfinite(r);
+}
+
+/// Arc through points [i, j] (closing the loop when `full`)
+struct ArcFit {
+    double cx, cy, r;
+    bool ccw;
+};
+
+/// Whether points [i, j] lie on one circle, turning one way, sweeping less
+/// than a full turn (or exactly one when `full`), and not on a line
+bool fit_arc(const std::vector<double>& pts, size_t i, size_t j, bool full,
+             const HlrCleanupOptions& options, double tolerance, ArcFit& fit) {
+    const double* p = pts.data();
+    const size_t m1 = full ? i + (j - i) / 3 : (i + j) / 2;
+    const size_t m2 = full ? i + 2 * (j - i) / 3 : j;
+    if (!circumcircle(&p[2 * i], &p[2 * m1], &p[2 * m2], fit.cx, fit.cy, fit.r)) return false;
+    if (fit.r > options.max_arc_radius) return false;
+
+    double sweep = 0.0;
+    bool on_line = !full;
+    for (size_t k = i; k <= j; ++k) {
+        if (std::abs(std::hypot(p[2 * k] - fit.cx, p[2 * k + 1] - fit.cy) - fit.r) > tolerance) return false;
+        if (on_line && point_segment_distance(&p[2 * k], &p[2 * i], &p[2 * j]) > tolerance) on_line = false;
+        if (k > i) {
+            const double ax = p[2 * k - 2] - fit.cx, ay = p[2 * k - 1] - fit.cy;
+            const double bx = p[2 * k] - fit.cx, by = p[2 * k + 1] - fit.cy;
+            const double step = std::atan2(ax * by - ay * bx, ax * bx + ay * by);
+            if (k > i + 1 && step * sweep < 0.0) return false;  // Turned back
+            sweep += step;
+        }
+    }
+    if (on_line) return false;
+    if (full) {
+        if (std::abs(std::abs(sweep) - TWO_PI) > 1e-6) return false;
+    } else if (std::abs(sweep) >= TWO_PI - 1e-6) {
+        return false;
+    }
+    fit.ccw = sweep > 0.0;
+    return true;
+}
+
+double stroke_length(const std::vector<double>& pts) {
+    double length = 0.0;
+    for (size_t k = 2; k + 1 < pts.size(); k += 2) {
+        length += std::hypot(pts[k] - pts[k - 2], pts[k + 1] - pts[k - 1]);
+    }
+    return length;
+}
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+// HLR Cleanup
+//------------------------------------------------------------------------------
+
+HlrCleanupResult cleanup_hlr_strokes(const std::vector<HlrStroke>& input,
+                                     const HlrCleanupOptions& options) {
+    HlrCleanupResult result;
+    const double tolerance = std::max(options.tolerance, 0.0);
+    const double eps = std::max(tolerance * WELD_SHARE, 1e-12);
+    const double fit_tolerance = tolerance - eps > 0.0 ? tolerance - eps : tolerance;
+
+    // 1. Segments, minus overlaps
+    std::vector<Segment> segments;
+    for (const auto& stroke : input) {
+        const size_t n = stroke.points.size() / 2;
+        result.input_points += n;
+        for (size_t k = 1; k < n; ++k) {
+            segments.push_back(Segment{
+                stroke.points[2 * k - 2], stroke.points[2 * k - 1],
+                stroke.points[2 * k], stroke.points[2 * k + 1],
+                stroke.line_type, stroke.hidden
+            });
+        }
+        if (stroke.closed && n > 2) {
+            segments.push_back(Segment{
+                stroke.points[2 * n - 2], stroke.points[2 * n - 1],
+                stroke.points[0], stroke.points[1],
+                stroke.line_type, stroke.hidden
+            });
+        }
+    }
+    if (options.remove_overlaps) {
+        segments = remove_overlaps(std::move(segments), eps);
+    }
+
+    // 2. Weld ends into a graph and index incident edges (CSR)
+    VertexWelder welder(eps, segments.size() + 1);
+    struct Edge {
+        uint32_t a, b;
+        uint32_t style;  // Index into `styles`
+    };
+    std::vector<std::pair<int32_t, bool>> styles;
+    std::vector<Edge> edges;
+
+    // Stroke ends are welded through the hash first. Joints inside a stroke
+    // (a segment starting exactly where the previous one ended) only attach
+    // to an end lying there, so the hash stays small.
+    const size_t count = segments.size();
+    std::vector<uint8_t> joint(count, 0);
+    for (size_t i = 1; i < count; ++i) {
+        joint[i] = segments[i].x0 == segments[i - 1].x1 && segments[i].y0 == segments[i - 1].y1;
+    }
+    std::vector<uint32_t> start_vertex(count, NONE), end_vertex(count, NONE);
+    for (size_t i = 0; i < count; ++i) {
+        const Segment& s = segments[i];
+        if (!joint[i]) start_vertex[i] = welder.weld(s.x0, s.y0);
+        if (i + 1 == count || !joint[i + 1]) end_vertex[i] = welder.weld(s.x1, s.y1);
+    }
+    for (size_t i = 1; i < count; ++i) {
+        if (!joint[i]) continue;
+        const Segment& s = segments[i];
+        uint32_t v = welder.find(s.x0, s.y0);
+        if (v == NONE) v = welder.add(s.x0, s.y0);
+        start_vertex[i] = end_vertex[i - 1] = v;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        const Segment& s = segments[i];
+        const uint32_t a = start_vertex[i], b = end_vertex[i];
+        if (a == b) continue;
+        const std::pair<int32_t, bool> style{s.line_type, s.hidden};
+        auto it = std::find(styles.begin(), styles.end(), style);
+        if (it == styles.end()) it = styles.insert(styles.end(), style);
+        edges.push_back(Edge{a, b, static_cast<uint32_t>(it - styles.begin())});
+    }
+
+    std::vector<uint32_t> incident_start(welder.size() + 1, 0);
+    for (const auto& e : edges) {
+        ++incident_start[e.a + 1];
+        ++incident_start[e.b + 1];
+    }
+    for (size_t v = 0; v < welder.size(); ++v) incident_start[v + 1] += incident_start[v];
+    std::vector<uint32_t> incident(incident_start.back());
+    {
+        std::vector<uint32_t> fill(incident_start.begin(), incident_start.end() - 1);
+        for (uint32_t e = 0; e < edges.size(); ++e) {
+            incident[fill[edges[e].a]++] = e;
+            incident[fill[edges[e].b]++] = e;
+        }
+    }
+
+    // The edge continuing a chain through v after e, if v is a two-way
+    // junction of e's style and that edge is still free
+    std::vector<uint8_t> used(edges.size(), 0);
+    auto continuation = [&](uint32_t v, uint32_t e) -> uint32_t {
+        uint32_t other = NONE;
+        int count = 0;
+        for (uint32_t k = incident_start[v]; k < incident_start[v + 1]; ++k) {
+            const uint32_t f = incident[k];
+            if (edges[f].style != edges[e].style) continue;
+            if (++count > 2) return NONE;
+            if (f != e) other = f;
+        }
+        return (count == 2 && other != NONE && !used[other]) ? other : NONE;
+    };
+    auto is_junction = [&](uint32_t v, uint32_t e) {
+        int count = 0;
+        for (uint32_t k = incident_start[v]; k < incident_start[v + 1]; ++k) {
+            if (edges[incident[k]].style == edges[e].style) ++count;
+        }
+        return count != 2;
+    };
+
+    // 3./4. Per chain: arcs, then Douglas-Peucker on the runs between them
+    std::vector<double> pts, simplified;
+    auto emit_run = [&](size_t first, size_t last, const std::pair<int32_t, bool>& style, bool closed) {
+        simplified.clear();
+        douglas_peucker(pts, first, last, fit_tolerance, simplified);
+        if (closed && simplified.size() >= 8) {
+            simplified.resize(simplified.size() - 2);  // Drop the repeated start
+        } else {
+            closed = false;
+        }
+        if (options.min_length > 0.0 && stroke_length(simplified) < options.min_length) return;
+        HlrStroke stroke;
+        stroke.points = simplified;
+        stroke.line_type = style.first;
+        stroke.hidden = style.second;
+        stroke.closed = closed;
+        result.output_points += stroke.points.size() / 2;
+        result.strokes.push_back(std::move(stroke));
+    };
+    auto emit_arc = [&](const ArcFit& fit, size_t i, size_t j, bool full,
+                        const std::pair<int32_t, bool>& style) {
+        HlrArc arc;
+        arc.cx = fit.cx;
+        arc.cy = fit.cy;
+        arc.radius = fit.r;
+        arc.start_angle = std::atan2(pts[2 * i + 1] - fit.cy, pts[2 * i] - fit.cx);
+        arc.end_angle = full ? arc.start_angle + (fit.ccw ? TWO_PI : -TWO_PI)
+                             : std::atan2(pts[2 * j + 1] - fit.cy, pts[2 * j] - fit.cx);
+        arc.ccw = fit.ccw;
+        arc.full_circle = full;
+        arc.line_type = style.first;
+        arc.hidden = style.second;
+        result.output_points += 2;
+        result.arcs.push_back(arc);
+    };
+
+    auto process_chain = [&](const std::vector<uint32_t>& chain, uint32_t style_index) {
+        const auto& style = styles[style_index];
+        const bool closed = chain.size() > 3 && chain.front() == chain.back();
+        pts.clear();
+        for (uint32_t v : chain) {
+            pts.push_back(welder.x(v));
+            pts.push_back(welder.y(v));
+        }
+        const size_t n = chain.size();
+        const size_t min_points = std::max<size_t>(options.min_arc_points, 3);
+
+        ArcFit fit;
+        if (options.fit_arcs && closed && n - 1 >= min_points &&
+            fit_arc(pts, 0, n - 1, true, options, fit_tolerance, fit)) {
+            emit_arc(fit, 0, n - 1, true, style);
+            return;
+        }
+        if (!options.fit_arcs || n < min_points) {
+            emit_run(0, n - 1, style, closed);
+            return;
+        }
+
+        // Greedy: from each point, grow the longest arc (doubling, then
+        // bisecting between the last fit and the first failure)
+        size_t run_start = 0, i = 0;
+        bool any_arc = false;
+        while (i + min_points <= n) {
+            size_t good = i + min_points - 1;
+            if (!fit_arc(pts, i, good, false, options, fit_tolerance, fit)) {
+                ++i;
+                continue;
+            }
+            size_t bad = n, step = min_points;
+            while (good + 1 < n) {
+                const size_t probe = std::min(n - 1, good + step);
+                ArcFit trial;
+                if (fit_arc(pts, i, probe, false, options, fit_tolerance, trial)) {
+                    good = probe;
+                    step *= 2;
+                } else {
+                    bad = probe;
+                    break;
+                }
+            }
+            while (bad != n && bad - good > 1) {
+                const size_t mid = good + (bad - good) / 2;
+                ArcFit trial;
+                if (fit_arc(pts, i, mid, false, options, fit_tolerance, trial)) good = mid;
+                else bad = mid;
+            }
+            fit_arc(pts, i, good, false, options, fit_tolerance, fit);
+
+            if (i > run_start) emit_run(run_start, i, style, false);
+            emit_arc(fit, i, good, false, style);
+            any_arc = true;
+            run_start = i = good;
+        }
+        if (run_start + 1 < n) emit_run(run_start, n - 1, style, closed && !any_arc);
+    };
+
+    // Chains start at junctions and ends; what is left are closed loops
+    std::vector<uint32_t> chain;
+    auto walk = [&](uint32_t e, uint32_t from) {
+        const uint32_t style = edges[e].style;
+        chain.assign(1, from);
+        uint32_t v = from;
+        while (e != NONE) {
+            used[e] = 1;
+            v = edges[e].a == v ? edges[e].b : edges[e].a;
+            chain.push_back(v);
+            e = continuation(v, e);
+        }
+        process_chain(chain, style);
+    };
+    for (uint32_t e = 0; e < edges.size(); ++e) {
+        if (used[e]) continue;
+        if (is_junction(edges[e].a, e)) walk(e, edges[e].a);
+        else if (is_junction(edges[e].b, e)) walk(e, edges[e].b);
+    }
+    for (uint32_t e = 0; e < edges.size(); ++e) {
+        if (!used[e]) walk(e, edges[e].a);
+    }
+
+    return result;
+}
+
+} // namespace cadhy::projection
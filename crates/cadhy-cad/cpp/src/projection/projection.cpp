@@ -39,6 +39,8 @@
 #include <TopoDS_Compound.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopTools_HSequenceOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopExp.hxx>
 
 // B-Rep
 #include <BRep_Tool.hxx>
@@ -52,6 +54,7 @@
 #include <BRepGProp.hxx>
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
+#include <Standard_Failure.hxx>
 
 // Geometry adaptor
 #include <Geom_Plane.hxx>
@@ -70,11 +73,16 @@
 // Bounding box
 #include <Bnd_Box.hxx>
 
+// Tolerances
+#include <Precision.hxx>
+
 // Math
 #include <cmath>
 #include <algorithm>
 #include <sstream>
 #include <iomanip>
+#include <atomic>
+#include <thread>
 
 namespace cadhy::projection {
 
@@ -224,6 +232,230 @@ HLRAlgo_Projector create_projector(const Vector3D& dir, const Point3D& focus, bo
     return HLRAlgo_Projector(axes, perspective);
 }
 
+/// Append the edges of `compound` (if any) as polylines of `type`
+void append_polylines(HLRResult& result, const TopoDS_Shape& compound, LineType type) {
+    if (compound.IsNull()) return;
+
+    gp_Trsf identity;  // Projection already applied by HLR
+    auto polys = edges_to_polylines(compound, type, identity);
+    result.curves.insert(result.curves.end(), polys.begin(), polys.end());
+}
+
+/// Exact HLR of an already prepared shape for one direction.
+/// Reads `shape` only, so several calls may run concurrently.
+HLRResult hlr_exact(const TopoDS_Shape& shape, const BoundingBox3D& view_box,
+                    const Vector3D& direction, const HLROptions& options) {
+    HLRResult result;
+    result.view_box = view_box;
+
+    try {
+        HLRAlgo_Projector projector = create_projector(direction, Point3D{0, 0, 0}, false);
+
+        // HLRBRep_Algo builds its edge/face data and bounding boxes in
+        // projected coordinates, so that part is inherently per view
+        Handle(HLRBRep_Algo) hlr = new HLRBRep_Algo();
+        hlr->Add(shape);
+        hlr->Projector(projector);
+        hlr->Update();
+        hlr->Hide();
+
+        HLRBRep_HLRToShape hlr_to_shape(hlr);
+
+        append_polylines(result, hlr_to_shape.VCompound(), LineType::VisibleSharp);
+        if (options.compute_smooth) {
+            append_polylines(result, hlr_to_shape.Rg1LineVCompound(), LineType::VisibleSmooth);
+        }
+        if (options.compute_outlines) {
+            append_polylines(result, hlr_to_shape.OutLineVCompound(), LineType::VisibleOutline);
+        }
+
+        if (options.compute_hidden) {
+            append_polylines(result, hlr_to_shape.HCompound(), LineType::HiddenSharp);
+            if (options.compute_smooth) {
+                append_polylines(result, hlr_to_shape.Rg1LineHCompound(), LineType::HiddenSmooth);
+            }
+            if (options.compute_outlines) {
+                append_polylines(result, hlr_to_shape.OutLineHCompound(), LineType::HiddenOutline);
+            }
+        }
+
+        result.scale = 1.0;
+
+    } catch (...) {
+        // Return empty result on failure
+    }
+
+    return result;
+}
+
+/// Polygon-based HLR of an already triangulated shape for one direction.
+/// Reads `shape` only, so several calls may run concurrently.
+HLRResult hlr_poly(const TopoDS_Shape& shape, const BoundingBox3D& view_box,
+                   const Vector3D& direction) {
+    HLRResult result;
+    result.view_box = view_box;
+
+    try {
+        HLRAlgo_Projector projector = create_projector(direction, Point3D{0, 0, 0}, false);
+
+        Handle(HLRBRep_PolyAlgo) poly_hlr = new HLRBRep_PolyAlgo();
+        poly_hlr->Load(shape);
+        poly_hlr->Projector(projector);
+        poly_hlr->Update();
+
+        HLRBRep_PolyHLRToShape poly_to_shape;
+        poly_to_shape.Update(poly_hlr);
+
+        append_polylines(result, poly_to_shape.VCompound(), LineType::Visible);
+        append_polylines(result, poly_to_shape.HCompound(), LineType::Hidden);
+        append_polylines(result, poly_to_shape.OutLineVCompound(), LineType::VisibleOutline);
+
+        result.scale = 1.0;
+
+    } catch (...) {
+        // Return empty result on failure
+    }
+
+    return result;
+}
+
+/// Triangulate `shape` for the poly algorithm (through the shape's mesh cache)
+bool prepare_poly(const OcctShape& shape, double deflection) {
+    try {
+        MeshCacheKey key;
+        key.linear_deflection = deflection;
+        return shape.mesh_cache().ensure(shape.get(), key, true);
+    } catch (const Standard_Failure&) {
+        return false;
+    }
+}
+
+/// Run task(0) .. task(count - 1) on up to `max_workers` threads
+/// (0 = hardware threads). Tasks are handed out one at a time, so uneven
+/// tasks (e.g. the isometric view, usually the slowest) balance themselves.
+template <typename Task>
+void run_parallel(size_t count, unsigned max_workers, const Task& task) {
+    size_t workers = max_workers > 0 ? max_workers
+                                     : std::max(1u, std::thread::hardware_concurrency());
+    workers = std::min(workers, count);
+
+    if (workers <= 1) {
+        for (size_t i = 0; i < count; ++i) task(i);
+        return;
+    }
+
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t i = next++; i < count; i = next++) task(i);
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (size_t t = 1; t < workers; ++t) threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads) thread.join();
+}
+
+/// Section result with no edges
+SectionResult empty_section_result() {
+    SectionResult result;
+    result.is_closed = false;
+    result.section_area = 0.0;
+    result.centroid = Point3D{0, 0, 0};
+    return result;
+}
+
+/// Fill `result` from the edges of a plane section (outlines, closure,
+/// area and centroid)
+void fill_section_result(SectionResult& result, const TopoDS_Shape& section_shape,
+                         const gp_Pln& cutting_plane) {
+    result.section_shape = make_shape(section_shape);
+
+    // Check if section forms closed wires
+    TopExp_Explorer wire_exp(section_shape, TopAbs_WIRE);
+    int wire_count = 0;
+    for (; wire_exp.More(); wire_exp.Next()) {
+        ++wire_count;
+        const TopoDS_Wire& wire = TopoDS::Wire(wire_exp.Current());
+        if (wire.Closed()) {
+            result.is_closed = true;
+        }
+    }
+
+    // If closed, compute area
+    if (result.is_closed && wire_count > 0) {
+        // Try to create a face from the wire(s)
+        wire_exp.Init(section_shape, TopAbs_WIRE);
+        if (wire_exp.More()) {
+            const TopoDS_Wire& wire = TopoDS::Wire(wire_exp.Current());
+            try {
+                BRepBuilderAPI_MakeFace face_maker(cutting_plane, wire);
+                if (face_maker.IsDone()) {
+                    GProp_GProps face_props;
+                    BRepGProp::SurfaceProperties(face_maker.Face(), face_props);
+                    result.section_area = face_props.Mass();
+                    gp_Pnt cg = face_props.CentreOfMass();
+                    result.centroid = from_gp_pnt(cg);
+                }
+            } catch (...) {
+                // Face creation failed
+            }
+        }
+    }
+
+    // Create 2D outlines
+    gp_Trsf identity;
+    result.outlines = edges_to_polylines(section_shape, LineType::Visible, identity);
+}
+
+/// Extent of one face's bounding box along the slicing normal
+struct FaceSpan {
+    double lo;
+    double hi;
+    int face;  // Index into the face map
+};
+
+/// Section of the faces `candidates` (indices into `faces`) with a plane.
+/// The faces are only read, so several planes may be cut concurrently.
+SectionResult section_faces(const TopTools_IndexedMapOfShape& faces,
+                            const std::vector<int>& candidates,
+                            const gp_Pln& cutting_plane) {
+    SectionResult result = empty_section_result();
+
+    try {
+        BRep_Builder builder;
+        TopoDS_Compound compound;
+        builder.MakeCompound(compound);
+        for (int index : candidates) {
+            builder.Add(compound, faces(index));
+        }
+
+        if (candidates.empty()) {
+            // Nothing crosses the plane: same empty compound the BOP returns
+            fill_section_result(result, compound, cutting_plane);
+            return result;
+        }
+
+        BRepAlgoAPI_Section section(compound, cutting_plane, Standard_False);
+        section.SetNonDestructive(Standard_True);  // Shared input faces stay untouched
+        section.ComputePCurveOn1(Standard_True);
+        section.Approximation(Standard_True);
+        section.Build();
+
+        if (!section.IsDone()) return result;
+
+        TopoDS_Shape section_shape = section.Shape();
+        if (section_shape.IsNull()) return result;
+
+        fill_section_result(result, section_shape, cutting_plane);
+
+    } catch (...) {
+        // Return empty result on failure
+    }
+
+    return result;
+}
+
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -317,156 +549,26 @@ HLRResult compute_hlr_custom(const OcctShape& shape, const ProjectionParams& par
 
 HLRResult compute_hlr_direction(const OcctShape& shape, const Vector3D& direction,
                                  const HLROptions& options) {
-    HLRResult result;
     const TopoDS_Shape& s = get_shape(shape);
+    if (s.IsNull()) return HLRResult{};
 
-    if (s.IsNull()) return result;
-
-    try {
-        // Use polygon-based HLR if requested (faster but less accurate)
-        if (options.use_poly_algo) {
-            return compute_hlr_poly(shape, ViewDirection::Custom, options.poly_deflection);
-        }
-
-        // Compute bounding box for view
-        result.view_box = compute_bbox(s);
-
-        // Create projector
-        HLRAlgo_Projector projector = create_projector(
-            direction,
-            Point3D{0, 0, 0},
-            false
-        );
-
-        // Create HLR algorithm
-        Handle(HLRBRep_Algo) hlr = new HLRBRep_Algo();
-        hlr->Add(s);
-        hlr->Projector(projector);
-        hlr->Update();
-        hlr->Hide();
-
-        // Extract results
-        HLRBRep_HLRToShape hlr_to_shape(hlr);
-
-        // Identity transform (projection already applied by HLR)
-        gp_Trsf identity;
-
-        // Visible sharp edges
-        TopoDS_Shape visible_sharp = hlr_to_shape.VCompound();
-        if (!visible_sharp.IsNull()) {
-            auto polys = edges_to_polylines(visible_sharp, LineType::VisibleSharp, identity);
-            result.curves.insert(result.curves.end(), polys.begin(), polys.end());
-        }
-
-        // Visible smooth edges
-        if (options.compute_smooth) {
-            TopoDS_Shape visible_smooth = hlr_to_shape.Rg1LineVCompound();
-            if (!visible_smooth.IsNull()) {
-                auto polys = edges_to_polylines(visible_smooth, LineType::VisibleSmooth, identity);
-                result.curves.insert(result.curves.end(), polys.begin(), polys.end());
-            }
-        }
-
-        // Visible outlines (silhouettes)
-        if (options.compute_outlines) {
-            TopoDS_Shape visible_outline = hlr_to_shape.OutLineVCompound();
-            if (!visible_outline.IsNull()) {
-                auto polys = edges_to_polylines(visible_outline, LineType::VisibleOutline, identity);
-                result.curves.insert(result.curves.end(), polys.begin(), polys.end());
-            }
-        }
-
-        // Hidden lines
-        if (options.compute_hidden) {
-            TopoDS_Shape hidden_sharp = hlr_to_shape.HCompound();
-            if (!hidden_sharp.IsNull()) {
-                auto polys = edges_to_polylines(hidden_sharp, LineType::HiddenSharp, identity);
-                result.curves.insert(result.curves.end(), polys.begin(), polys.end());
-            }
-
-            if (options.compute_smooth) {
-                TopoDS_Shape hidden_smooth = hlr_to_shape.Rg1LineHCompound();
-                if (!hidden_smooth.IsNull()) {
-                    auto polys = edges_to_polylines(hidden_smooth, LineType::HiddenSmooth, identity);
-                    result.curves.insert(result.curves.end(), polys.begin(), polys.end());
-                }
-            }
-
-            if (options.compute_outlines) {
-                TopoDS_Shape hidden_outline = hlr_to_shape.OutLineHCompound();
-                if (!hidden_outline.IsNull()) {
-                    auto polys = edges_to_polylines(hidden_outline, LineType::HiddenOutline, identity);
-                    result.curves.insert(result.curves.end(), polys.begin(), polys.end());
-                }
-            }
-        }
-
-        result.scale = 1.0;
-
-    } catch (...) {
-        // Return empty result on failure
+    // Use polygon-based HLR if requested (faster but less accurate)
+    if (options.use_poly_algo) {
+        if (!prepare_poly(shape, options.poly_deflection)) return HLRResult{};
+        return hlr_poly(s, compute_bbox(s), direction);
     }
 
-    return result;
+    return hlr_exact(s, compute_bbox(s), direction, options);
 }
 
 HLRResult compute_hlr_poly(const OcctShape& shape, ViewDirection view, double deflection) {
-    HLRResult result;
     const TopoDS_Shape& s = get_shape(shape);
+    if (s.IsNull()) return HLRResult{};
 
-    if (s.IsNull()) return result;
-
-    try {
-        // Tessellate first
-        BRepMesh_IncrementalMesh mesh(s, deflection);
-
-        // Get view direction
-        Vector3D dir = view_direction_vector(view);
-
-        // Create projector
-        HLRAlgo_Projector projector = create_projector(dir, Point3D{0, 0, 0}, false);
-
-        // Use polygon-based HLR (faster)
-        Handle(HLRBRep_PolyAlgo) poly_hlr = new HLRBRep_PolyAlgo();
-        poly_hlr->Load(s);
-        poly_hlr->Projector(projector);
-        poly_hlr->Update();
-
-        // Extract results
-        HLRBRep_PolyHLRToShape poly_to_shape;
-        poly_to_shape.Update(poly_hlr);
-
-        gp_Trsf identity;
-
-        // Visible edges
-        TopoDS_Shape visible = poly_to_shape.VCompound();
-        if (!visible.IsNull()) {
-            auto polys = edges_to_polylines(visible, LineType::Visible, identity);
-            result.curves.insert(result.curves.end(), polys.begin(), polys.end());
-        }
-
-        // Hidden edges
-        TopoDS_Shape hidden = poly_to_shape.HCompound();
-        if (!hidden.IsNull()) {
-            auto polys = edges_to_polylines(hidden, LineType::Hidden, identity);
-            result.curves.insert(result.curves.end(), polys.begin(), polys.end());
-        }
-
-        // Outlines
-        TopoDS_Shape outline = poly_to_shape.OutLineVCompound();
-        if (!outline.IsNull()) {
-            auto polys = edges_to_polylines(outline, LineType::VisibleOutline, identity);
-            result.curves.insert(result.curves.end(), polys.begin(), polys.end());
-        }
-
-        result.view_box = compute_bbox(s);
-        result.scale = 1.0;
-
-    } catch (...) {
-        // Return empty result on failure
-    }
+    // Tessellate first
+    if (!prepare_poly(shape, deflection)) return HLRResult{};
 
-    return result;
+    return hlr_poly(s, compute_bbox(s), view_direction_vector(view));
 }
 
 HLRResult compute_visible_lines(const OcctShape& shape, ViewDirection view) {
@@ -487,29 +589,63 @@ HLRResult compute_silhouette(const OcctShape& shape, ViewDirection view) {
 // Multi-View Projection
 //------------------------------------------------------------------------------
 
+std::vector<HLRResult> compute_hlr_views(const OcctShape& shape,
+                                         const std::vector<Vector3D>& directions,
+                                         const HLROptions& options) {
+    std::vector<HLRResult> results(directions.size());
+    const TopoDS_Shape& s = get_shape(shape);
+    if (s.IsNull() || directions.empty()) return results;
+
+    // Shared, view-independent preparation. Meshing writes into the shape,
+    // so it must finish before the hide passes read it concurrently.
+    const BoundingBox3D view_box = compute_bbox(s);
+    if (options.use_poly_algo && !prepare_poly(shape, options.poly_deflection)) {
+        return results;
+    }
+
+    run_parallel(directions.size(), options.max_workers, [&](size_t i) {
+        results[i] = options.use_poly_algo
+            ? hlr_poly(s, view_box, directions[i])
+            : hlr_exact(s, view_box, directions[i], options);
+    });
+
+    return results;
+}
+
 EngineeringViews generate_engineering_views(const OcctShape& shape, const HLROptions& options,
                                             bool all_six, bool include_isometric) {
     EngineeringViews views;
 
-    // Primary views (always computed)
-    views.front = compute_hlr_direction(shape, view_direction_vector(ViewDirection::Front), options);
-    views.top = compute_hlr_direction(shape, view_direction_vector(ViewDirection::Top), options);
-    views.right = compute_hlr_direction(shape, view_direction_vector(ViewDirection::Right), options);
-
     views.include_back = all_six;
     views.include_bottom = all_six;
     views.include_left = all_six;
 
-    // Secondary views (if requested)
+    // Primary views are always computed; secondary and isometric on request
+    std::vector<ViewDirection> requested = {
+        ViewDirection::Front, ViewDirection::Top, ViewDirection::Right
+    };
     if (all_six) {
-        views.back = compute_hlr_direction(shape, view_direction_vector(ViewDirection::Back), options);
-        views.bottom = compute_hlr_direction(shape, view_direction_vector(ViewDirection::Bottom), options);
-        views.left = compute_hlr_direction(shape, view_direction_vector(ViewDirection::Left), options);
+        requested.insert(requested.end(), {
+            ViewDirection::Back, ViewDirection::Bottom, ViewDirection::Left
+        });
     }
+    if (include_isometric) {
+        requested.push_back(ViewDirection::Isometric);
+    }
+
+    std::vector<HLRResult> results = generate_multi_view(shape, requested, options);
 
-    // Isometric view
+    views.front = std::move(results[0]);
+    views.top = std::move(results[1]);
+    views.right = std::move(results[2]);
+    size_t next = 3;
+    if (all_six) {
+        views.back = std::move(results[next++]);
+        views.bottom = std::move(results[next++]);
+        views.left = std::move(results[next++]);
+    }
     if (include_isometric) {
-        views.isometric = compute_hlr_direction(shape, view_direction_vector(ViewDirection::Isometric), options);
+        views.isometric = std::move(results[next]);
     }
 
     return views;
@@ -518,14 +654,14 @@ EngineeringViews generate_engineering_views(const OcctShape& shape, const HLROpt
 std::vector<HLRResult> generate_multi_view(const OcctShape& shape,
                                             const std::vector<ViewDirection>& views,
                                             const HLROptions& options) {
-    std::vector<HLRResult> results;
-    results.reserve(views.size());
+    std::vector<Vector3D> directions;
+    directions.reserve(views.size());
 
     for (const auto& view : views) {
-        results.push_back(compute_hlr_direction(shape, view_direction_vector(view), options));
+        directions.push_back(view_direction_vector(view));
     }
 
-    return results;
+    return compute_hlr_views(shape, directions, options);
 }
 
 //------------------------------------------------------------------------------
@@ -533,10 +669,7 @@ std::vector<HLRResult> generate_multi_view(const OcctShape& shape,
 //------------------------------------------------------------------------------
 
 SectionResult section_by_plane(const OcctShape& shape, const SectionPlane& plane) {
-    SectionResult result;
-    result.is_closed = false;
-    result.section_area = 0.0;
-    result.centroid = Point3D{0, 0, 0};
+    SectionResult result = empty_section_result();
 
     const TopoDS_Shape& s = get_shape(shape);
     if (s.IsNull()) return result;
@@ -556,47 +689,7 @@ SectionResult section_by_plane(const OcctShape& shape, const SectionPlane& plane
         TopoDS_Shape section_shape = section.Shape();
         if (section_shape.IsNull()) return result;
 
-        result.section_shape = make_shape(section_shape);
-
-        // Compute section properties
-        GProp_GProps props;
-        BRepGProp::LinearProperties(section_shape, props);
-
-        // Check if section forms closed wires
-        TopExp_Explorer wire_exp(section_shape, TopAbs_WIRE);
-        int wire_count = 0;
-        for (; wire_exp.More(); wire_exp.Next()) {
-            ++wire_count;
-            const TopoDS_Wire& wire = TopoDS::Wire(wire_exp.Current());
-            if (wire.Closed()) {
-                result.is_closed = true;
-            }
-        }
-
-        // If closed, compute area
-        if (result.is_closed && wire_count > 0) {
-            // Try to create a face from the wire(s)
-            wire_exp.Init(section_shape, TopAbs_WIRE);
-            if (wire_exp.More()) {
-                const TopoDS_Wire& wire = TopoDS::Wire(wire_exp.Current());
-                try {
-                    BRepBuilderAPI_MakeFace face_maker(cutting_plane, wire);
-                    if (face_maker.IsDone()) {
-                        GProp_GProps face_props;
-                        BRepGProp::SurfaceProperties(face_maker.Face(), face_props);
-                        result.section_area = face_props.Mass();
-                        gp_Pnt cg = face_props.CentreOfMass();
-                        result.centroid = from_gp_pnt(cg);
-                    }
-                } catch (...) {
-                    // Face creation failed
-                }
-            }
-        }
-
-        // Create 2D outlines
-        gp_Trsf identity;
-        result.outlines = edges_to_polylines(section_shape, LineType::Visible, identity);
+        fill_section_result(result, section_shape, cutting_plane);
 
     } catch (...) {
         // Return empty result on failure
@@ -619,26 +712,111 @@ SectionResult section_at_z(const OcctShape& shape, double z) {
 
 std::vector<SectionResult> sections_parallel(const OcctShape& shape, const Vector3D& normal,
                                               double start, double end, int count) {
-    std::vector<SectionResult> results;
-    results.reserve(count);
+    if (count <= 0) return {};
 
-    if (count <= 0) return results;
+    // Planes pass through normal * offset, i.e. at offset * |normal| along
+    // the unit normal
+    double length = std::sqrt(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+    if (length < 1e-10) length = 1.0;  // to_gp_dir falls back to +Z
 
     double step = (count > 1) ? (end - start) / (count - 1) : 0.0;
 
+    std::vector<double> offsets;
+    offsets.reserve(count);
     for (int i = 0; i < count; ++i) {
-        double offset = start + i * step;
+        offsets.push_back((start + i * step) * length);
+    }
 
-        // Point on plane at offset distance along normal
-        Point3D point{
-            normal.x * offset,
-            normal.y * offset,
-            normal.z * offset
-        };
+    return sections_at_offsets(shape, normal, offsets);
+}
 
-        results.push_back(section_by_plane(shape, SectionPlane{point, normal}));
+std::vector<SectionResult> sections_at_offsets(const OcctShape& shape, const Vector3D& normal,
+                                               const std::vector<double>& offsets,
+                                               unsigned max_workers) {
+    std::vector<SectionResult> results;
+    results.reserve(offsets.size());
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        results.push_back(empty_section_result());
     }
 
+    const TopoDS_Shape& s = get_shape(shape);
+    if (s.IsNull() || offsets.empty()) return results;
+
+    const gp_Dir dir = to_gp_dir(normal);
+    auto plane_at = [&dir](double offset) {
+        return gp_Pln(gp_Pnt(dir.X() * offset, dir.Y() * offset, dir.Z() * offset), dir);
+    };
+
+    TopTools_IndexedMapOfShape faces;
+    TopExp::MapShapes(s, TopAbs_FACE, faces);
+
+    // Wires and edges have no faces to cull; cut them plane by plane (the
+    // plain section may update the input's tolerances, so not concurrently)
+    if (faces.IsEmpty()) {
+        for (size_t i = 0; i < offsets.size(); ++i) {
+            gp_Pln pln = plane_at(offsets[i]);
+            results[i] = section_by_plane(shape, SectionPlane{
+                from_gp_pnt(pln.Location()), Vector3D{dir.X(), dir.Y(), dir.Z()}
+            });
+        }
+        return results;
+    }
+
+    // Face extents along the normal (boxes include tolerances), by start
+    std::vector<FaceSpan> spans;
+    spans.reserve(faces.Extent());
+    for (int i = 1; i <= faces.Extent(); ++i) {
+        Bnd_Box box;
+        BRepBndLib::Add(faces(i), box);
+        if (box.IsVoid()) continue;
+
+        double xmin, ymin, zmin, xmax, ymax, zmax;
+        box.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+
+        // Extremes of the box along dir: pick the corner per axis by sign
+        double lo = (dir.X() > 0 ? xmin : xmax) * dir.X()
+                  + (dir.Y() > 0 ? ymin : ymax) * dir.Y()
+                  + (dir.Z() > 0 ? zmin : zmax) * dir.Z();
+        double hi = (dir.X() > 0 ? xmax : xmin) * dir.X()
+                  + (dir.Y() > 0 ? ymax : ymin) * dir.Y()
+                  + (dir.Z() > 0 ? zmax : zmin) * dir.Z();
+        spans.push_back(FaceSpan{lo, hi, i});
+    }
+    std::sort(spans.begin(), spans.end(),
+              [](const FaceSpan& a, const FaceSpan& b) { return a.lo < b.lo; });
+
+    // Sweep the planes in offset order, keeping the faces whose span the
+    // current plane lies in
+    std::vector<size_t> order(offsets.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::sort(order.begin(), order.end(),
+              [&offsets](size_t a, size_t b) { return offsets[a] < offsets[b]; });
+
+    const double tol = Precision::Confusion();
+    std::vector<std::vector<int>> candidates(offsets.size());
+    std::vector<const FaceSpan*> active;
+    size_t next = 0;
+    for (size_t plane : order) {
+        const double d = offsets[plane];
+        while (next < spans.size() && spans[next].lo <= d + tol) {
+            active.push_back(&spans[next++]);
+        }
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [d, tol](const FaceSpan* span) { return span->hi < d - tol; }),
+                     active.end());
+
+        candidates[plane].reserve(active.size());
+        for (const FaceSpan* span : active) {
+            candidates[plane].push_back(span->face);
+        }
+        // Keep the shape's face order so edge order matches section_by_plane
+        std::sort(candidates[plane].begin(), candidates[plane].end());
+    }
+
+    run_parallel(offsets.size(), max_workers, [&](size_t i) {
+        results[i] = section_faces(faces, candidates[i], plane_at(offsets[i]));
+    });
+
     return results;
 }
 
@@ -1274,6 +1452,45 @@ std::string hlr_to_dxf(const HLRResult& hlr) {
     return dxf.str();
 }
 
+bool write_hlr_drawing(const HLRResult& hlr, DrawingWriter& writer, bool visible_only) {
+    auto layer_of = [](LineType type) {
+        switch (type) {
+            case LineType::Hidden:
+            case LineType::HiddenSharp:
+            case LineType::HiddenSmooth:
+            case LineType::HiddenOutline:
+            case LineType::HiddenSewn:
+                return DrawingLayer::Hidden;
+            default:
+                return DrawingLayer::Visible;
+        }
+    };
+
+    writer.begin(hlr.view_box.min.x, hlr.view_box.min.y, hlr.view_box.max.x, hlr.view_box.max.y);
+
+    for (const auto& line : hlr.lines) {
+        DrawingLayer layer = layer_of(line.type);
+        if (visible_only && layer == DrawingLayer::Hidden) continue;
+        writer.line(layer, line.x1, line.y1, line.x2, line.y2);
+    }
+
+    std::vector<double> points;
+    for (const auto& curve : hlr.curves) {
+        DrawingLayer layer = layer_of(curve.type);
+        if (visible_only && layer == DrawingLayer::Hidden) continue;
+        if (curve.points.size() < 2) continue;
+
+        points.clear();
+        for (const auto& p : curve.points) {
+            points.push_back(p.first);
+            points.push_back(p.second);
+        }
+        writer.polyline(layer, points.data(), curve.points.size());
+    }
+
+    return writer.finish();
+}
+
 HLRResult fit_to_view(const HLRResult& hlr, double width, double height, double margin) {
     HLRResult result = hlr;
 
@@ -1409,4 +1626,83 @@ HLRResult simplify_hlr(const HLRResult& hlr, double min_length) {
     return result;
 }
 
+HLRResult simplify_hlr(const HLRResult& hlr, const HlrCleanupOptions& options) {
+    auto is_hidden = [](LineType type) {
+        return type == LineType::Hidden ||
+               type == LineType::HiddenSharp ||
+               type == LineType::HiddenSmooth ||
+               type == LineType::HiddenOutline ||
+               type == LineType::HiddenSewn;
+    };
+
+    std::vector<HlrStroke> strokes;
+    strokes.reserve(hlr.lines.size() + hlr.curves.size());
+    for (const auto& line : hlr.lines) {
+        HlrStroke stroke;
+        stroke.points = {line.x1, line.y1, line.x2, line.y2};
+        stroke.line_type = static_cast<int32_t>(line.type);
+        stroke.hidden = is_hidden(line.type);
+        strokes.push_back(std::move(stroke));
+    }
+    for (const auto& curve : hlr.curves) {
+        HlrStroke stroke;
+        stroke.points.reserve(2 * curve.points.size());
+        for (const auto& p : curve.points) {
+            stroke.points.push_back(p.first);
+            stroke.points.push_back(p.second);
+        }
+        stroke.line_type = static_cast<int32_t>(curve.type);
+        stroke.hidden = is_hidden(curve.type);
+        strokes.push_back(std::move(stroke));
+    }
+
+    HlrCleanupResult cleaned = cleanup_hlr_strokes(strokes, options);
+
+    HLRResult result;
+    result.view_box = hlr.view_box;
+    result.scale = hlr.scale;
+
+    for (const auto& stroke : cleaned.strokes) {
+        const LineType type = static_cast<LineType>(stroke.line_type);
+        const size_t n = stroke.points.size() / 2;
+        if (n == 2 && !stroke.closed) {
+            result.lines.push_back(Line2D{stroke.points[0], stroke.points[1],
+                                          stroke.points[2], stroke.points[3], type, -1, -1});
+            continue;
+        }
+        Polyline2D polyline;
+        polyline.type = type;
+        polyline.source_edge = -1;
+        polyline.source_face = -1;
+        for (size_t i = 0; i < n; ++i) {
+            polyline.points.push_back({stroke.points[2 * i], stroke.points[2 * i + 1]});
+        }
+        if (stroke.closed) polyline.points.push_back(polyline.points.front());
+        result.curves.push_back(std::move(polyline));
+    }
+
+    for (const auto& arc : cleaned.arcs) {
+        double sweep = arc.end_angle - arc.start_angle;
+        if (!arc.full_circle) {
+            if (arc.ccw && sweep < 0.0) sweep += 2.0 * M_PI;
+            if (!arc.ccw && sweep > 0.0) sweep -= 2.0 * M_PI;
+        }
+        const double sagitta = std::min(options.tolerance, arc.radius);
+        const double step = 2.0 * std::acos(1.0 - sagitta / arc.radius);
+        const int segments = std::max(2, static_cast<int>(std::ceil(std::abs(sweep) / step)));
+
+        Polyline2D polyline;
+        polyline.type = static_cast<LineType>(arc.line_type);
+        polyline.source_edge = -1;
+        polyline.source_face = -1;
+        for (int i = 0; i <= segments; ++i) {
+            double t = arc.start_angle + sweep * i / segments;
+            polyline.points.push_back({arc.cx + arc.radius * std::cos(t), arc.cy + arc.radius * std::sin(t)});
+        }
+        result.curves.push_back(std::move(polyline));
+    }
+
+    return result;
+}
+
 } // namespace cadhy::projection
@@ -18,6 +18,7 @@
 
 use crate::error::{OcctError, OcctResult};
 use crate::ffi::ffi;
+use crate::progress::OperationProgress;
 use crate::shape::Shape;
 
 /// Detailed shape analysis result
@@ -205,6 +206,62 @@ impl Analysis {
         }
     }
 
+    /// [`fix_shape_with_options`](Self::fix_shape_with_options) reporting
+    /// into `progress`
+    pub fn fix_shape_with_progress(
+        shape: &Shape,
+        options: &FixOptions,
+        progress: &OperationProgress,
+    ) -> OcctResult<Shape> {
+        let result = ffi::fix_shape_advanced_with_progress(
+            shape.inner(),
+            options.fix_small_faces,
+            options.fix_small_edges,
+            options.fix_degenerated,
+            options.fix_self_intersection,
+            options.tolerance,
+            progress.inner(),
+        );
+        Shape::from_ptr(result).map_err(|_| {
+            progress.failure(OcctError::OperationFailed(
+                "Failed to fix shape".to_string(),
+            ))
+        })
+    }
+
+    /// Sew faces and shells sharing boundaries (within `tolerance`) into
+    /// shells, or solids where they close up
+    pub fn sew(shapes: &[&Shape], tolerance: f64) -> OcctResult<Shape> {
+        let shape_ptrs: Vec<*const ffi::OcctShape> = shapes
+            .iter()
+            .map(|s| s.inner() as *const ffi::OcctShape)
+            .collect();
+        Shape::from_ptr(ffi::sew_shapes(&shape_ptrs, tolerance))
+            .map_err(|_| OcctError::OperationFailed("Failed to sew shapes".to_string()))
+    }
+
+    /// [`sew`](Self::sew) reporting into `progress`
+    pub fn sew_with_progress(
+        shapes: &[&Shape],
+        tolerance: f64,
+        progress: &OperationProgress,
+    ) -> OcctResult<Shape> {
+        let shape_ptrs: Vec<*const ffi::OcctShape> = shapes
+            .iter()
+            .map(|s| s.inner() as *const ffi::OcctShape)
+            .collect();
+        Shape::from_ptr(ffi::sew_shapes_with_progress(
+            &shape_ptrs,
+            tolerance,
+            progress.inner(),
+        ))
+        .map_err(|_| {
+            progress.failure(OcctError::OperationFailed(
+                "Failed to sew shapes".to_string(),
+            ))
+        })
+    }
+
     /// Calculate minimum distance between two shapes
     ///
     /// Returns the minimum distance and the closest points on each shape.
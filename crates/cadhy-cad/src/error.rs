@@ -56,6 +56,12 @@ pub enum OcctError {
     #[error("Operation failed: {0}")]
     OperationFailed(String),
 
+    #[error("Operation cancelled")]
+    Cancelled,
+
+    #[error("Operation timed out")]
+    TimedOut,
+
     #[error("Transform failed: {0}")]
     TransformFailed(String),
 
@@ -54,6 +54,51 @@ pub mod ffi {
         pub faces: Vec<FaceInfo>,
     }
 
+    /// Buffer sizes for the flat (GPU-ready) mesh transfer
+    #[derive(Debug, Clone, Copy, Default)]
+    pub struct FlatMeshSizes {
+        pub vertex_count: u64,
+        pub triangle_count: u64,
+        /// Length of the interleaved vertex buffer (6 floats per vertex)
+        pub vertex_floats: u64,
+        /// Length of the index buffer (3 per triangle)
+        pub index_count: u64,
+    }
+
+    /// Simulated vertex cache efficiency before/after `optimize_flat_mesh`.
+    /// ACMR = vertex transforms per triangle, ATVR = transforms per vertex
+    /// (1.0 is optimal).
+    #[derive(Debug, Clone, Copy, Default)]
+    pub struct RenderCacheReport {
+        pub acmr_before: f64,
+        pub atvr_before: f64,
+        pub acmr_after: f64,
+        pub atvr_after: f64,
+    }
+
+    /// One level of detail from `tessellate_lods`
+    #[derive(Debug)]
+    pub struct LodLevelResult {
+        pub mesh: MeshResult,
+        /// Requested linear deflection
+        pub deflection: f64,
+        /// Estimated deviation from the exact surface
+        pub error: f64,
+    }
+
+    /// Triangulation cache counters (process-wide)
+    #[derive(Debug, Clone, Copy, Default)]
+    pub struct MeshCacheStats {
+        /// Requests served from an existing triangulation
+        pub hits: u64,
+        /// Requests that had to run the mesher
+        pub misses: u64,
+        /// Faces whose triangulation was carried over from an edit's source on a miss
+        pub reused_faces: u64,
+        /// Faces the mesher had to triangulate on a miss
+        pub meshed_faces: u64,
+    }
+
     /// Information about a face in the shape topology
     #[derive(Debug, Clone)]
     pub struct FaceInfo {
@@ -171,6 +216,91 @@ pub mod ffi {
         pub ccw: bool,
     }
 
+    /// Options for boolean_batch (mirrors cadhy::boolean::BooleanOptions)
+    #[derive(Debug, Clone, Copy)]
+    pub struct BooleanOptionsFFI {
+        /// Tolerance for coincident geometry
+        pub fuzzy_tolerance: f64,
+        /// Run the intersection phases in parallel
+        pub parallel: bool,
+        /// Pre-filter shape pairs with oriented bounding boxes
+        pub use_obb: bool,
+        /// Check for inverted solids
+        pub check_inverted: bool,
+        /// Keep the input shapes unmodified
+        pub non_destructive: bool,
+        /// Glue mode for shapes that only touch
+        pub glue: bool,
+    }
+
+    /// Pre-flight outcome of a two-shape boolean
+    #[derive(Debug, Clone, Copy, Default)]
+    pub struct BooleanPreflightReport {
+        /// 0=Full, 1=Disjoint, 2=ToolInside, 3=ArgumentInside
+        pub path: i32,
+        /// Compound bodies settled without boolean work
+        pub passthrough: u32,
+    }
+
+    /// Old-to-new map for one boolean input's faces or edges (TopExp::MapShapes
+    /// indices); the targets of source i are targets[offsets[i]..offsets[i + 1]]
+    #[derive(Debug, Clone, Default)]
+    pub struct SubShapeMapFFI {
+        /// Per source: 0=Removed, 1=Unchanged, 2=Modified
+        pub fates: Vec<u8>,
+        /// Prefix offsets into targets (sources + 1 entries)
+        pub offsets: Vec<u32>,
+        /// Result sub-shape indices
+        pub targets: Vec<u32>,
+    }
+
+    /// Face/edge provenance of a boolean, composed through the final unify
+    #[derive(Debug, Clone, Default)]
+    pub struct BooleanHistoryFFI {
+        /// Pre-flight path: 0=Full, 1=Disjoint, 2=ToolInside, 3=ArgumentInside
+        pub path: i32,
+        /// Number of faces in the result
+        pub result_faces: u32,
+        /// Number of edges in the result
+        pub result_edges: u32,
+        /// Faces of shape1
+        pub argument_faces: SubShapeMapFFI,
+        /// Edges of shape1
+        pub argument_edges: SubShapeMapFFI,
+        /// Faces of shape2
+        pub tool_faces: SubShapeMapFFI,
+        /// Edges of shape2
+        pub tool_edges: SubShapeMapFFI,
+    }
+
+    /// One level of the fuse_many tree (level 0 = leaves)
+    #[derive(Debug, Clone, Copy, Default)]
+    pub struct FuseLevelStats {
+        /// Tree nodes processed at this level
+        pub nodes: u32,
+        /// Fuse operations run
+        pub booleans: u32,
+        /// Parts carried up without boolean work (no box overlap)
+        pub passthrough: u32,
+        /// Wall time of the level
+        pub seconds: f64,
+    }
+
+    /// Timing breakdown of a hierarchical fuse_many
+    #[derive(Debug, Clone, Default)]
+    pub struct FuseTreeStats {
+        /// Non-null input shapes
+        pub inputs: u32,
+        /// Per-level breakdown, leaves first
+        pub levels: Vec<FuseLevelStats>,
+        /// Bounding boxes and tree build
+        pub bounds_seconds: f64,
+        /// Final same-domain unify
+        pub unify_seconds: f64,
+        /// Whole operation
+        pub total_seconds: f64,
+    }
+
     /// Tessellated points for spline/complex curves
     #[derive(Debug, Clone)]
     pub struct TessPoint2D {
@@ -205,10 +335,40 @@ pub mod ffi {
         pub num_lines: i32,
         /// Number of arcs/circles extracted
         pub num_arcs: i32,
+        /// Number of ellipses/elliptical arcs extracted
+        pub num_ellipses: i32,
         /// Number of splines/polylines extracted
         pub num_polylines: i32,
     }
 
+    /// Exact HLR result cache counters and occupancy (process-wide)
+    #[derive(Debug, Clone, Copy, Default)]
+    pub struct HlrCacheStats {
+        /// Projections served from the cache
+        pub hits: u64,
+        /// Projections that had to run HLR
+        pub misses: u64,
+        /// Entries dropped to stay under the capacity
+        pub evictions: u64,
+        /// Entries currently cached
+        pub entries: u64,
+        /// Approximate memory held by the entries
+        pub bytes: u64,
+        /// Memory cap in bytes
+        pub capacity: u64,
+    }
+
+    /// Exact HLR cost estimate for choosing between preview and exact
+    #[derive(Debug, Clone)]
+    pub struct HlrCostEstimate {
+        pub num_faces: i32,
+        pub num_edges: i32,
+        /// Relative cost (faces x edges)
+        pub work: f64,
+        /// Whether a polygonal preview should be shown before the exact result
+        pub use_preview: bool,
+    }
+
     // ============================================================
     // SECTION VIEW WITH HATCHING
     // ============================================================
@@ -262,6 +422,23 @@ pub mod ffi {
         pub num_hatch_lines: i32,
     }
 
+    /// Summary of an exact plane section (cadhy::projection::SectionResult)
+    #[derive(Debug, Clone)]
+    pub struct PlaneSectionFFI {
+        /// Number of outline polylines (one per section edge)
+        pub outlines: u32,
+        /// Total length of the outlines
+        pub outline_length: f64,
+        /// Whether the section forms closed wires
+        pub is_closed: bool,
+        /// Area of the section (0 unless closed)
+        pub area: f64,
+        /// Centroid of the section
+        pub centroid_x: f64,
+        pub centroid_y: f64,
+        pub centroid_z: f64,
+    }
+
     /// Shape analysis result for diagnostics
     #[derive(Debug, Clone)]
     pub struct ShapeAnalysisResult {
@@ -336,7 +513,7 @@ pub mod ffi {
         pub start_vertex: u32,
         /// End vertex index
         pub end_vertex: u32,
-        /// Edge length
+        /// Edge length (exact for lines and circles, from the tessellation otherwise)
         pub length: f64,
         /// Is edge degenerated (zero length)
         pub is_degenerated: bool,
@@ -394,6 +571,55 @@ pub mod ffi {
         pub edge_to_faces_offset: Vec<u32>,
     }
 
+    /// Flat topology snapshot: every array is contiguous, indexed like
+    /// TopologyResult (0-based vertex/edge/face indices), with CSR adjacency
+    #[derive(Debug)]
+    pub struct TopologySnapshot {
+        /// Vertex positions [x0, y0, z0, x1, y1, z1, ...]
+        pub vertex_positions: Vec<f64>,
+        /// Vertex tolerances
+        pub vertex_tolerances: Vec<f64>,
+        /// Edge end vertices [start0, end0, start1, end1, ...] (u32::MAX if missing)
+        pub edge_vertices: Vec<u32>,
+        /// Edge curve types (same codes as EdgeTessellation::curve_type)
+        pub edge_curve_types: Vec<i32>,
+        /// 1 for degenerated edges
+        pub edge_degenerated: Vec<u8>,
+        /// Face surface types (same codes as FaceTopologyInfo::surface_type)
+        pub face_surface_types: Vec<i32>,
+        /// Face areas
+        pub face_areas: Vec<f64>,
+        /// Face mass centers [x0, y0, z0, ...]
+        pub face_centers: Vec<f64>,
+        /// Face normals at the UV mid-point [x0, y0, z0, ...]
+        pub face_normals: Vec<f64>,
+        /// 1 for reversed faces
+        pub face_reversed: Vec<u8>,
+        /// Vertex to edge adjacency (CSR data)
+        pub vertex_to_edges: Vec<u32>,
+        /// Offsets into vertex_to_edges (num_vertices + 1)
+        pub vertex_to_edges_offset: Vec<u32>,
+        /// Edge to face adjacency (CSR data)
+        pub edge_to_faces: Vec<u32>,
+        /// Offsets into edge_to_faces (num_edges + 1)
+        pub edge_to_faces_offset: Vec<u32>,
+        /// Face to boundary edge adjacency (CSR data, seam edges twice)
+        pub face_to_edges: Vec<u32>,
+        /// Offsets into face_to_edges (num_faces + 1)
+        pub face_to_edges_offset: Vec<u32>,
+    }
+
+    /// Discretised edges in one flat buffer
+    #[derive(Debug)]
+    pub struct EdgePolylines {
+        /// Points [x0, y0, z0, x1, y1, z1, ...] of all requested edges
+        pub points: Vec<f64>,
+        /// Point offsets per requested edge (requested count + 1)
+        pub offsets: Vec<u32>,
+        /// Edge lengths (exact for lines and circles, from the points otherwise)
+        pub lengths: Vec<f64>,
+    }
+
     // ============================================================
     // EXPLODE/IMPLODE VIEW DATA STRUCTURES
     // ============================================================
@@ -446,6 +672,40 @@ pub mod ffi {
         /// Opaque type representing TopoDS_Shape
         type OcctShape;
 
+        /// Opaque handle to an exact HLR projection running in the background
+        type HlrJob;
+
+        /// Opaque handle to a welded mesh prepared for fast sections
+        type SectionSlicer;
+
+        /// Opaque progress/cancellation handle for long operations
+        type OperationProgress;
+
+        // ============================================================
+        // PROGRESS & CANCELLATION
+        // ============================================================
+
+        /// Create a progress handle (not cancelled, no timeout)
+        fn progress_new() -> UniquePtr<OperationProgress>;
+
+        /// Request cancellation of the running (and any later) operation
+        fn progress_cancel(progress: &OperationProgress);
+
+        /// Wall-clock limit counted from now; seconds <= 0 removes it
+        fn progress_set_timeout(progress: &OperationProgress, seconds: f64);
+
+        /// Completed fraction of the current operation in [0, 1]
+        fn progress_fraction(progress: &OperationProgress) -> f64;
+
+        /// Innermost named stage of the current operation
+        fn progress_stage(progress: &OperationProgress) -> String;
+
+        /// Whether cancel was requested
+        fn progress_is_cancelled(progress: &OperationProgress) -> bool;
+
+        /// Whether the timeout has expired
+        fn progress_timed_out(progress: &OperationProgress) -> bool;
+
         // ============================================================
         // PRIMITIVE CREATION
         // ============================================================
@@ -585,6 +845,52 @@ pub mod ffi {
         /// Boolean common (intersection) of two shapes
         fn boolean_common(shape1: &OcctShape, shape2: &OcctShape) -> UniquePtr<OcctShape>;
 
+        /// Pre-flight classification of shape1 (argument) against shape2 (tool)
+        /// Returns: 0=Full, 1=Disjoint, 2=ToolInside, 3=ArgumentInside
+        fn boolean_classify(shape1: &OcctShape, shape2: &OcctShape) -> i32;
+
+        /// Fuse/cut/common (operation 0/1/2) reporting the pre-flight path taken
+        fn boolean_with_report(
+            shape1: &OcctShape,
+            shape2: &OcctShape,
+            operation: i32,
+            report: &mut BooleanPreflightReport,
+        ) -> UniquePtr<OcctShape>;
+
+        /// Fuse/cut/common (operation 0/1/2) with the old-to-new face and
+        /// edge map of both inputs
+        fn boolean_with_history(
+            shape1: &OcctShape,
+            shape2: &OcctShape,
+            operation: i32,
+            history: &mut BooleanHistoryFFI,
+        ) -> UniquePtr<OcctShape>;
+
+        /// One boolean between an argument list and a tool list
+        /// operation: 0=Fuse (tools may be empty), 1=Cut, 2=Common
+        fn boolean_batch(
+            arguments: &[*const OcctShape],
+            tools: &[*const OcctShape],
+            operation: i32,
+            options: &BooleanOptionsFFI,
+        ) -> UniquePtr<OcctShape>;
+
+        /// Fuse many shapes through a bounding-box tree (disjoint clusters
+        /// never meet in a boolean); fills `stats` with the level timings
+        fn boolean_fuse_many(
+            shapes: &[*const OcctShape],
+            options: &BooleanOptionsFFI,
+            stats: &mut FuseTreeStats,
+        ) -> UniquePtr<OcctShape>;
+
+        /// Fuse/cut/common (operation 0/1/2) reporting into `progress`
+        fn boolean_with_progress(
+            shape1: &OcctShape,
+            shape2: &OcctShape,
+            operation: i32,
+            progress: &OperationProgress,
+        ) -> UniquePtr<OcctShape>;
+
         // ============================================================
         // MODIFICATION OPERATIONS
         // ============================================================
@@ -627,6 +933,15 @@ pub mod ffi {
             continuity: i32,
         ) -> UniquePtr<OcctShape>;
 
+        /// Advanced fillet reporting into `progress`
+        fn fillet_edges_advanced_with_progress(
+            shape: &OcctShape,
+            edge_indices: &[i32],
+            radii: &[f64],
+            continuity: i32,
+            progress: &OperationProgress,
+        ) -> UniquePtr<OcctShape>;
+
         /// Apply chamfer with two different distances per edge
         fn chamfer_edges_two_distances(
             shape: &OcctShape,
@@ -869,6 +1184,63 @@ pub mod ffi {
         /// Tessellate with angular control
         fn tessellate_with_angle(shape: &OcctShape, deflection: f64, angle: f64) -> MeshResult;
 
+        /// Tessellate with vertices shared across B-rep edges.
+        /// Vertices at edges meeting above crease_angle (radians) are kept
+        /// separate; normals are oriented outward and averaged per vertex.
+        fn tessellate_welded(shape: &OcctShape, deflection: f64, crease_angle: f64) -> MeshResult;
+
+        /// Tessellate a copy of the shape with per-face deflection:
+        /// curvature_factor * 1% of the smaller of each face's minimum radius
+        /// of curvature and its size, clamped to [min_deflection, max_deflection]
+        fn tessellate_adaptive(
+            shape: &OcctShape,
+            min_deflection: f64,
+            max_deflection: f64,
+            curvature_factor: f64,
+        ) -> MeshResult;
+
+        /// Levels of detail, finest first: the shape is meshed once at the
+        /// finest deflection and coarser levels are simplified from it.
+        /// With optimize_for_rendering, each level is also reordered for the
+        /// GPU vertex cache (face groups kept contiguous).
+        fn tessellate_lods(
+            shape: &OcctShape,
+            deflections: &[f64],
+            optimize_for_rendering: bool,
+        ) -> Vec<LodLevelResult>;
+
+        /// Mesh the shape (or reuse its cached triangulation) and report the
+        /// buffer sizes `fill_flat_mesh` expects
+        fn flat_mesh_sizes(shape: &OcctShape, deflection: f64, angle: f64) -> FlatMeshSizes;
+
+        /// Fill caller-allocated buffers with interleaved f32 position/normal
+        /// data, triangle indices and per-triangle face ids.
+        /// Returns false if the buffer sizes don't match `flat_mesh_sizes`.
+        fn fill_flat_mesh(
+            shape: &OcctShape,
+            deflection: f64,
+            angle: f64,
+            vertex_data: &mut [f32],
+            indices: &mut [u32],
+            face_ids: &mut [u32],
+        ) -> bool;
+
+        /// Reorder flat mesh buffers in place for the GPU vertex cache,
+        /// overdraw and vertex fetch. With group_by_face, each face's
+        /// triangles stay contiguous. face_ids may be empty.
+        fn optimize_flat_mesh(
+            vertex_data: &mut [f32],
+            indices: &mut [u32],
+            face_ids: &mut [u32],
+            group_by_face: bool,
+        ) -> RenderCacheReport;
+
+        /// Get triangulation cache hit/miss counters
+        fn mesh_cache_stats() -> MeshCacheStats;
+
+        /// Reset triangulation cache counters
+        fn reset_mesh_cache_stats();
+
         // ============================================================
         // BREP I/O
         // ============================================================
@@ -892,6 +1264,12 @@ pub mod ffi {
         /// Read STEP file and return shape
         fn read_step(filename: &str) -> UniquePtr<OcctShape>;
 
+        /// Read STEP file reporting the transfer into `progress`
+        fn read_step_with_progress(
+            filename: &str,
+            progress: &OperationProgress,
+        ) -> UniquePtr<OcctShape>;
+
         /// Write shape to STEP file
         fn write_step(shape: &OcctShape, filename: &str) -> bool;
 
@@ -946,6 +1324,27 @@ pub mod ffi {
             tolerance: f64,
         ) -> UniquePtr<OcctShape>;
 
+        /// fix_shape_advanced reporting into `progress`
+        fn fix_shape_advanced_with_progress(
+            shape: &OcctShape,
+            fix_small_faces: bool,
+            fix_small_edges: bool,
+            fix_degenerated: bool,
+            fix_self_intersection: bool,
+            tolerance: f64,
+            progress: &OperationProgress,
+        ) -> UniquePtr<OcctShape>;
+
+        /// Sew faces and shells into a shell/solid
+        fn sew_shapes(shapes: &[*const OcctShape], tolerance: f64) -> UniquePtr<OcctShape>;
+
+        /// sew_shapes reporting into `progress`
+        fn sew_shapes_with_progress(
+            shapes: &[*const OcctShape],
+            tolerance: f64,
+            progress: &OperationProgress,
+        ) -> UniquePtr<OcctShape>;
+
         // ============================================================
         // ADVANCED DISTANCE MEASUREMENT
         // ============================================================
@@ -1028,6 +1427,99 @@ pub mod ffi {
             deflection: f64,
         ) -> HLRProjectionResultV2;
 
+        /// compute_hlr_projection_v2 reporting into `progress`; stops between
+        /// HLR phases (empty result)
+        fn compute_hlr_projection_with_progress(
+            shape: &OcctShape,
+            dir_x: f64,
+            dir_y: f64,
+            dir_z: f64,
+            up_x: f64,
+            up_y: f64,
+            up_z: f64,
+            scale: f64,
+            deflection: f64,
+            progress: &OperationProgress,
+        ) -> HLRProjectionResultV2;
+
+        /// Exact HLR result cache statistics
+        fn hlr_cache_stats() -> HlrCacheStats;
+
+        /// Reset the HLR cache hit/miss/eviction counters
+        fn reset_hlr_cache_stats();
+
+        /// Set the HLR cache memory cap (evicts as needed)
+        fn set_hlr_cache_capacity(bytes: u64);
+
+        /// Drop all cached HLR results
+        fn clear_hlr_cache();
+
+        /// Remove overlaps, join, arc-fit and simplify the lines and polylines
+        /// of an HLR V2 result within `tolerance`
+        fn simplify_hlr_projection_v2(
+            result: &HLRProjectionResultV2,
+            tolerance: f64,
+        ) -> HLRProjectionResultV2;
+
+        /// Stream an HLR V2 projection to an SVG/DXF file
+        /// format: 0=SVG, 1=DXF R12, 2=DXF R2000
+        fn write_hlr_projection_drawing(
+            shape: &OcctShape,
+            dir_x: f64,
+            dir_y: f64,
+            dir_z: f64,
+            up_x: f64,
+            up_y: f64,
+            up_z: f64,
+            scale: f64,
+            deflection: f64,
+            filename: &str,
+            format: i32,
+            precision: i32,
+            quantum: f64,
+        ) -> bool;
+
+        /// Estimate exact HLR cost from face/edge counts
+        fn estimate_hlr_cost(shape: &OcctShape) -> HlrCostEstimate;
+
+        /// Fast polygonal HLR (HLRBRep_PolyAlgo) for previews; reuses the
+        /// shape's triangulation when present
+        fn compute_hlr_projection_poly(
+            shape: &OcctShape,
+            dir_x: f64,
+            dir_y: f64,
+            dir_z: f64,
+            up_x: f64,
+            up_y: f64,
+            up_z: f64,
+            scale: f64,
+            deflection: f64,
+        ) -> HLRProjectionResultV2;
+
+        /// Start exact HLR (as compute_hlr_projection_v2) on a background thread.
+        /// Dropping the job cancels it.
+        fn start_hlr_projection(
+            shape: &OcctShape,
+            dir_x: f64,
+            dir_y: f64,
+            dir_z: f64,
+            up_x: f64,
+            up_y: f64,
+            up_z: f64,
+            scale: f64,
+            deflection: f64,
+        ) -> UniquePtr<HlrJob>;
+
+        /// Whether the background HLR job has finished or was cancelled
+        fn hlr_job_is_ready(job: &HlrJob) -> bool;
+
+        /// Cancel a background HLR job
+        fn hlr_job_cancel(job: &HlrJob);
+
+        /// Wait for a background HLR job and take its result
+        /// (empty if cancelled or already taken)
+        fn hlr_job_take_result(job: &HlrJob) -> HLRProjectionResultV2;
+
         /// Compute a section cut of a shape with a plane
         fn compute_section(
             shape: &OcctShape,
@@ -1039,6 +1531,27 @@ pub mod ffi {
             normal_z: f64,
         ) -> UniquePtr<OcctShape>;
 
+        /// Exact section with the plane through origin, perpendicular to normal
+        fn section_by_plane(
+            shape: &OcctShape,
+            origin_x: f64,
+            origin_y: f64,
+            origin_z: f64,
+            normal_x: f64,
+            normal_y: f64,
+            normal_z: f64,
+        ) -> PlaneSectionFFI;
+
+        /// Exact sections with the planes perpendicular to normal at the
+        /// signed distances `offsets` from the origin, batched by face extent
+        fn sections_at_offsets(
+            shape: &OcctShape,
+            normal_x: f64,
+            normal_y: f64,
+            normal_z: f64,
+            offsets: &[f64],
+        ) -> Vec<PlaneSectionFFI>;
+
         /// Compute a section cut with hatching for technical drawings
         /// Returns section curves and hatch lines for closed regions
         fn compute_section_with_hatch(
@@ -1056,6 +1569,26 @@ pub mod ffi {
             hatch_spacing: f64,
         ) -> SectionWithHatchResult;
 
+        /// Prepare the shape's welded triangulation for fast sections
+        /// Returns null for null or unmeshable shapes
+        fn create_section_slicer(shape: &OcctShape, deflection: f64) -> UniquePtr<SectionSlicer>;
+
+        /// Approximate compute_section_with_hatch on the prepared mesh
+        fn compute_section_with_hatch_fast(
+            slicer: &SectionSlicer,
+            origin_x: f64,
+            origin_y: f64,
+            origin_z: f64,
+            normal_x: f64,
+            normal_y: f64,
+            normal_z: f64,
+            up_x: f64,
+            up_y: f64,
+            up_z: f64,
+            hatch_angle: f64,
+            hatch_spacing: f64,
+        ) -> SectionWithHatchResult;
+
         // ============================================================
         // TOPOLOGY EXTRACTION FOR INTERACTIVE SELECTION
         // ============================================================
@@ -1071,6 +1604,16 @@ pub mod ffi {
         /// This is the most comprehensive function for selection support
         fn get_full_topology(shape: &OcctShape, edge_deflection: f64) -> TopologyResult;
 
+        /// Flat topology snapshot without edge discretisation
+        fn get_topology_snapshot(shape: &OcctShape) -> TopologySnapshot;
+
+        /// Discretise the given edges (snapshot indices) into one buffer
+        fn tessellate_edge_polylines(
+            shape: &OcctShape,
+            edge_indices: &[u32],
+            deflection: f64,
+        ) -> EdgePolylines;
+
         // ============================================================
         // EXPLODE/IMPLODE VIEW OPERATIONS
         // ============================================================
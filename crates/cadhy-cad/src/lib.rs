@@ -57,6 +57,7 @@ mod ffi;
 mod mesh;
 mod operations;
 mod primitives;
+mod progress;
 pub mod projection;
 pub mod section;
 mod shape;
@@ -80,24 +81,36 @@ pub use drawing::{
 pub use error::{OcctError, OcctResult};
 pub use export::Export;
 pub use ffi::ffi::{ExplodeResult, ExplodedPart};
-pub use mesh::{FaceInfo, MeshData, SurfaceType, Vertex3};
-pub use operations::Operations;
+pub use mesh::{
+    mesh_cache_stats, reset_mesh_cache_stats, FaceInfo, FlatMesh, LodLevel, MeshCacheStats,
+    MeshData, RenderCacheReport, SurfaceType, Vertex3,
+};
+pub use operations::{
+    BooleanHistory, BooleanOp, BooleanOptions, BooleanPath, BooleanPreflight, FuseLevelStats,
+    FuseTreeStats, Operations, ShapeFate, SubShapeMap,
+};
 pub use primitives::Primitives;
+pub use progress::OperationProgress;
 pub use projection::{
-    generate_standard_views, generate_standard_views_v2, project_shape, project_shape_v2, Arc2D,
-    BoundingBox2D, Curve2D, Curve2DType, Ellipse2D, Line2D, LineType, Point2D, Polyline2D,
-    ProjectionResult, ProjectionResultV2, ProjectionType,
+    clear_hlr_cache, estimate_hlr_cost, generate_standard_views, generate_standard_views_v2,
+    hlr_cache_stats, project_shape, project_shape_background, project_shape_preview,
+    project_shape_tiered, project_shape_v2, project_shape_v2_simplified,
+    project_shape_v2_with_progress, reset_hlr_cache_stats, set_hlr_cache_capacity,
+    write_projection_drawing, Arc2D, BoundingBox2D, Curve2D, Curve2DType, DrawingExportOptions,
+    DrawingFormat, Ellipse2D, HlrCacheStats, HlrCostEstimate, Line2D, LineType, PendingProjection,
+    Point2D, Polyline2D, ProjectionResult, ProjectionResultV2, ProjectionType, TieredProjection,
 };
 pub use section::{
     compute_section_view, compute_section_with_hatch, generate_horizontal_sections_with_hatch,
-    HatchConfig, HatchLine, HatchPattern, HatchRegion, HatchedRegion, SectionCurve, SectionPlane,
-    SectionResult, SectionWithHatchResult,
+    section_by_plane, sections_at_offsets, HatchConfig, HatchLine, HatchPattern, HatchRegion,
+    HatchedRegion, PlaneSection, SectionCurve, SectionPlane, SectionResult, SectionSlicer,
+    SectionWithHatchResult,
 };
 pub use shape::Shape;
 pub use step_io::StepIO;
 pub use topology::{
-    CurveType, EdgePoint, EdgeTessellation, FaceInfo as TopologyFaceInfo,
-    SurfaceType as TopologySurfaceType, Topology, TopologyData, VertexInfo,
+    CurveType, EdgePoint, EdgePolylines, EdgeTessellation, FaceInfo as TopologyFaceInfo,
+    SurfaceType as TopologySurfaceType, Topology, TopologyData, TopologySnapshot, VertexInfo,
 };
 
 // DXF import (conditional on feature)
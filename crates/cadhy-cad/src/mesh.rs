@@ -2,8 +2,24 @@
 //!
 //! Types for tessellated geometry output.
 
+use crate::ffi::ffi;
 use crate::ffi::ffi::MeshResult;
 
+pub use crate::ffi::ffi::{MeshCacheStats, RenderCacheReport};
+
+/// Triangulation cache counters across all shapes
+///
+/// Tessellation and mesh export reuse a shape's triangulation when it was
+/// already meshed with the same deflection parameters; `hits` counts those.
+pub fn mesh_cache_stats() -> MeshCacheStats {
+    ffi::mesh_cache_stats()
+}
+
+/// Reset the triangulation cache counters
+pub fn reset_mesh_cache_stats() {
+    ffi::reset_mesh_cache_stats()
+}
+
 /// 3D vertex with position
 #[derive(Debug, Clone, Copy, PartialEq)]
 pub struct Vertex3 {
@@ -227,3 +243,77 @@ impl MeshData {
             .collect()
     }
 }
+
+/// One level of detail from [`Shape::tessellate_lods`](crate::Shape::tessellate_lods)
+#[derive(Debug, Clone)]
+pub struct LodLevel {
+    /// Mesh of this level
+    pub mesh: MeshData,
+    /// Requested linear deflection
+    pub deflection: f64,
+    /// Estimated deviation from the exact surface (at most `deflection`)
+    pub error: f64,
+}
+
+/// GPU-ready triangle mesh filled directly by the C++ side
+///
+/// Vertex attributes are interleaved `[px, py, pz, nx, ny, nz]` in `f32`,
+/// so the buffers can be uploaded without any further conversion.
+#[derive(Debug, Clone, Default)]
+pub struct FlatMesh {
+    /// Interleaved position/normal data (`FlatMesh::STRIDE` floats per vertex)
+    pub vertex_data: Vec<f32>,
+    /// Triangle indices (3 per triangle)
+    pub indices: Vec<u32>,
+    /// Face index for each triangle (which face generated this triangle)
+    pub face_ids: Vec<u32>,
+}
+
+impl FlatMesh {
+    /// Floats per vertex in `vertex_data`
+    pub const STRIDE: usize = 6;
+
+    /// Number of vertices
+    pub fn vertex_count(&self) -> usize {
+        self.vertex_data.len() / Self::STRIDE
+    }
+
+    /// Number of triangles in the mesh
+    pub fn triangle_count(&self) -> usize {
+        self.indices.len() / 3
+    }
+
+    /// Check if mesh is empty
+    pub fn is_empty(&self) -> bool {
+        self.vertex_data.is_empty()
+    }
+
+    /// Position of vertex `i`
+    pub fn position(&self, i: usize) -> [f32; 3] {
+        let v = &self.vertex_data[i * Self::STRIDE..];
+        [v[0], v[1], v[2]]
+    }
+
+    /// Normal of vertex `i`
+    pub fn normal(&self, i: usize) -> [f32; 3] {
+        let v = &self.vertex_data[i * Self::STRIDE..];
+        [v[3], v[4], v[5]]
+    }
+
+    /// Reorder triangles and vertices in place for GPU rendering
+    ///
+    /// Triangles are reordered for the post-transform vertex cache (Tipsify)
+    /// and sorted outside-in to reduce overdraw, then vertices are renumbered
+    /// in first-use order. The geometry itself is unchanged.
+    ///
+    /// # Arguments
+    /// * `group_by_face` - Keep each face's triangles contiguous (for face picking)
+    pub fn optimize_for_rendering(&mut self, group_by_face: bool) -> RenderCacheReport {
+        ffi::optimize_flat_mesh(
+            &mut self.vertex_data,
+            &mut self.indices,
+            &mut self.face_ids,
+            group_by_face,
+        )
+    }
+}
@@ -6,8 +6,239 @@
 
 use crate::error::{OcctError, OcctResult};
 use crate::ffi::ffi;
+use crate::progress::OperationProgress;
 use crate::shape::Shape;
 
+pub use crate::ffi::ffi::{FuseLevelStats, FuseTreeStats};
+
+/// Operation of [`Operations::boolean_batch`]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum BooleanOp {
+    /// Union of all arguments and tools
+    Fuse,
+    /// Union of the arguments minus union of the tools
+    Cut,
+    /// Union of the arguments intersected with union of the tools
+    Common,
+}
+
+impl BooleanOp {
+    fn to_ffi(self) -> i32 {
+        match self {
+            BooleanOp::Fuse => 0,
+            BooleanOp::Cut => 1,
+            BooleanOp::Common => 2,
+        }
+    }
+}
+
+/// How an argument and a tool relate, from the boolean pre-flight
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum BooleanPath {
+    /// Boundaries may meet: the full boolean runs
+    Full,
+    /// No common point
+    Disjoint,
+    /// Tool strictly inside the argument
+    ToolInside,
+    /// Argument strictly inside the tool
+    ArgumentInside,
+}
+
+impl BooleanPath {
+    fn from_ffi(path: i32) -> Self {
+        match path {
+            1 => BooleanPath::Disjoint,
+            2 => BooleanPath::ToolInside,
+            3 => BooleanPath::ArgumentInside,
+            _ => BooleanPath::Full,
+        }
+    }
+}
+
+/// What [`Operations::boolean_with_report`] did
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct BooleanPreflight {
+    /// Classification of the whole argument against the tool
+    pub path: BooleanPath,
+    /// Bodies of a compound argument kept or dropped without boolean work
+    pub passthrough: usize,
+}
+
+/// What became of an input face or edge in a boolean
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum ShapeFate {
+    /// Absent from the result
+    Removed,
+    /// In the result as is
+    Unchanged,
+    /// Replaced by one or more result sub-shapes (split, trimmed or merged)
+    Modified,
+}
+
+/// Old-to-new map for one boolean input's faces or edges
+///
+/// Indices on both sides are those of [`Topology`](crate::Topology)
+/// (0-based, in the order the sub-shapes are first met).
+#[derive(Debug, Clone, Default)]
+pub struct SubShapeMap {
+    /// Fate of each input sub-shape
+    pub fates: Vec<ShapeFate>,
+    /// Prefix offsets into `targets` (one more than `fates`)
+    pub offsets: Vec<u32>,
+    /// Result sub-shape indices
+    pub targets: Vec<u32>,
+}
+
+impl From<ffi::SubShapeMapFFI> for SubShapeMap {
+    fn from(map: ffi::SubShapeMapFFI) -> Self {
+        Self {
+            fates: map
+                .fates
+                .iter()
+                .map(|&fate| match fate {
+                    1 => ShapeFate::Unchanged,
+                    2 => ShapeFate::Modified,
+                    _ => ShapeFate::Removed,
+                })
+                .collect(),
+            offsets: map.offsets,
+            targets: map.targets,
+        }
+    }
+}
+
+impl SubShapeMap {
+    /// Number of input sub-shapes
+    pub fn len(&self) -> usize {
+        self.fates.len()
+    }
+
+    /// True when the input had none of these sub-shapes
+    pub fn is_empty(&self) -> bool {
+        self.fates.is_empty()
+    }
+
+    /// Result sub-shapes that input sub-shape `index` became
+    pub fn targets(&self, index: usize) -> &[u32] {
+        if index >= self.offsets.len().saturating_sub(1) {
+            return &[];
+        }
+        &self.targets[self.offsets[index] as usize..self.offsets[index + 1] as usize]
+    }
+
+    /// Result index of input sub-shape `index` if it came through unchanged
+    pub fn unchanged(&self, index: usize) -> Option<u32> {
+        match self.fates.get(index) {
+            Some(ShapeFate::Unchanged) => self.targets(index).first().copied(),
+            _ => None,
+        }
+    }
+
+    /// Carry per-input values (labels, selection flags) over to a result of
+    /// `result_len` sub-shapes. Unchanged sub-shapes always carry over;
+    /// modified ones only when `include_modified` is set. Result sub-shapes
+    /// with no source are left `None`.
+    pub fn transfer<T: Clone>(
+        &self,
+        values: &[T],
+        result_len: usize,
+        include_modified: bool,
+    ) -> Vec<Option<T>> {
+        let mut result = vec![None; result_len];
+        for (index, value) in values.iter().enumerate().take(self.len()) {
+            let fate = self.fates[index];
+            if fate == ShapeFate::Unchanged || (include_modified && fate == ShapeFate::Modified) {
+                for &target in self.targets(index) {
+                    if let Some(slot) = result.get_mut(target as usize) {
+                        slot.get_or_insert_with(|| value.clone());
+                    }
+                }
+            }
+        }
+        result
+    }
+}
+
+/// Face and edge provenance of a boolean result
+///
+/// Composed through the final same-domain unify, so faces the boolean split
+/// and the unify merged back still map to their result face.
+#[derive(Debug, Clone)]
+pub struct BooleanHistory {
+    /// Pre-flight path taken
+    pub path: BooleanPath,
+    /// Number of faces in the result
+    pub result_faces: usize,
+    /// Number of edges in the result
+    pub result_edges: usize,
+    /// Where the argument's faces went
+    pub argument_faces: SubShapeMap,
+    /// Where the argument's edges went
+    pub argument_edges: SubShapeMap,
+    /// Where the tool's faces went
+    pub tool_faces: SubShapeMap,
+    /// Where the tool's edges went
+    pub tool_edges: SubShapeMap,
+}
+
+impl From<ffi::BooleanHistoryFFI> for BooleanHistory {
+    fn from(history: ffi::BooleanHistoryFFI) -> Self {
+        Self {
+            path: BooleanPath::from_ffi(history.path),
+            result_faces: history.result_faces as usize,
+            result_edges: history.result_edges as usize,
+            argument_faces: history.argument_faces.into(),
+            argument_edges: history.argument_edges.into(),
+            tool_faces: history.tool_faces.into(),
+            tool_edges: history.tool_edges.into(),
+        }
+    }
+}
+
+/// Options for [`Operations::boolean_batch`]
+#[derive(Debug, Clone, Copy)]
+pub struct BooleanOptions {
+    /// Tolerance for coincident geometry (raise it for imprecise inputs)
+    pub fuzzy_tolerance: f64,
+    /// Run the intersection phases in parallel
+    pub parallel: bool,
+    /// Pre-filter shape pairs with oriented bounding boxes
+    pub use_obb: bool,
+    /// Check for inverted solids
+    pub check_inverted: bool,
+    /// Keep the input shapes unmodified
+    pub non_destructive: bool,
+    /// Glue mode: faster when shapes only touch (shared faces, no crossings)
+    pub glue: bool,
+}
+
+impl BooleanOptions {
+    fn to_ffi(&self) -> ffi::BooleanOptionsFFI {
+        ffi::BooleanOptionsFFI {
+            fuzzy_tolerance: self.fuzzy_tolerance,
+            parallel: self.parallel,
+            use_obb: self.use_obb,
+            check_inverted: self.check_inverted,
+            non_destructive: self.non_destructive,
+            glue: self.glue,
+        }
+    }
+}
+
+impl Default for BooleanOptions {
+    fn default() -> Self {
+        Self {
+            fuzzy_tolerance: 1e-7,
+            parallel: true,
+            use_obb: true,
+            check_inverted: true,
+            non_destructive: false,
+            glue: false,
+        }
+    }
+}
+
 /// Operations on shapes
 pub struct Operations;
 
@@ -55,6 +286,99 @@ impl Operations {
             .map_err(|_| OcctError::BooleanOperationFailed("Common operation failed".to_string()))
     }
 
+    /// Classify `argument` against `tool` without running a boolean
+    ///
+    /// Uses bounding boxes (axis-aligned, then oriented) and, for solids
+    /// whose boundaries stay apart, point classification. [`fuse`](Self::fuse),
+    /// [`cut`](Self::cut) and [`common`](Self::common) run this first and
+    /// skip the boolean whenever the answer is anything but
+    /// [`BooleanPath::Full`].
+    pub fn classify_boolean(argument: &Shape, tool: &Shape) -> BooleanPath {
+        BooleanPath::from_ffi(ffi::boolean_classify(argument.inner(), tool.inner()))
+    }
+
+    /// Fuse, cut or common of two shapes, reporting the pre-flight path taken
+    ///
+    /// # Example
+    /// ```no_run
+    /// use cadhy_cad::{BooleanOp, BooleanPath, Operations, Primitives};
+    ///
+    /// let wall = Primitives::make_box(10.0, 1.0, 3.0).unwrap();
+    /// let opening = Primitives::make_box_at(20.0, -1.0, 1.0, 2.0, 3.0, 1.0).unwrap();
+    /// let (_, report) = Operations::boolean_with_report(&wall, &opening, BooleanOp::Cut).unwrap();
+    /// assert_eq!(report.path, BooleanPath::Disjoint);
+    /// ```
+    pub fn boolean_with_report(
+        argument: &Shape,
+        tool: &Shape,
+        op: BooleanOp,
+    ) -> OcctResult<(Shape, BooleanPreflight)> {
+        let mut report = ffi::BooleanPreflightReport::default();
+        let ptr =
+            ffi::boolean_with_report(argument.inner(), tool.inner(), op.to_ffi(), &mut report);
+        let shape = Shape::from_ptr(ptr)
+            .map_err(|_| OcctError::BooleanOperationFailed(format!("{:?} operation failed", op)))?;
+        Ok((
+            shape,
+            BooleanPreflight {
+                path: BooleanPath::from_ffi(report.path),
+                passthrough: report.passthrough as usize,
+            },
+        ))
+    }
+
+    /// Fuse, cut or common of two shapes with face and edge provenance
+    ///
+    /// Lets per-face data of the inputs (meshes, labels, selections) carry
+    /// over to faces the boolean left alone instead of being rebuilt.
+    ///
+    /// # Example
+    /// ```no_run
+    /// use cadhy_cad::{BooleanOp, Operations, Primitives};
+    ///
+    /// let block = Primitives::make_box(10.0, 10.0, 10.0).unwrap();
+    /// let notch = Primitives::make_box_at(8.0, 4.0, 4.0, 4.0, 2.0, 2.0).unwrap();
+    /// let labels = vec!["left", "right", "front", "back", "bottom", "top"];
+    /// let (_, history) = Operations::boolean_with_history(&block, &notch, BooleanOp::Cut).unwrap();
+    /// let carried = history.argument_faces.transfer(&labels, history.result_faces, true);
+    /// ```
+    pub fn boolean_with_history(
+        argument: &Shape,
+        tool: &Shape,
+        op: BooleanOp,
+    ) -> OcctResult<(Shape, BooleanHistory)> {
+        let mut history = ffi::BooleanHistoryFFI::default();
+        let ptr =
+            ffi::boolean_with_history(argument.inner(), tool.inner(), op.to_ffi(), &mut history);
+        let shape = Shape::from_ptr(ptr)
+            .map_err(|_| OcctError::BooleanOperationFailed(format!("{:?} operation failed", op)))?;
+        Ok((shape, history.into()))
+    }
+
+    /// Fuse, cut or common of two shapes reporting into `progress`
+    ///
+    /// Fails with [`OcctError::Cancelled`] or [`OcctError::TimedOut`] when
+    /// the handle stops the boolean.
+    pub fn boolean_with_progress(
+        argument: &Shape,
+        tool: &Shape,
+        op: BooleanOp,
+        progress: &OperationProgress,
+    ) -> OcctResult<Shape> {
+        let ptr = ffi::boolean_with_progress(
+            argument.inner(),
+            tool.inner(),
+            op.to_ffi(),
+            progress.inner(),
+        );
+        Shape::from_ptr(ptr).map_err(|_| {
+            progress.failure(OcctError::BooleanOperationFailed(format!(
+                "{:?} operation failed",
+                op
+            )))
+        })
+    }
+
     /// Apply fillet to all edges of a shape
     ///
     /// # Arguments
@@ -252,6 +576,37 @@ impl Operations {
         })
     }
 
+    /// [`fillet_edges_advanced`](Self::fillet_edges_advanced) reporting into
+    /// `progress`
+    pub fn fillet_edges_advanced_with_progress(
+        shape: &Shape,
+        edge_indices: &[i32],
+        radii: &[f64],
+        continuity: i32,
+        progress: &OperationProgress,
+    ) -> OcctResult<Shape> {
+        if edge_indices.len() != radii.len() {
+            return Err(OcctError::FilletChamferFailed(format!(
+                "edge_indices length ({}) must match radii length ({})",
+                edge_indices.len(),
+                radii.len()
+            )));
+        }
+
+        let ptr = ffi::fillet_edges_advanced_with_progress(
+            shape.inner(),
+            edge_indices,
+            radii,
+            continuity,
+            progress.inner(),
+        );
+        Shape::from_ptr(ptr).map_err(|_| {
+            progress.failure(OcctError::FilletChamferFailed(
+                "Advanced fillet operation failed".to_string(),
+            ))
+        })
+    }
+
     /// Apply chamfer with two different distances per edge
     ///
     /// # Arguments
@@ -303,28 +658,93 @@ impl Operations {
         })
     }
 
+    /// One boolean between an argument list and a tool list
+    ///
+    /// All shapes go through a single parallel boolean (with oriented
+    /// bounding box pre-filtering), and the result is unified once at the
+    /// end, instead of one boolean and one unify pass per pair.
+    /// For [`BooleanOp::Fuse`] the tools may be empty.
+    ///
+    /// # Example
+    /// ```no_run
+    /// use cadhy_cad::{BooleanOp, BooleanOptions, Operations, Primitives};
+    ///
+    /// let plate = Primitives::make_box(100.0, 100.0, 5.0).unwrap();
+    /// let holes: Vec<_> = (0..10)
+    ///     .map(|i| {
+    ///         let x = 5.0 + 10.0 * i as f64;
+    ///         Primitives::make_cylinder_at(x, 50.0, -1.0, 0.0, 0.0, 1.0, 2.0, 7.0).unwrap()
+    ///     })
+    ///     .collect();
+    /// let tools: Vec<_> = holes.iter().collect();
+    /// let options = BooleanOptions::default();
+    /// let result = Operations::boolean_batch(&[&plate], &tools, BooleanOp::Cut, &options).unwrap();
+    /// ```
+    pub fn boolean_batch(
+        arguments: &[&Shape],
+        tools: &[&Shape],
+        op: BooleanOp,
+        options: &BooleanOptions,
+    ) -> OcctResult<Shape> {
+        if arguments.is_empty() || (tools.is_empty() && op != BooleanOp::Fuse) {
+            return Err(OcctError::BooleanOperationFailed(
+                "Boolean batch requires arguments and tools".to_string(),
+            ));
+        }
+
+        let argument_ptrs: Vec<*const ffi::OcctShape> = arguments
+            .iter()
+            .map(|s| s.inner() as *const ffi::OcctShape)
+            .collect();
+        let tool_ptrs: Vec<*const ffi::OcctShape> = tools
+            .iter()
+            .map(|s| s.inner() as *const ffi::OcctShape)
+            .collect();
+        let ptr = ffi::boolean_batch(&argument_ptrs, &tool_ptrs, op.to_ffi(), &options.to_ffi());
+        Shape::from_ptr(ptr).map_err(|_| {
+            OcctError::BooleanOperationFailed(format!("Batched {:?} operation failed", op))
+        })
+    }
+
     /// Fuse multiple shapes together
+    ///
+    /// Shapes are fused bottom-up through a bounding-box tree: only shapes
+    /// whose boxes overlap ever meet in a boolean, independent subtrees run
+    /// in parallel, and the result is unified once at the end.
     pub fn fuse_many(shapes: &[&Shape]) -> OcctResult<Shape> {
+        Self::fuse_many_with_stats(shapes, &BooleanOptions::default()).map(|(shape, _)| shape)
+    }
+
+    /// [`Operations::fuse_many`] with options, also returning the per-level
+    /// timing breakdown of the fuse tree
+    pub fn fuse_many_with_stats(
+        shapes: &[&Shape],
+        options: &BooleanOptions,
+    ) -> OcctResult<(Shape, FuseTreeStats)> {
         if shapes.len() < 2 {
             return Err(OcctError::BooleanOperationFailed(
                 "Fuse requires at least 2 shapes".to_string(),
             ));
         }
 
-        let mut result = shapes[0].clone();
-        for shape in &shapes[1..] {
-            result = Self::fuse(&result, shape)?;
-        }
-        Ok(result)
+        let shape_ptrs: Vec<*const ffi::OcctShape> = shapes
+            .iter()
+            .map(|s| s.inner() as *const ffi::OcctShape)
+            .collect();
+        let mut stats = FuseTreeStats::default();
+        let ptr = ffi::boolean_fuse_many(&shape_ptrs, &options.to_ffi(), &mut stats);
+        let shape = Shape::from_ptr(ptr).map_err(|_| {
+            OcctError::BooleanOperationFailed("Fuse of multiple shapes failed".to_string())
+        })?;
+        Ok((shape, stats))
     }
 
-    /// Subtract multiple shapes from a base shape
+    /// Subtract multiple shapes from a base shape (one batched boolean)
     pub fn cut_many(base: &Shape, tools: &[&Shape]) -> OcctResult<Shape> {
-        let mut result = base.clone();
-        for tool in tools {
-            result = Self::cut(&result, tool)?;
+        if tools.is_empty() {
+            return Ok(base.clone());
         }
-        Ok(result)
+        Self::boolean_batch(&[base], tools, BooleanOp::Cut, &BooleanOptions::default())
     }
 
     /// Create a shell (hollow solid) from a shape
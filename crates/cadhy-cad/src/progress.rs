@@ -0,0 +1,114 @@
+//! Progress reporting and cancellation for long operations
+//!
+//! An [`OperationProgress`] is passed to the `*_with_progress` variants of
+//! booleans, fillets, shape healing, sewing, STEP import and exact HLR. While
+//! the operation runs on one thread, any other thread may read its fraction
+//! and stage, cancel it, or rely on a wall-clock timeout to stop it.
+//!
+//! # Example
+//!
+//! ```no_run
+//! use std::time::Duration;
+//! use cadhy_cad::{BooleanOp, OperationProgress, Operations, Primitives};
+//!
+//! let a = Primitives::make_box(10.0, 10.0, 10.0).unwrap();
+//! let b = Primitives::make_sphere(6.0).unwrap();
+//!
+//! let progress = OperationProgress::new();
+//! progress.set_timeout(Duration::from_secs(30));
+//! std::thread::scope(|s| {
+//!     s.spawn(|| Operations::boolean_with_progress(&a, &b, BooleanOp::Cut, &progress));
+//!     println!("{} {:.0}%", progress.stage(), progress.fraction() * 100.0);
+//! });
+//! ```
+
+use std::time::Duration;
+
+use crate::error::{OcctError, OcctResult};
+use crate::ffi::ffi;
+
+/// Progress, cancellation and timeout handle for long operations
+///
+/// Pass it to one operation at a time. Cancellation and timeouts are sticky:
+/// once stopped, every later operation given this handle fails immediately
+/// with [`OcctError::Cancelled`] or [`OcctError::TimedOut`].
+pub struct OperationProgress {
+    inner: cxx::UniquePtr<ffi::OperationProgress>,
+}
+
+// SAFETY: every C++ member used through the bridge is const and backed by
+// atomics or a mutex, and OCCT may call back into the handle from worker
+// threads of parallel algorithms
+unsafe impl Send for OperationProgress {}
+unsafe impl Sync for OperationProgress {}
+
+impl OperationProgress {
+    /// Create a handle that is not cancelled and has no timeout
+    pub fn new() -> Self {
+        Self {
+            inner: ffi::progress_new(),
+        }
+    }
+
+    /// Request cancellation; the operation stops at its next checkpoint
+    pub fn cancel(&self) {
+        ffi::progress_cancel(&self.inner);
+    }
+
+    /// Stop operations once `timeout` has passed from now
+    pub fn set_timeout(&self, timeout: Duration) {
+        ffi::progress_set_timeout(&self.inner, timeout.as_secs_f64());
+    }
+
+    /// Remove the timeout (has no effect once it has expired)
+    pub fn clear_timeout(&self) {
+        ffi::progress_set_timeout(&self.inner, 0.0);
+    }
+
+    /// Completed fraction of the current operation in [0, 1]
+    pub fn fraction(&self) -> f64 {
+        ffi::progress_fraction(&self.inner)
+    }
+
+    /// Innermost named stage of the current operation, as reported by OCCT
+    pub fn stage(&self) -> String {
+        ffi::progress_stage(&self.inner)
+    }
+
+    /// Whether [`cancel`](Self::cancel) was called
+    pub fn is_cancelled(&self) -> bool {
+        ffi::progress_is_cancelled(&self.inner)
+    }
+
+    /// Whether the timeout has expired
+    pub fn timed_out(&self) -> bool {
+        ffi::progress_timed_out(&self.inner)
+    }
+
+    pub(crate) fn inner(&self) -> &ffi::OperationProgress {
+        &self.inner
+    }
+
+    /// Err if the handle was cancelled or timed out
+    pub(crate) fn check(&self) -> OcctResult<()> {
+        if self.is_cancelled() {
+            Err(OcctError::Cancelled)
+        } else if self.timed_out() {
+            Err(OcctError::TimedOut)
+        } else {
+            Ok(())
+        }
+    }
+
+    /// `error`, unless the handle was stopped: then the stop is the reason
+    /// the operation failed
+    pub(crate) fn failure(&self, error: OcctError) -> OcctError {
+        self.check().err().unwrap_or(error)
+    }
+}
+
+impl Default for OperationProgress {
+    fn default() -> Self {
+        Self::new()
+    }
+}
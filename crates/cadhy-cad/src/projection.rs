@@ -18,6 +18,7 @@
 //! let result = project_shape(&box_shape, ProjectionType::Top, 1.0).unwrap();
 //! ```
 
+pub use crate::ffi::ffi::HlrCacheStats;
 use crate::{OcctError, OcctResult, Shape};
 use serde::{Deserialize, Serialize};
 
@@ -451,6 +452,8 @@ pub struct ProjectionResultV2 {
     pub num_lines: i32,
     /// Statistics: number of arcs/circles
     pub num_arcs: i32,
+    /// Statistics: number of ellipses/elliptical arcs
+    pub num_ellipses: i32,
     /// Statistics: number of polylines
     pub num_polylines: i32,
 }
@@ -797,6 +800,80 @@ pub fn project_shape_v2(
         result.max_y
     );
 
+    convert_v2_result(&result, view_type, scale)
+}
+
+/// [`project_shape_v2`] reporting into `progress`
+///
+/// HLR has no progress support of its own: the fraction advances once per
+/// phase (update, hide, each extracted edge class) and a cancel or timeout
+/// takes effect at the next phase boundary.
+pub fn project_shape_v2_with_progress(
+    shape: &Shape,
+    view_type: ProjectionType,
+    scale: f64,
+    deflection: f64,
+    progress: &crate::OperationProgress,
+) -> OcctResult<ProjectionResultV2> {
+    use crate::ffi::ffi;
+
+    let (direction, up) = view_type.get_vectors();
+    let result = ffi::compute_hlr_projection_with_progress(
+        shape.inner(),
+        direction[0],
+        direction[1],
+        direction[2],
+        up[0],
+        up[1],
+        up[2],
+        scale,
+        deflection,
+        progress.inner(),
+    );
+    progress.check()?;
+
+    convert_v2_result(&result, view_type, scale)
+}
+
+/// Project a shape (as [`project_shape_v2`]) and clean the result up for drawings
+///
+/// HLR of curved models yields many short lines and dense polylines, often
+/// with a hidden copy under a visible one. This removes such overlaps, joins
+/// touching lines and polylines, fits circular runs as arcs and simplifies
+/// the rest (Douglas-Peucker), all within `tolerance` in output units.
+/// Exact arcs, circles and ellipses are kept as they are.
+pub fn project_shape_v2_simplified(
+    shape: &Shape,
+    view_type: ProjectionType,
+    scale: f64,
+    deflection: f64,
+    tolerance: f64,
+) -> OcctResult<ProjectionResultV2> {
+    use crate::ffi::ffi;
+
+    let (direction, up) = view_type.get_vectors();
+
+    let result = ffi::compute_hlr_projection_v2(
+        shape.inner(),
+        direction[0],
+        direction[1],
+        direction[2],
+        up[0],
+        up[1],
+        up[2],
+        scale,
+        deflection,
+    );
+    let simplified = ffi::simplify_hlr_projection_v2(&result, tolerance);
+    convert_v2_result(&simplified, view_type, scale)
+}
+
+/// Convert an FFI V2 projection result to Rust types
+fn convert_v2_result(
+    result: &crate::ffi::ffi::HLRProjectionResultV2,
+    view_type: ProjectionType,
+    scale: f64,
+) -> OcctResult<ProjectionResultV2> {
     // Check for empty result
     if result.curves.is_empty() && result.polylines.is_empty() {
         return Err(OcctError::OperationFailed(
@@ -904,6 +981,7 @@ pub fn project_shape_v2(
         label: view_type.label().to_string(),
         num_lines: result.num_lines,
         num_arcs: result.num_arcs,
+        num_ellipses: result.num_ellipses,
         num_polylines: result.num_polylines,
     })
 }
@@ -931,6 +1009,284 @@ pub fn generate_standard_views_v2(
     Ok(results)
 }
 
+// ============================================================
+// HLR RESULT CACHE
+// ============================================================
+
+/// Exact projection cache statistics (process-wide)
+///
+/// [`project_shape_v2`] and the background/tiered projections cache their
+/// unscaled results keyed by shape content and camera; scale is applied
+/// after lookup.
+pub fn hlr_cache_stats() -> HlrCacheStats {
+    crate::ffi::ffi::hlr_cache_stats()
+}
+
+/// Reset the projection cache counters
+pub fn reset_hlr_cache_stats() {
+    crate::ffi::ffi::reset_hlr_cache_stats()
+}
+
+/// Set the projection cache memory cap in bytes (default 64 MiB)
+pub fn set_hlr_cache_capacity(bytes: u64) {
+    crate::ffi::ffi::set_hlr_cache_capacity(bytes)
+}
+
+/// Drop all cached projections
+pub fn clear_hlr_cache() {
+    crate::ffi::ffi::clear_hlr_cache()
+}
+
+// ============================================================
+// STREAMING DRAWING EXPORT
+// ============================================================
+
+/// File format for [`write_projection_drawing`]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Serialize, Deserialize)]
+pub enum DrawingFormat {
+    /// SVG document (+Y up, hidden lines dashed)
+    Svg,
+    /// DXF R12 (ellipses written as polylines)
+    DxfR12,
+    /// DXF R2000 (LWPOLYLINE, ELLIPSE)
+    DxfR2000,
+}
+
+/// Options for [`write_projection_drawing`]
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct DrawingExportOptions {
+    /// Output format
+    pub format: DrawingFormat,
+    /// Digits written after the decimal point (trailing zeros are dropped)
+    pub precision: u32,
+    /// Snap coordinates to multiples of this before writing (0 = off)
+    pub quantum: f64,
+}
+
+impl Default for DrawingExportOptions {
+    fn default() -> Self {
+        Self {
+            format: DrawingFormat::Svg,
+            precision: 4,
+            quantum: 0.0,
+        }
+    }
+}
+
+/// Project a shape (as [`project_shape_v2`]) and stream the drawing to a file
+///
+/// The document is written in fixed-size chunks as it is formatted, so large
+/// sheets are never held in memory as one string and nothing is copied back
+/// into Rust. Lines go to the VISIBLE, HIDDEN and CENTER layers (SVG classes).
+pub fn write_projection_drawing(
+    shape: &Shape,
+    view_type: ProjectionType,
+    scale: f64,
+    deflection: f64,
+    filename: &str,
+    options: &DrawingExportOptions,
+) -> OcctResult<()> {
+    let (direction, up) = view_type.get_vectors();
+    let format = match options.format {
+        DrawingFormat::Svg => 0,
+        DrawingFormat::DxfR12 => 1,
+        DrawingFormat::DxfR2000 => 2,
+    };
+
+    let written = crate::ffi::ffi::write_hlr_projection_drawing(
+        shape.inner(),
+        direction[0],
+        direction[1],
+        direction[2],
+        up[0],
+        up[1],
+        up[2],
+        scale,
+        deflection,
+        filename,
+        format,
+        options.precision.min(17) as i32,
+        options.quantum,
+    );
+
+    if written {
+        Ok(())
+    } else {
+        Err(OcctError::ExportFailed(format!(
+            "Failed to write drawing file: {}",
+            filename
+        )))
+    }
+}
+
+// ============================================================
+// TIERED PROJECTION (POLYGONAL PREVIEW + BACKGROUND EXACT)
+// ============================================================
+
+/// Estimated cost of exact HLR for a shape
+#[derive(Debug, Clone, Copy, Serialize, Deserialize)]
+pub struct HlrCostEstimate {
+    /// Number of faces
+    pub num_faces: usize,
+    /// Number of edges
+    pub num_edges: usize,
+    /// Relative cost (faces x edges)
+    pub work: f64,
+    /// Whether a polygonal preview should be shown before the exact result
+    pub use_preview: bool,
+}
+
+/// Estimate the cost of exact HLR from the shape's face and edge counts
+pub fn estimate_hlr_cost(shape: &Shape) -> HlrCostEstimate {
+    use crate::ffi::ffi;
+
+    let estimate = ffi::estimate_hlr_cost(shape.inner());
+    HlrCostEstimate {
+        num_faces: estimate.num_faces.max(0) as usize,
+        num_edges: estimate.num_edges.max(0) as usize,
+        work: estimate.work,
+        use_preview: estimate.use_preview,
+    }
+}
+
+/// Fast polygonal projection for previews
+///
+/// Uses the shape's existing triangulation when it has one (e.g. from the
+/// viewport), otherwise meshes at `deflection`. All curves are line segments.
+pub fn project_shape_preview(
+    shape: &Shape,
+    view_type: ProjectionType,
+    scale: f64,
+    deflection: f64,
+) -> OcctResult<ProjectionResultV2> {
+    use crate::ffi::ffi;
+
+    let (direction, up) = view_type.get_vectors();
+    let result = ffi::compute_hlr_projection_poly(
+        shape.inner(),
+        direction[0],
+        direction[1],
+        direction[2],
+        up[0],
+        up[1],
+        up[2],
+        scale,
+        deflection,
+    );
+
+    convert_v2_result(&result, view_type, scale)
+}
+
+/// Exact projection running on a background thread
+///
+/// Dropping it cancels the computation without waiting for it.
+pub struct PendingProjection {
+    job: cxx::UniquePtr<crate::ffi::ffi::HlrJob>,
+    view_type: ProjectionType,
+    scale: f64,
+}
+
+// SAFETY: the C++ job state is guarded by a mutex and atomics, and the worker
+// thread holds its own reference to it
+unsafe impl Send for PendingProjection {}
+unsafe impl Sync for PendingProjection {}
+
+impl PendingProjection {
+    /// Whether the exact result is available (or the job was cancelled)
+    pub fn is_ready(&self) -> bool {
+        crate::ffi::ffi::hlr_job_is_ready(&self.job)
+    }
+
+    /// Cancel the computation (may be called from any thread)
+    pub fn cancel(&self) {
+        crate::ffi::ffi::hlr_job_cancel(&self.job);
+    }
+
+    /// Take the exact result if it is ready, without blocking
+    pub fn try_take(&self) -> Option<OcctResult<ProjectionResultV2>> {
+        if self.is_ready() {
+            Some(self.wait())
+        } else {
+            None
+        }
+    }
+
+    /// Block until the exact result is ready and take it
+    pub fn wait(&self) -> OcctResult<ProjectionResultV2> {
+        let result = crate::ffi::ffi::hlr_job_take_result(&self.job);
+        convert_v2_result(&result, self.view_type, self.scale)
+    }
+}
+
+/// Start an exact projection (as [`project_shape_v2`]) on a background thread
+///
+/// The job works on its own copy of the shape's topology, so the shape can be
+/// tessellated or previewed while it runs.
+pub fn project_shape_background(
+    shape: &Shape,
+    view_type: ProjectionType,
+    scale: f64,
+    deflection: f64,
+) -> OcctResult<PendingProjection> {
+    use crate::ffi::ffi;
+
+    let (direction, up) = view_type.get_vectors();
+    let job = ffi::start_hlr_projection(
+        shape.inner(),
+        direction[0],
+        direction[1],
+        direction[2],
+        up[0],
+        up[1],
+        up[2],
+        scale,
+        deflection,
+    );
+
+    if job.is_null() {
+        return Err(OcctError::OperationFailed(
+            "Failed to start background HLR projection".to_string(),
+        ));
+    }
+
+    Ok(PendingProjection {
+        job,
+        view_type,
+        scale,
+    })
+}
+
+/// Projection that shows a fast preview first and refines in the background
+pub struct TieredProjection {
+    /// Polygonal preview (only for shapes where exact HLR is expensive)
+    pub preview: Option<ProjectionResultV2>,
+    /// Exact result, replaces the preview when ready
+    pub exact: PendingProjection,
+}
+
+/// Project a shape choosing the HLR mode by estimated cost
+///
+/// Small shapes get no preview; the exact result is usually ready almost
+/// immediately. Large shapes (see [`estimate_hlr_cost`]) get a polygonal
+/// preview computed on the calling thread while the exact projection runs
+/// in the background.
+pub fn project_shape_tiered(
+    shape: &Shape,
+    view_type: ProjectionType,
+    scale: f64,
+    deflection: f64,
+) -> OcctResult<TieredProjection> {
+    let exact = project_shape_background(shape, view_type, scale, deflection)?;
+
+    let preview = if estimate_hlr_cost(shape).use_preview {
+        project_shape_preview(shape, view_type, scale, deflection).ok()
+    } else {
+        None
+    };
+
+    Ok(TieredProjection { preview, exact })
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -337,6 +337,60 @@ pub fn compute_section_view(shape: &Shape, plane: &SectionPlane) -> OcctResult<S
     })
 }
 
+/// Summary of an exact plane section
+#[derive(Debug, Clone, Copy, PartialEq, Serialize, Deserialize)]
+pub struct PlaneSection {
+    /// Number of outline polylines (one per section edge)
+    pub outlines: usize,
+    /// Total length of the outlines
+    pub outline_length: f64,
+    /// Whether the section forms closed wires
+    pub is_closed: bool,
+    /// Area of the section (0 unless closed)
+    pub area: f64,
+    /// Centroid of the section
+    pub centroid: [f64; 3],
+}
+
+impl From<&crate::ffi::ffi::PlaneSectionFFI> for PlaneSection {
+    fn from(section: &crate::ffi::ffi::PlaneSectionFFI) -> Self {
+        Self {
+            outlines: section.outlines as usize,
+            outline_length: section.outline_length,
+            is_closed: section.is_closed,
+            area: section.area,
+            centroid: [section.centroid_x, section.centroid_y, section.centroid_z],
+        }
+    }
+}
+
+/// Exact section of `shape` with the plane through `origin` perpendicular
+/// to `normal`
+pub fn section_by_plane(shape: &Shape, origin: [f64; 3], normal: [f64; 3]) -> PlaneSection {
+    let section = crate::ffi::ffi::section_by_plane(
+        shape.inner(),
+        origin[0],
+        origin[1],
+        origin[2],
+        normal[0],
+        normal[1],
+        normal[2],
+    );
+    PlaneSection::from(&section)
+}
+
+/// Exact sections with the planes perpendicular to `normal` at the signed
+/// distances `offsets` from the origin, one per offset in the order given
+///
+/// Each face's extent along the normal is computed once, so every plane
+/// only cuts the faces it crosses; results match [`section_by_plane`].
+pub fn sections_at_offsets(shape: &Shape, normal: [f64; 3], offsets: &[f64]) -> Vec<PlaneSection> {
+    crate::ffi::ffi::sections_at_offsets(shape.inner(), normal[0], normal[1], normal[2], offsets)
+        .iter()
+        .map(PlaneSection::from)
+        .collect()
+}
+
 // =============================================================================
 // SECTION WITH HATCHING (OCCT-BASED)
 // =============================================================================
@@ -449,6 +503,14 @@ pub fn compute_section_with_hatch(
         hatch_config.spacing,
     );
 
+    convert_hatch_result(&ffi_result, plane)
+}
+
+/// Convert an FFI section-with-hatch result, failing when it is empty
+fn convert_hatch_result(
+    ffi_result: &crate::ffi::ffi::SectionWithHatchResult,
+    plane: &SectionPlane,
+) -> OcctResult<SectionWithHatchResult> {
     // Check if we got valid results
     if ffi_result.curves.is_empty() && ffi_result.regions.is_empty() {
         return Err(OcctError::OperationFailed(
@@ -514,6 +576,73 @@ pub fn compute_section_with_hatch(
     })
 }
 
+/// Fast approximate sections of one shape for interactive clipping planes
+///
+/// Slices the shape's welded triangulation instead of the B-rep, so moving a
+/// plane costs milliseconds even on million-triangle models. Results have the
+/// same layout and 2D frame as [`compute_section_with_hatch`], with curves
+/// within the mesh deflection of the exact cut. Use this while a plane is
+/// being dragged and [`compute_section_with_hatch`] once it is released.
+///
+/// # Example
+///
+/// ```no_run
+/// use cadhy_cad::{Primitives, section::*};
+///
+/// let box_shape = Primitives::make_box(10.0, 20.0, 30.0).unwrap();
+/// let slicer = SectionSlicer::new(&box_shape, 0.1).unwrap();
+/// let config = HatchConfig { angle_deg: 45.0, spacing: 1.5 };
+/// for z in [5.0, 10.0, 15.0] {
+///     let preview = slicer.section(&SectionPlane::horizontal(z, "A"), &config);
+/// }
+/// ```
+pub struct SectionSlicer {
+    inner: cxx::UniquePtr<crate::ffi::ffi::SectionSlicer>,
+}
+
+// SAFETY: the C++ slicer owns a copy of the mesh and serialises section
+// calls on its scratch buffers with a mutex
+unsafe impl Send for SectionSlicer {}
+unsafe impl Sync for SectionSlicer {}
+
+impl SectionSlicer {
+    /// Prepare `shape` for fast sections, meshing it at `deflection` if its
+    /// cached triangulation is missing
+    pub fn new(shape: &Shape, deflection: f64) -> OcctResult<Self> {
+        let inner = crate::ffi::ffi::create_section_slicer(shape.inner(), deflection);
+        if inner.is_null() {
+            return Err(OcctError::OperationFailed(
+                "Failed to prepare mesh for fast sections".to_string(),
+            ));
+        }
+        Ok(Self { inner })
+    }
+
+    /// Approximate section of the shape with `plane`
+    pub fn section(
+        &self,
+        plane: &SectionPlane,
+        hatch_config: &HatchConfig,
+    ) -> OcctResult<SectionWithHatchResult> {
+        let ffi_result = crate::ffi::ffi::compute_section_with_hatch_fast(
+            &self.inner,
+            plane.origin[0],
+            plane.origin[1],
+            plane.origin[2],
+            plane.normal[0],
+            plane.normal[1],
+            plane.normal[2],
+            plane.up[0],
+            plane.up[1],
+            plane.up[2],
+            hatch_config.angle_deg,
+            hatch_config.spacing,
+        );
+
+        convert_hatch_result(&ffi_result, plane)
+    }
+}
+
 /// Calculate signed area of a 2D polygon (positive = CCW, negative = CW)
 fn signed_area_2d(points: &[[f64; 2]]) -> f64 {
     if points.len() < 3 {
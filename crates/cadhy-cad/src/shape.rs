@@ -6,7 +6,7 @@ use cxx::UniquePtr;
 
 use crate::error::{OcctError, OcctResult};
 use crate::ffi::ffi::{self, OcctShape};
-use crate::mesh::MeshData;
+use crate::mesh::{FlatMesh, LodLevel, MeshData};
 
 /// A B-Rep shape from OpenCASCADE
 ///
@@ -72,6 +72,124 @@ impl Shape {
         Ok(MeshData::from_ffi_result(result))
     }
 
+    /// Tessellate into a welded (shared-vertex) mesh
+    ///
+    /// Face meshes are stitched through the shared B-rep edge discretisation.
+    /// Vertices where faces meet at more than `crease_angle` radians are
+    /// duplicated to keep sharp normals, which leaves the mesh open along
+    /// those edges; pass `std::f64::consts::PI` for a closed mesh.
+    pub fn tessellate_welded(&self, deflection: f64, crease_angle: f64) -> OcctResult<MeshData> {
+        let result = ffi::tessellate_welded(&self.inner, deflection, crease_angle);
+
+        if result.vertices.is_empty() {
+            return Err(OcctError::TessellationFailed(
+                "No vertices generated".to_string(),
+            ));
+        }
+
+        Ok(MeshData::from_ffi_result(result))
+    }
+
+    /// Tessellate with a deflection chosen per face
+    ///
+    /// Each face gets `curvature_factor` times 1% of the smaller of its
+    /// minimum radius of curvature and its size, clamped to
+    /// `[min_deflection, max_deflection]`: small fillets are meshed finely
+    /// while large, flat faces stay coarse. A copy of the shape is meshed,
+    /// so its cached triangulation is left untouched.
+    pub fn tessellate_adaptive(
+        &self,
+        min_deflection: f64,
+        max_deflection: f64,
+        curvature_factor: f64,
+    ) -> OcctResult<MeshData> {
+        let result = ffi::tessellate_adaptive(
+            &self.inner,
+            min_deflection,
+            max_deflection,
+            curvature_factor,
+        );
+
+        if result.vertices.is_empty() {
+            return Err(OcctError::TessellationFailed(
+                "No vertices generated".to_string(),
+            ));
+        }
+
+        Ok(MeshData::from_ffi_result(result))
+    }
+
+    /// Tessellate into levels of detail, finest first
+    ///
+    /// The shape is meshed once at the finest deflection; each coarser level
+    /// is simplified from the previous one with B-rep face borders kept, so
+    /// its [`error`](LodLevel::error) stays within its deflection.
+    ///
+    /// # Arguments
+    /// * `deflections` - Linear deflection per level, in any order
+    /// * `optimize_for_rendering` - Reorder each level for the GPU vertex cache
+    pub fn tessellate_lods(
+        &self,
+        deflections: &[f64],
+        optimize_for_rendering: bool,
+    ) -> OcctResult<Vec<LodLevel>> {
+        let levels = ffi::tessellate_lods(&self.inner, deflections, optimize_for_rendering);
+
+        if levels.is_empty() || levels.iter().any(|level| level.mesh.vertices.is_empty()) {
+            return Err(OcctError::TessellationFailed(
+                "No levels generated".to_string(),
+            ));
+        }
+
+        Ok(levels
+            .into_iter()
+            .map(|level| LodLevel {
+                mesh: MeshData::from_ffi_result(level.mesh),
+                deflection: level.deflection,
+                error: level.error,
+            })
+            .collect())
+    }
+
+    /// Tessellate directly into GPU-ready flat buffers
+    ///
+    /// Sizes are queried first, then the C++ side writes interleaved `f32`
+    /// positions/normals and `u32` indices straight into the presized
+    /// buffers, avoiding the intermediate `f64` vertex vectors.
+    ///
+    /// # Arguments
+    /// * `deflection` - Maximum chord deviation (smaller = more triangles)
+    /// * `angle` - Maximum angular deviation in radians (0.5 is the default)
+    pub fn tessellate_flat(&self, deflection: f64, angle: f64) -> OcctResult<FlatMesh> {
+        let sizes = ffi::flat_mesh_sizes(&self.inner, deflection, angle);
+        if sizes.vertex_count == 0 {
+            return Err(OcctError::TessellationFailed(
+                "No vertices generated".to_string(),
+            ));
+        }
+
+        let mut mesh = FlatMesh {
+            vertex_data: vec![0.0; sizes.vertex_floats as usize],
+            indices: vec![0; sizes.index_count as usize],
+            face_ids: vec![0; sizes.triangle_count as usize],
+        };
+
+        if !ffi::fill_flat_mesh(
+            &self.inner,
+            deflection,
+            angle,
+            &mut mesh.vertex_data,
+            &mut mesh.indices,
+            &mut mesh.face_ids,
+        ) {
+            return Err(OcctError::TessellationFailed(
+                "Failed to fill mesh buffers".to_string(),
+            ));
+        }
+
+        Ok(mesh)
+    }
+
     /// Tessellate with default deflection (0.1)
     pub fn tessellate_default(&self) -> OcctResult<MeshData> {
         self.tessellate(0.1)
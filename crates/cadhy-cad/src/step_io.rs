@@ -6,6 +6,7 @@ use std::path::Path;
 
 use crate::error::{OcctError, OcctResult};
 use crate::ffi::ffi;
+use crate::progress::OperationProgress;
 use crate::shape::Shape;
 
 /// STEP file I/O operations
@@ -39,6 +40,32 @@ impl StepIO {
         })
     }
 
+    /// [`read`](Self::read) reporting into `progress`
+    ///
+    /// Only the transfer to B-Rep reports progress and can be stopped
+    /// mid-way; a stop during parsing takes effect once parsing is done.
+    pub fn read_with_progress<P: AsRef<Path>>(
+        path: P,
+        progress: &OperationProgress,
+    ) -> OcctResult<Shape> {
+        let path_str = path.as_ref().to_string_lossy().to_string();
+
+        if !path.as_ref().exists() {
+            return Err(OcctError::StepImportFailed(format!(
+                "File not found: {}",
+                path_str
+            )));
+        }
+
+        let ptr = ffi::read_step_with_progress(&path_str, progress.inner());
+        Shape::from_ptr(ptr).map_err(|_| {
+            progress.failure(OcctError::StepImportFailed(format!(
+                "Failed to read STEP file: {}",
+                path_str
+            )))
+        })
+    }
+
     /// Write a shape to a STEP file
     ///
     /// # Arguments
@@ -8,6 +8,8 @@
 //! - **Vertex extraction**: Get all vertices with coordinates and connectivity
 //! - **Edge tessellation**: Convert edges to polylines for wireframe rendering
 //! - **Adjacency maps**: Vertex→Edge and Edge→Face relationships
+//! - **Flat snapshots**: [`TopologySnapshot`] keeps everything in contiguous
+//!   arrays, with edge polylines fetched on demand via [`EdgePolylines`]
 //!
 //! # Example
 //!
@@ -125,7 +127,7 @@ pub struct EdgeTessellation {
     pub start_vertex: u32,
     /// End vertex index
     pub end_vertex: u32,
-    /// Edge length
+    /// Edge length (exact for lines and circles, from the tessellation otherwise)
     pub length: f64,
     /// Is edge degenerated (zero length)
     pub is_degenerated: bool,
@@ -312,6 +314,160 @@ impl From<ffi::TopologyResult> for TopologyData {
     }
 }
 
+/// Flat topology snapshot
+///
+/// Same indices as [`TopologyData`], but every array is contiguous (a handful
+/// of allocations in total, cheap to copy or transfer to a worker) and edges
+/// are not discretised; fetch polylines with [`Topology::edge_polylines`].
+#[derive(Debug, Clone, Default, Serialize, Deserialize)]
+pub struct TopologySnapshot {
+    /// Vertex positions [x0, y0, z0, x1, y1, z1, ...]
+    pub vertex_positions: Vec<f64>,
+    /// Vertex tolerances
+    pub vertex_tolerances: Vec<f64>,
+    /// Edge end vertices [start0, end0, start1, end1, ...] (`u32::MAX` if missing)
+    pub edge_vertices: Vec<u32>,
+    /// Edge curve type codes (see [`CurveType`])
+    pub edge_curve_types: Vec<i32>,
+    /// 1 for degenerated edges
+    pub edge_degenerated: Vec<u8>,
+    /// Face surface type codes (see [`SurfaceType`])
+    pub face_surface_types: Vec<i32>,
+    /// Face areas
+    pub face_areas: Vec<f64>,
+    /// Face mass centers [x0, y0, z0, ...]
+    pub face_centers: Vec<f64>,
+    /// Face normals [x0, y0, z0, ...]
+    pub face_normals: Vec<f64>,
+    /// 1 for reversed faces
+    pub face_reversed: Vec<u8>,
+    /// Vertex to edge adjacency (CSR format data)
+    pub vertex_to_edges: Vec<u32>,
+    /// Offsets for vertex_to_edges (CSR format)
+    pub vertex_to_edges_offset: Vec<u32>,
+    /// Edge to face adjacency (CSR format data)
+    pub edge_to_faces: Vec<u32>,
+    /// Offsets for edge_to_faces (CSR format)
+    pub edge_to_faces_offset: Vec<u32>,
+    /// Face to boundary edge adjacency (CSR format data, seam edges twice)
+    pub face_to_edges: Vec<u32>,
+    /// Offsets for face_to_edges (CSR format)
+    pub face_to_edges_offset: Vec<u32>,
+}
+
+impl From<ffi::TopologySnapshot> for TopologySnapshot {
+    fn from(t: ffi::TopologySnapshot) -> Self {
+        Self {
+            vertex_positions: t.vertex_positions,
+            vertex_tolerances: t.vertex_tolerances,
+            edge_vertices: t.edge_vertices,
+            edge_curve_types: t.edge_curve_types,
+            edge_degenerated: t.edge_degenerated,
+            face_surface_types: t.face_surface_types,
+            face_areas: t.face_areas,
+            face_centers: t.face_centers,
+            face_normals: t.face_normals,
+            face_reversed: t.face_reversed,
+            vertex_to_edges: t.vertex_to_edges,
+            vertex_to_edges_offset: t.vertex_to_edges_offset,
+            edge_to_faces: t.edge_to_faces,
+            edge_to_faces_offset: t.edge_to_faces_offset,
+            face_to_edges: t.face_to_edges,
+            face_to_edges_offset: t.face_to_edges_offset,
+        }
+    }
+}
+
+/// Row `index` of a CSR adjacency (empty if out of range)
+fn csr_row<'a>(data: &'a [u32], offsets: &[u32], index: usize) -> &'a [u32] {
+    if index >= offsets.len().saturating_sub(1) {
+        return &[];
+    }
+    &data[offsets[index] as usize..offsets[index + 1] as usize]
+}
+
+impl TopologySnapshot {
+    /// Number of vertices
+    pub fn num_vertices(&self) -> usize {
+        self.vertex_tolerances.len()
+    }
+
+    /// Number of edges
+    pub fn num_edges(&self) -> usize {
+        self.edge_curve_types.len()
+    }
+
+    /// Number of faces
+    pub fn num_faces(&self) -> usize {
+        self.face_areas.len()
+    }
+
+    /// Position of a vertex
+    pub fn vertex(&self, vertex_index: usize) -> Option<[f64; 3]> {
+        let p = self
+            .vertex_positions
+            .get(3 * vertex_index..3 * vertex_index + 3)?;
+        Some([p[0], p[1], p[2]])
+    }
+
+    /// Type of an edge's curve
+    pub fn edge_curve_type(&self, edge_index: usize) -> Option<CurveType> {
+        self.edge_curve_types
+            .get(edge_index)
+            .map(|&t| CurveType::from(t))
+    }
+
+    /// Type of a face's surface
+    pub fn face_surface_type(&self, face_index: usize) -> Option<SurfaceType> {
+        self.face_surface_types
+            .get(face_index)
+            .map(|&t| SurfaceType::from(t))
+    }
+
+    /// Get edges connected to a vertex
+    pub fn edges_for_vertex(&self, vertex_index: usize) -> &[u32] {
+        csr_row(
+            &self.vertex_to_edges,
+            &self.vertex_to_edges_offset,
+            vertex_index,
+        )
+    }
+
+    /// Get faces adjacent to an edge
+    pub fn faces_for_edge(&self, edge_index: usize) -> &[u32] {
+        csr_row(&self.edge_to_faces, &self.edge_to_faces_offset, edge_index)
+    }
+
+    /// Get edges bounding a face
+    pub fn edges_for_face(&self, face_index: usize) -> &[u32] {
+        csr_row(&self.face_to_edges, &self.face_to_edges_offset, face_index)
+    }
+}
+
+/// Polylines of a set of edges in one flat buffer
+#[derive(Debug, Clone, Default, Serialize, Deserialize)]
+pub struct EdgePolylines {
+    /// Requested edge indices, in request order
+    pub edges: Vec<u32>,
+    /// Points [x0, y0, z0, x1, y1, z1, ...] of all requested edges
+    pub points: Vec<f64>,
+    /// Point offsets per requested edge (`edges.len() + 1` entries)
+    pub offsets: Vec<u32>,
+    /// Edge lengths (exact for lines and circles, from the points otherwise)
+    pub lengths: Vec<f64>,
+}
+
+impl EdgePolylines {
+    /// Points of the i-th requested edge [x0, y0, z0, ...] (empty for
+    /// unknown or degenerated edges)
+    pub fn polyline(&self, i: usize) -> &[f64] {
+        if i >= self.offsets.len().saturating_sub(1) {
+            return &[];
+        }
+        &self.points[3 * self.offsets[i] as usize..3 * self.offsets[i + 1] as usize]
+    }
+}
+
 /// Topology extraction functions
 pub struct Topology;
 
@@ -344,4 +500,29 @@ impl Topology {
         let raw = ffi::get_full_topology(shape.inner(), edge_deflection);
         TopologyData::from(raw)
     }
+
+    /// Get a flat topology snapshot (no edge discretisation)
+    ///
+    /// Much cheaper than [`Topology::get_full`] on large models: the result
+    /// is a fixed number of contiguous arrays. Fetch edge polylines for the
+    /// edges actually shown with [`Topology::edge_polylines`].
+    pub fn snapshot(shape: &Shape) -> TopologySnapshot {
+        TopologySnapshot::from(ffi::get_topology_snapshot(shape.inner()))
+    }
+
+    /// Discretise the given edges (snapshot indices) into one flat buffer
+    ///
+    /// # Arguments
+    /// * `shape` - The shape the snapshot was taken from
+    /// * `edges` - Edge indices; unknown or degenerated edges yield empty polylines
+    /// * `deflection` - Controls curve approximation quality (smaller = more points)
+    pub fn edge_polylines(shape: &Shape, edges: &[u32], deflection: f64) -> EdgePolylines {
+        let raw = ffi::tessellate_edge_polylines(shape.inner(), edges, deflection);
+        EdgePolylines {
+            edges: edges.to_vec(),
+            points: raw.points,
+            offsets: raw.offsets,
+            lengths: raw.lengths,
+        }
+    }
 }
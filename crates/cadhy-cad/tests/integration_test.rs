@@ -158,3 +158,826 @@ fn test_rectangular_channel_geometry() {
     );
     assert!(!mesh_data.indices.is_empty(), "Channel should have indices");
 }
+
+#[test]
+fn test_tessellation_cache_hit() {
+    let shape = Primitives::make_cylinder(5.0, 10.0).unwrap();
+
+    let first = shape.tessellate(0.05).unwrap();
+    let before = cadhy_cad::mesh_cache_stats();
+    let second = shape.tessellate(0.05).unwrap();
+    let after = cadhy_cad::mesh_cache_stats();
+
+    // Counters are process-wide, so other tests may bump them concurrently
+    assert!(
+        after.hits > before.hits,
+        "Repeated tessellation should hit the cache"
+    );
+    assert_eq!(first.vertices, second.vertices);
+    assert_eq!(first.indices, second.indices);
+}
+
+#[test]
+fn test_edit_reuses_untouched_face_triangulations() {
+    use cadhy_cad::Operations;
+
+    let block = Primitives::make_box(20.0, 20.0, 20.0).unwrap();
+    let boss = Primitives::make_cylinder_at(10.0, 10.0, 20.0, 0.0, 0.0, 1.0, 3.0, 5.0).unwrap();
+    block.tessellate(0.1).unwrap();
+    boss.tessellate(0.1).unwrap();
+
+    let fused = Operations::fuse(&block, &boss).unwrap();
+    let before = cadhy_cad::mesh_cache_stats();
+    let mesh = fused.tessellate(0.1).unwrap();
+    let after = cadhy_cad::mesh_cache_stats();
+
+    // Only the box top and the boss bottom are touched by the fuse; the box
+    // bottom and sides and the boss side and top keep their triangulations
+    assert!(
+        after.reused_faces >= before.reused_faces + 5,
+        "Untouched faces should reuse the source triangulation"
+    );
+    assert!(!mesh.indices.is_empty());
+}
+
+#[test]
+fn test_welded_tessellation_shares_vertices() {
+    let shape = Primitives::make_box(10.0, 20.0, 30.0).unwrap();
+
+    let split = shape.tessellate(0.1).unwrap();
+    let welded = shape.tessellate_welded(0.1, 0.5).unwrap();
+
+    // Box corners meet at 90 degrees, so each corner keeps one vertex per face
+    // and the welded mesh has no more vertices than the per-face one
+    assert_eq!(welded.triangle_count(), split.triangle_count());
+    assert!(welded.vertex_count() <= split.vertex_count());
+
+    // Welding across every edge closes the box: one vertex per corner
+    let closed = shape.tessellate_welded(0.1, std::f64::consts::PI).unwrap();
+    assert_eq!(closed.vertex_count(), 8);
+
+    // Smooth seam of a cylinder is welded
+    let cylinder = Primitives::make_cylinder(5.0, 10.0).unwrap();
+    let split = cylinder.tessellate(0.1).unwrap();
+    let welded = cylinder.tessellate_welded(0.1, 0.5).unwrap();
+    assert!(welded.vertex_count() < split.vertex_count());
+}
+
+#[test]
+fn test_optimize_flat_mesh_for_rendering() {
+    let shape = Primitives::make_sphere(10.0).unwrap();
+    let mut mesh = shape.tessellate_flat(0.05, 0.5).unwrap();
+    let triangle_count = mesh.triangle_count();
+    let vertex_count = mesh.vertex_count();
+
+    let report = mesh.optimize_for_rendering(true);
+    assert_eq!(mesh.triangle_count(), triangle_count);
+    assert_eq!(mesh.vertex_count(), vertex_count);
+    assert!(report.acmr_after <= report.acmr_before);
+    assert!(report.atvr_after >= 1.0);
+
+    // Each face's triangles stay in one contiguous run
+    let mut seen = std::collections::HashSet::new();
+    for (i, &face) in mesh.face_ids.iter().enumerate() {
+        if i == 0 || mesh.face_ids[i - 1] != face {
+            assert!(seen.insert(face), "face {} split into several runs", face);
+        }
+    }
+}
+
+#[test]
+fn test_adaptive_tessellation_refines_fillets_only() {
+    use cadhy_cad::{MeshData, Operations, SurfaceType};
+
+    // Triangles and area of the planar and the curved faces
+    fn density(mesh: &MeshData) -> [(usize, f64); 2] {
+        let faces = mesh.faces.as_ref().unwrap();
+        let mut stats = [(0, 0.0); 2];
+        for face in faces {
+            stats[(face.surface_type != SurfaceType::Plane) as usize].1 += face.area;
+        }
+        for &face in mesh.face_ids.as_ref().unwrap() {
+            stats[(faces[face as usize].surface_type != SurfaceType::Plane) as usize].0 += 1;
+        }
+        stats
+    }
+
+    let block = Primitives::make_box(40.0, 40.0, 40.0).unwrap();
+    let part = Operations::fillet_edges(&block, &[0], &[2.0]).unwrap();
+
+    let adaptive = part.tessellate_adaptive(0.001, 1.0, 0.25).unwrap();
+    let [(plane_triangles, plane_area), (fillet_triangles, fillet_area)] = density(&adaptive);
+    assert!(plane_triangles > 0 && fillet_triangles > 0);
+
+    // The fillet is meshed far more densely than the planar faces around it
+    let plane_density = plane_triangles as f64 / plane_area;
+    let fillet_density = fillet_triangles as f64 / fillet_area;
+    assert!(
+        fillet_density > 10.0 * plane_density,
+        "fillet {} vs planes {} triangles per unit area",
+        fillet_density,
+        plane_density
+    );
+
+    // and more finely than a uniform mesh at the coarsest deflection
+    let uniform = part.tessellate(1.0).unwrap();
+    let [_, (uniform_fillet_triangles, _)] = density(&uniform);
+    assert!(fillet_triangles > uniform_fillet_triangles);
+}
+
+#[test]
+fn test_tessellate_lods_simplifies_coarser_levels() {
+    let shape = Primitives::make_sphere(10.0).unwrap();
+    let levels = shape.tessellate_lods(&[1.0, 0.01, 0.1], true).unwrap();
+
+    // Finest first, each level no denser than the previous one
+    assert_eq!(levels.len(), 3);
+    assert_eq!(levels[0].deflection, 0.01);
+    assert!(levels[2].mesh.triangle_count() < levels[0].mesh.triangle_count());
+    for pair in levels.windows(2) {
+        assert!(pair[1].mesh.triangle_count() <= pair[0].mesh.triangle_count());
+    }
+
+    // Coarser levels add their collapse error to the finest deflection
+    assert_eq!(levels[0].error, 0.01);
+    assert!(levels[2].error > levels[0].error);
+
+    for level in &levels {
+        assert!(level.error <= level.deflection + 1e-9);
+        let vertex_count = level.mesh.vertex_count() as u32;
+        assert!(level.mesh.indices.iter().all(|&i| i < vertex_count));
+        let face_ids = level.mesh.face_ids.as_ref().unwrap();
+        assert_eq!(face_ids.len(), level.mesh.triangle_count());
+    }
+}
+
+#[test]
+fn test_simplified_lod_keeps_topology_and_faces() {
+    use std::collections::HashMap;
+
+    let shape = Primitives::make_cylinder(10.0, 20.0).unwrap();
+    let levels = shape.tessellate_lods(&[0.005, 0.2], false).unwrap();
+    let (fine, coarse) = (&levels[0], &levels[1]);
+    assert!(coarse.mesh.triangle_count() * 4 < fine.mesh.triangle_count());
+    assert!(coarse.error > fine.error);
+
+    // Welded by position the simplified mesh is still a closed surface of
+    // genus 0: each face's border moved together with its neighbour's
+    let mut welded = HashMap::new();
+    let ids: Vec<usize> = coarse
+        .mesh
+        .vertices
+        .iter()
+        .map(|v| {
+            let key = (
+                (v.x * 1e4).round() as i64,
+                (v.y * 1e4).round() as i64,
+                (v.z * 1e4).round() as i64,
+            );
+            let next = welded.len();
+            *welded.entry(key).or_insert(next)
+        })
+        .collect();
+    let mut edges: HashMap<(usize, usize), usize> = HashMap::new();
+    for tri in coarse.mesh.indices.chunks(3) {
+        for k in 0..3 {
+            let (a, b) = (ids[tri[k] as usize], ids[tri[(k + 1) % 3] as usize]);
+            *edges.entry((a.min(b), a.max(b))).or_default() += 1;
+        }
+    }
+    assert!(edges.values().all(|&count| count == 2));
+    let euler = welded.len() as i64 - edges.len() as i64 + coarse.mesh.triangle_count() as i64;
+    assert_eq!(euler, 2);
+
+    // No triangle crosses from the side to a cap: cap faces stay flat and
+    // side faces keep every vertex on the cylinder. The reported error is a
+    // mean plane distance rather than a maximum, so side triangles may sag
+    // up to about twice it.
+    let face_ids = coarse.mesh.face_ids.as_ref().unwrap();
+    let mut side_faces = HashMap::new();
+    for (t, tri) in coarse.mesh.indices.chunks(3).enumerate() {
+        let p: Vec<&cadhy_cad::Vertex3> = tri
+            .iter()
+            .map(|&i| &coarse.mesh.vertices[i as usize])
+            .collect();
+        let side = p.iter().any(|v| (v.z - p[0].z).abs() > 1e-6);
+        assert_eq!(*side_faces.entry(face_ids[t]).or_insert(side), side);
+
+        if side {
+            for v in &p {
+                assert!(((v.x * v.x + v.y * v.y).sqrt() - 10.0).abs() < 1e-4);
+            }
+            let cx = (p[0].x + p[1].x + p[2].x) / 3.0;
+            let cy = (p[0].y + p[1].y + p[2].y) / 3.0;
+            assert!(10.0 - (cx * cx + cy * cy).sqrt() <= 2.5 * coarse.error);
+        }
+    }
+    assert_eq!(side_faces.len(), 3);
+}
+
+#[test]
+fn test_tiered_projection_matches_exact() {
+    use cadhy_cad::{project_shape_tiered, project_shape_v2, ProjectionType};
+
+    let shape = Primitives::make_box(10.0, 20.0, 30.0).unwrap();
+    let cost = cadhy_cad::estimate_hlr_cost(&shape);
+    assert_eq!(cost.num_faces, 6);
+    assert_eq!(cost.num_edges, 12);
+    assert!(!cost.use_preview, "A box is cheap enough for exact HLR");
+
+    let tiered = project_shape_tiered(&shape, ProjectionType::Front, 1.0, 0.01).unwrap();
+    assert!(tiered.preview.is_none());
+    let exact = tiered.exact.wait().unwrap();
+    let direct = project_shape_v2(&shape, ProjectionType::Front, 1.0, 0.01).unwrap();
+    assert_eq!(exact.curves.len(), direct.curves.len());
+
+    let preview =
+        cadhy_cad::project_shape_preview(&shape, ProjectionType::Front, 1.0, 0.1).unwrap();
+    assert!(!preview.visible_curves().is_empty());
+
+    // A cancelled job yields no result
+    let pending =
+        cadhy_cad::project_shape_background(&shape, ProjectionType::Top, 1.0, 0.01).unwrap();
+    pending.cancel();
+    assert!(pending.is_ready());
+    assert!(pending.wait().is_err());
+}
+
+#[test]
+fn test_hlr_cache_survives_rebuilt_shape() {
+    use cadhy_cad::{project_shape_v2, ProjectionType};
+
+    let shape = Primitives::make_box_at(1.0, 2.0, 3.0, 7.0, 11.0, 13.0).unwrap();
+    let first = project_shape_v2(&shape, ProjectionType::Right, 1.0, 0.01).unwrap();
+
+    // Same model built again: different object, same content
+    let rebuilt = Primitives::make_box_at(1.0, 2.0, 3.0, 7.0, 11.0, 13.0).unwrap();
+    let before = cadhy_cad::hlr_cache_stats();
+    let scaled = project_shape_v2(&rebuilt, ProjectionType::Right, 2.0, 0.01).unwrap();
+    let after = cadhy_cad::hlr_cache_stats();
+
+    // Counters are process-wide, so other tests may bump them concurrently
+    assert!(
+        after.hits > before.hits,
+        "Rebuilt shape should hit the cache"
+    );
+    assert_eq!(scaled.curves.len(), first.curves.len());
+    let width = |r: &cadhy_cad::ProjectionResultV2| r.bounding_box.max.x - r.bounding_box.min.x;
+    assert!((width(&scaled) - 2.0 * width(&first)).abs() < 1e-6);
+}
+
+#[test]
+fn test_fast_section_matches_exact() {
+    use cadhy_cad::{compute_section_with_hatch, HatchConfig, SectionPlane, SectionSlicer};
+
+    let shape = Primitives::make_box(10.0, 20.0, 30.0).unwrap();
+    let config = HatchConfig {
+        angle_deg: 45.0,
+        spacing: 1.0,
+    };
+    let slicer = SectionSlicer::new(&shape, 0.01).unwrap();
+
+    for z in [2.5, 15.0, 27.5] {
+        let plane = SectionPlane::horizontal(z, "A");
+        let exact = compute_section_with_hatch(&shape, &plane, &config).unwrap();
+        let fast = slicer.section(&plane, &config).unwrap();
+
+        assert_eq!(fast.num_regions, 1, "Box cut should be one closed loop");
+        assert!(fast.curves.iter().all(|c| c.is_closed));
+        let exact_area: f64 = exact.hatched_regions.iter().map(|r| r.area).sum();
+        let fast_area = fast.hatched_regions[0].area;
+        assert!(
+            (fast_area - exact_area).abs() < 0.01 * exact_area,
+            "Fast area {} vs exact {}",
+            fast_area,
+            exact_area
+        );
+    }
+}
+
+#[test]
+fn test_section_hatch_covers_region() {
+    use cadhy_cad::{compute_section_with_hatch, HatchConfig, SectionPlane};
+
+    let shape = Primitives::make_box(10.0, 20.0, 30.0).unwrap();
+    let config = HatchConfig {
+        angle_deg: 30.0,
+        spacing: 0.25,
+    };
+    let plane = SectionPlane::horizontal(12.0, "A");
+    let result = compute_section_with_hatch(&shape, &plane, &config).unwrap();
+
+    // Hatch lines fill the 10 x 20 cut: total length ~ area / spacing
+    let length: f64 = result.hatched_regions[0]
+        .hatch_lines
+        .iter()
+        .map(|l| ((l.end[0] - l.start[0]).powi(2) + (l.end[1] - l.start[1]).powi(2)).sqrt())
+        .sum();
+    let expected = 200.0 / config.spacing;
+    assert!(
+        (length - expected).abs() < 0.05 * expected,
+        "Hatch length {} vs expected {}",
+        length,
+        expected
+    );
+}
+
+#[test]
+fn test_batched_sections_match_single_sections() {
+    use cadhy_cad::{section_by_plane, sections_at_offsets, Operations};
+
+    // Block with a through bore and a boss on top: the planes cross
+    // different face sets, and the first and last miss the model
+    let block = Primitives::make_box(20.0, 20.0, 10.0).unwrap();
+    let bore = Primitives::make_cylinder_at(10.0, 10.0, -1.0, 0.0, 0.0, 1.0, 4.0, 12.0).unwrap();
+    let boss = Primitives::make_box_at(2.0, 2.0, 10.0, 4.0, 16.0, 5.0).unwrap();
+    let shape = Operations::fuse(&Operations::cut(&block, &bore).unwrap(), &boss).unwrap();
+
+    let normal = [1.0, 0.0, 0.0];
+    let offsets = [25.0, 3.0, 7.5, 10.5, 13.0, 18.0, -1.0];
+    let batched = sections_at_offsets(&shape, normal, &offsets);
+    assert_eq!(batched.len(), offsets.len());
+
+    for (&offset, batch) in offsets.iter().zip(&batched) {
+        let single = section_by_plane(&shape, [offset, 0.0, 0.0], normal);
+        assert_eq!(batch.outlines, single.outlines);
+        assert!((batch.outline_length - single.outline_length).abs() < 1e-6);
+        assert_eq!(batch.is_closed, single.is_closed);
+        assert!((batch.area - single.area).abs() < 1e-6);
+        for k in 0..3 {
+            assert!((batch.centroid[k] - single.centroid[k]).abs() < 1e-6);
+        }
+    }
+
+    // Planes off the model cut nothing; the others cut the bore or the boss
+    assert_eq!(batched[0].outlines, 0);
+    assert_eq!(batched[6].outlines, 0);
+    assert!(batched[2].outlines > batched[5].outlines);
+    assert!(batched[1].outline_length > batched[5].outline_length);
+}
+
+#[test]
+fn test_section_hatch_skips_holes() {
+    use cadhy_cad::{
+        compute_section_with_hatch, HatchConfig, Operations, SectionPlane, SectionSlicer,
+    };
+
+    let block = Primitives::make_box(20.0, 20.0, 10.0).unwrap();
+    let bore = Primitives::make_box_at(6.0, 6.0, -1.0, 8.0, 8.0, 12.0).unwrap();
+    let shape = Operations::cut(&block, &bore).unwrap();
+    let config = HatchConfig {
+        angle_deg: 45.0,
+        spacing: 0.25,
+    };
+    let plane = SectionPlane::horizontal(5.0, "A");
+    let slicer = SectionSlicer::new(&shape, 0.01).unwrap();
+
+    for result in [
+        compute_section_with_hatch(&shape, &plane, &config).unwrap(),
+        slicer.section(&plane, &config).unwrap(),
+    ] {
+        // Outer square and the bore; the bore gets no hatching
+        assert_eq!(result.hatched_regions.len(), 2);
+        let hole = result
+            .hatched_regions
+            .iter()
+            .min_by(|a, b| a.area.partial_cmp(&b.area).unwrap())
+            .unwrap();
+        assert!(hole.hatch_lines.is_empty());
+
+        // Hatch lines fill the square minus the bore
+        let length: f64 = result
+            .hatched_regions
+            .iter()
+            .flat_map(|r| &r.hatch_lines)
+            .map(|l| ((l.end[0] - l.start[0]).powi(2) + (l.end[1] - l.start[1]).powi(2)).sqrt())
+            .sum();
+        let expected = (400.0 - 64.0) / config.spacing;
+        assert!(
+            (length - expected).abs() < 0.05 * expected,
+            "Hatch length {} vs expected {}",
+            length,
+            expected
+        );
+    }
+}
+
+#[test]
+fn test_projection_drawing_streams_svg_and_dxf() {
+    use cadhy_cad::{
+        write_projection_drawing, DrawingExportOptions, DrawingFormat, ProjectionType,
+    };
+
+    let shape = Primitives::make_cylinder(5.0, 10.0).unwrap();
+    let dir = std::env::temp_dir();
+
+    for (format, name) in [
+        (DrawingFormat::Svg, "cadhy_drawing_test.svg"),
+        (DrawingFormat::DxfR12, "cadhy_drawing_test_r12.dxf"),
+        (DrawingFormat::DxfR2000, "cadhy_drawing_test_r2000.dxf"),
+    ] {
+        let path = dir.join(name);
+        let options = DrawingExportOptions {
+            format,
+            precision: 3,
+            quantum: 0.001,
+        };
+        write_projection_drawing(
+            &shape,
+            ProjectionType::Front,
+            1.0,
+            0.01,
+            path.to_str().unwrap(),
+            &options,
+        )
+        .unwrap();
+
+        let text = std::fs::read_to_string(&path).unwrap();
+        let _ = std::fs::remove_file(&path);
+        match format {
+            DrawingFormat::Svg => {
+                assert!(text.starts_with("<?xml"));
+                assert!(text.trim_end().ends_with("</svg>"));
+                assert!(text.contains("<path"));
+            }
+            _ => {
+                assert!(text.contains("ENTITIES"));
+                assert!(text.contains("\nLINE\n"));
+                assert!(text.ends_with("0\nEOF\n"));
+            }
+        }
+        if format == DrawingFormat::DxfR2000 {
+            for required in [
+                "$HANDSEED",
+                "\nBLOCK_RECORD\n",
+                "*Model_Space",
+                "*Paper_Space",
+                "\nBLOCKS\n",
+                "\nOBJECTS\n",
+                "ACAD_GROUP",
+            ] {
+                assert!(text.contains(required), "R2000 output lacks {}", required);
+            }
+        }
+    }
+}
+
+#[test]
+fn test_simplified_projection_drops_overlaps() {
+    use cadhy_cad::{project_shape_v2, project_shape_v2_simplified, Curve2D, ProjectionType};
+
+    // Front view of a box: the back edges are hidden right under the front ones
+    let shape = Primitives::make_box(10.0, 20.0, 30.0).unwrap();
+    let exact = project_shape_v2(&shape, ProjectionType::Front, 1.0, 0.01).unwrap();
+    let simplified =
+        project_shape_v2_simplified(&shape, ProjectionType::Front, 1.0, 0.01, 0.01).unwrap();
+    assert!(simplified.hidden_curves().is_empty());
+    assert!(simplified.visible_curves().len() <= exact.visible_curves().len());
+
+    // Dense outlines shrink, the extent does not change
+    let torus = Primitives::make_torus(20.0, 5.0).unwrap();
+    let points = |r: &cadhy_cad::ProjectionResultV2| -> usize {
+        r.curves
+            .iter()
+            .map(|c| match c {
+                Curve2D::Polyline(p) => p.points.len(),
+                _ => 2,
+            })
+            .sum()
+    };
+    let exact = project_shape_v2(&torus, ProjectionType::Isometric, 1.0, 0.01).unwrap();
+    let simplified =
+        project_shape_v2_simplified(&torus, ProjectionType::Isometric, 1.0, 0.01, 0.05).unwrap();
+    assert!(points(&simplified) <= points(&exact));
+    let width = |r: &cadhy_cad::ProjectionResultV2| r.bounding_box.max.x - r.bounding_box.min.x;
+    assert!((width(&simplified) - width(&exact)).abs() < 1e-6);
+
+    // Cylinder caps project to ellipses, which are not counted as arcs
+    let cylinder = Primitives::make_cylinder(5.0, 10.0).unwrap();
+    let exact = project_shape_v2(&cylinder, ProjectionType::Isometric, 1.0, 0.01).unwrap();
+    let simplified =
+        project_shape_v2_simplified(&cylinder, ProjectionType::Isometric, 1.0, 0.01, 0.01).unwrap();
+    for result in [&exact, &simplified] {
+        let ellipses = result
+            .curves
+            .iter()
+            .filter(|c| matches!(c, Curve2D::Ellipse(_)))
+            .count();
+        assert!(ellipses > 0);
+        assert_eq!(result.num_ellipses as usize, ellipses);
+        assert!(result.num_arcs as usize <= result.curves.len() - ellipses);
+    }
+    assert_eq!(simplified.num_ellipses, exact.num_ellipses);
+}
+
+#[test]
+fn test_full_topology_edges_match_tessellate_edges() {
+    use cadhy_cad::Topology;
+
+    let shape = Primitives::make_cylinder(5.0, 10.0).unwrap();
+    let edges = Topology::tessellate_edges(&shape, 0.01);
+    let full = Topology::get_full(&shape, 0.01);
+    assert_eq!(edges.len(), full.edges.len());
+    assert_eq!(full.edge_to_faces_offset.len(), edges.len() + 1);
+
+    for (i, (a, b)) in edges.iter().zip(full.edges.iter()).enumerate() {
+        assert_eq!(a.index as usize, i);
+        assert_eq!(a.points.len(), b.points.len());
+        assert_eq!(a.adjacent_faces, b.adjacent_faces);
+        assert_eq!(full.faces_for_edge(i), &b.adjacent_faces[..]);
+    }
+
+    // Circles are measured exactly, the seam line from its end points
+    let circumference = 2.0 * std::f64::consts::PI * 5.0;
+    let circles: Vec<_> = edges
+        .iter()
+        .filter(|e| e.curve_type == cadhy_cad::CurveType::Circle)
+        .collect();
+    assert_eq!(circles.len(), 2);
+    for e in circles {
+        assert!((e.length - circumference).abs() < 1e-9);
+    }
+    let seam = edges
+        .iter()
+        .find(|e| e.curve_type == cadhy_cad::CurveType::Line)
+        .unwrap();
+    assert!((seam.length - 10.0).abs() < 1e-9);
+}
+
+#[test]
+fn test_topology_snapshot_matches_full_topology() {
+    use cadhy_cad::Topology;
+
+    let shape = Primitives::make_box(10.0, 20.0, 30.0).unwrap();
+    let snapshot = Topology::snapshot(&shape);
+    let full = Topology::get_full(&shape, 0.01);
+
+    assert_eq!(snapshot.num_vertices(), 8);
+    assert_eq!(snapshot.num_edges(), 12);
+    assert_eq!(snapshot.num_faces(), 6);
+    for v in 0..8 {
+        assert_eq!(snapshot.edges_for_vertex(v).len(), 3);
+    }
+    for e in 0..12 {
+        assert_eq!(snapshot.faces_for_edge(e), full.faces_for_edge(e));
+    }
+    for f in 0..6 {
+        assert_eq!(
+            snapshot.edges_for_face(f),
+            &full.faces[f].boundary_edges[..]
+        );
+    }
+
+    // Polylines on demand: a subset, then every edge
+    let some = Topology::edge_polylines(&shape, &[3, 0, 99], 0.01);
+    assert_eq!(some.offsets.len(), 4);
+    assert_eq!(some.polyline(0).len(), 3 * full.edges[3].points.len());
+    assert!(some.polyline(2).is_empty());
+
+    let all: Vec<u32> = (0..12).collect();
+    let polylines = Topology::edge_polylines(&shape, &all, 0.01);
+    let total: f64 = polylines.lengths.iter().sum();
+    assert!((total - 4.0 * (10.0 + 20.0 + 30.0)).abs() < 1e-9);
+}
+
+#[test]
+fn test_boolean_batch_fuse_and_cut() {
+    use cadhy_cad::{Analysis, BooleanOp, BooleanOptions, Operations};
+
+    // Overlapping boxes in a row fuse and unify into one 30 x 10 x 10 box
+    let boxes: Vec<_> = (0..3)
+        .map(|i| Primitives::make_box_at(8.0 * i as f64, 0.0, 0.0, 14.0, 10.0, 10.0).unwrap())
+        .collect();
+    let refs: Vec<_> = boxes.iter().collect();
+    let fused =
+        Operations::boolean_batch(&refs, &[], BooleanOp::Fuse, &BooleanOptions::default()).unwrap();
+    let analysis = Analysis::analyze(&fused);
+    assert!(analysis.is_valid);
+    assert_eq!(analysis.num_solids, 1);
+    assert_eq!(analysis.num_faces, 6);
+
+    // Three through-holes in one batched cut
+    let plate = Primitives::make_box(30.0, 10.0, 2.0).unwrap();
+    let holes: Vec<_> = (0..3)
+        .map(|i| {
+            let x = 5.0 + 10.0 * i as f64;
+            Primitives::make_cylinder_at(x, 5.0, -1.0, 0.0, 0.0, 1.0, 2.0, 4.0).unwrap()
+        })
+        .collect();
+    let tools: Vec<_> = holes.iter().collect();
+    let cut = Operations::cut_many(&plate, &tools).unwrap();
+    let analysis = Analysis::analyze(&cut);
+    assert!(analysis.is_valid);
+    assert_eq!(analysis.num_solids, 1);
+    assert_eq!(analysis.num_faces, 9);
+
+    assert!(
+        Operations::boolean_batch(&[&plate], &[], BooleanOp::Cut, &BooleanOptions::default())
+            .is_err()
+    );
+}
+
+#[test]
+fn test_fuse_many_tree_keeps_clusters_apart() {
+    use cadhy_cad::{Analysis, BooleanOptions, Operations};
+
+    // A run of overlapping segments plus isolated blocks off to the side
+    let mut shapes = Vec::new();
+    for i in 0..20 {
+        shapes.push(Primitives::make_box_at(8.0 * i as f64, 0.0, 0.0, 10.0, 10.0, 10.0).unwrap());
+    }
+    for i in 0..5 {
+        shapes.push(Primitives::make_box_at(40.0 * i as f64, 100.0, 0.0, 5.0, 5.0, 5.0).unwrap());
+    }
+    let refs: Vec<_> = shapes.iter().collect();
+
+    let (fused, stats) =
+        Operations::fuse_many_with_stats(&refs, &BooleanOptions::default()).unwrap();
+    let analysis = Analysis::analyze(&fused);
+    assert!(analysis.is_valid);
+    assert_eq!(analysis.num_solids, 6);
+    assert_eq!(analysis.num_faces, 36);
+
+    assert_eq!(stats.inputs, 25);
+    assert!(stats.levels.len() >= 2);
+    assert_eq!(stats.levels.last().unwrap().nodes, 1);
+    let booleans: u32 = stats.levels.iter().map(|l| l.booleans).sum();
+    let passthrough: u32 = stats.levels.iter().map(|l| l.passthrough).sum();
+    assert!(booleans < 25);
+    assert!(passthrough >= 5);
+    assert!(stats.total_seconds >= stats.unify_seconds);
+}
+
+#[test]
+fn test_boolean_preflight_short_circuits() {
+    use cadhy_cad::{Analysis, BooleanOp, BooleanPath, Operations};
+
+    let block = Primitives::make_box(10.0, 10.0, 10.0).unwrap();
+    let far = Primitives::make_box_at(20.0, 0.0, 0.0, 2.0, 2.0, 2.0).unwrap();
+    let inner = Primitives::make_box_at(4.0, 4.0, 4.0, 2.0, 2.0, 2.0).unwrap();
+    let crossing = Primitives::make_box_at(8.0, 4.0, 4.0, 4.0, 2.0, 2.0).unwrap();
+
+    assert_eq!(
+        Operations::classify_boolean(&block, &far),
+        BooleanPath::Disjoint
+    );
+    assert_eq!(
+        Operations::classify_boolean(&block, &inner),
+        BooleanPath::ToolInside
+    );
+    assert_eq!(
+        Operations::classify_boolean(&inner, &block),
+        BooleanPath::ArgumentInside
+    );
+    assert_eq!(
+        Operations::classify_boolean(&block, &crossing),
+        BooleanPath::Full
+    );
+
+    let (cut, report) = Operations::boolean_with_report(&block, &far, BooleanOp::Cut).unwrap();
+    assert_eq!(report.path, BooleanPath::Disjoint);
+    assert_eq!(Analysis::analyze(&cut).num_faces, 6);
+
+    let (fused, report) = Operations::boolean_with_report(&block, &inner, BooleanOp::Fuse).unwrap();
+    assert_eq!(report.path, BooleanPath::ToolInside);
+    assert_eq!(Analysis::analyze(&fused).num_faces, 6);
+
+    let (common, _) = Operations::boolean_with_report(&block, &far, BooleanOp::Common).unwrap();
+    assert_eq!(Analysis::analyze(&common).num_solids, 0);
+
+    // Compound argument: only the body the opening crosses is cut
+    let bodies = Operations::combine(&[&block, &far]).unwrap();
+    let (cut, report) =
+        Operations::boolean_with_report(&bodies, &crossing, BooleanOp::Cut).unwrap();
+    assert_eq!(report.path, BooleanPath::Full);
+    assert_eq!(report.passthrough, 1);
+    let analysis = Analysis::analyze(&cut);
+    assert_eq!(analysis.num_solids, 2);
+    assert_eq!(analysis.num_faces, 11 + 6);
+}
+
+#[test]
+fn test_boolean_history_maps_untouched_faces() {
+    use cadhy_cad::{BooleanOp, Operations, ShapeFate, Topology};
+
+    // Notch through the +X face: that face is modified, the other five
+    // come through unchanged
+    let block = Primitives::make_box(10.0, 10.0, 10.0).unwrap();
+    let notch = Primitives::make_box_at(8.0, 4.0, 4.0, 4.0, 2.0, 2.0).unwrap();
+    let (cut, history) = Operations::boolean_with_history(&block, &notch, BooleanOp::Cut).unwrap();
+
+    assert_eq!(history.result_faces, Topology::snapshot(&cut).num_faces());
+    assert_eq!(history.argument_faces.len(), 6);
+    let fates = &history.argument_faces.fates;
+    assert_eq!(
+        fates.iter().filter(|&&f| f == ShapeFate::Unchanged).count(),
+        5
+    );
+    assert_eq!(
+        fates.iter().filter(|&&f| f == ShapeFate::Modified).count(),
+        1
+    );
+    for i in 0..6 {
+        for &target in history.argument_faces.targets(i) {
+            assert!((target as usize) < history.result_faces);
+        }
+    }
+
+    let labels: Vec<usize> = (0..6).collect();
+    let carried = history
+        .argument_faces
+        .transfer(&labels, history.result_faces, false);
+    assert_eq!(carried.iter().filter(|l| l.is_some()).count(), 5);
+    assert_eq!(history.argument_edges.len(), 12);
+}
+
+#[test]
+fn test_boolean_history_follows_unified_faces() {
+    use cadhy_cad::{BooleanOp, BooleanPath, Operations, ShapeFate};
+
+    // Overlapping boxes fuse into one 15x10x10 box: the boolean splits the
+    // top, bottom, front and back faces at the other box's edges and the
+    // unify merges the pieces back, so each pair maps to one result face
+    let left = Primitives::make_box(10.0, 10.0, 10.0).unwrap();
+    let right = Primitives::make_box_at(5.0, 0.0, 0.0, 10.0, 10.0, 10.0).unwrap();
+    let (_, history) = Operations::boolean_with_history(&left, &right, BooleanOp::Fuse).unwrap();
+
+    assert_eq!(history.path, BooleanPath::Full);
+    assert_eq!(history.result_faces, 6);
+    for face in 2..6 {
+        assert_eq!(history.argument_faces.fates[face], ShapeFate::Modified);
+        assert_eq!(history.tool_faces.fates[face], ShapeFate::Modified);
+        let targets = history.argument_faces.targets(face);
+        assert_eq!(targets.len(), 1);
+        assert_eq!(targets, history.tool_faces.targets(face));
+    }
+
+    // The faces inside the other box are gone
+    assert_eq!(history.argument_faces.fates[1], ShapeFate::Removed);
+    assert_eq!(history.tool_faces.fates[0], ShapeFate::Removed);
+}
+
+#[test]
+fn test_operation_progress_cancel_and_timeout() {
+    use cadhy_cad::{Analysis, BooleanOp, OcctError, OperationProgress, Operations};
+    use std::time::Duration;
+
+    let block = Primitives::make_box(10.0, 10.0, 10.0).unwrap();
+    let tool = Primitives::make_box_at(5.0, 5.0, 5.0, 10.0, 10.0, 10.0).unwrap();
+
+    let progress = OperationProgress::new();
+    let cut = Operations::boolean_with_progress(&block, &tool, BooleanOp::Cut, &progress).unwrap();
+    assert_eq!(Analysis::analyze(&cut).num_solids, 1);
+    assert!(progress.fraction() > 0.99);
+    assert!(!progress.is_cancelled() && !progress.timed_out());
+
+    let cancelled = OperationProgress::new();
+    cancelled.cancel();
+    let result = Operations::boolean_with_progress(&block, &tool, BooleanOp::Cut, &cancelled);
+    assert!(matches!(result, Err(OcctError::Cancelled)));
+
+    let expired = OperationProgress::new();
+    expired.set_timeout(Duration::from_nanos(1));
+    std::thread::sleep(Duration::from_millis(1));
+    let result = Operations::boolean_with_progress(&block, &tool, BooleanOp::Fuse, &expired);
+    assert!(matches!(result, Err(OcctError::TimedOut)));
+    assert!(expired.timed_out() && !expired.is_cancelled());
+}
+
+#[test]
+fn test_operation_progress_stops_running_boolean() {
+    use cadhy_cad::{BooleanOp, OcctError, OperationProgress, Operations, Shape};
+    use std::time::Duration;
+
+    // A plate drilled by a 20x20 grid of pins keeps the boolean busy long
+    // enough to be stopped from inside OCCT rather than before it starts
+    let plate = Primitives::make_box(100.0, 100.0, 10.0).unwrap();
+    let pins: Vec<Shape> = (0..400)
+        .map(|i| {
+            let (x, y) = (2.5 + 5.0 * (i % 20) as f64, 2.5 + 5.0 * (i / 20) as f64);
+            Primitives::make_cylinder_at(x, y, -1.0, 0.0, 0.0, 1.0, 1.5, 12.0).unwrap()
+        })
+        .collect();
+    let pin_refs: Vec<&Shape> = pins.iter().collect();
+    let tool = Operations::combine(&pin_refs).unwrap();
+
+    let cancelled = OperationProgress::new();
+    let result = std::thread::scope(|scope| {
+        scope.spawn(|| {
+            while cancelled.stage().is_empty() {
+                std::thread::sleep(Duration::from_millis(1));
+            }
+            std::thread::sleep(Duration::from_millis(20));
+            cancelled.cancel();
+        });
+        Operations::boolean_with_progress(&plate, &tool, BooleanOp::Cut, &cancelled)
+    });
+    assert!(matches!(result, Err(OcctError::Cancelled)));
+    assert!(cancelled.fraction() < 1.0);
+
+    let expired = OperationProgress::new();
+    expired.set_timeout(Duration::from_millis(20));
+    let result = Operations::boolean_with_progress(&plate, &tool, BooleanOp::Cut, &expired);
+    assert!(matches!(result, Err(OcctError::TimedOut)));
+    assert!(expired.fraction() < 1.0);
+}